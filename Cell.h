@@ -2,6 +2,8 @@
 #define CELL_H_INCLUDED
 
 #include "Link.h"
+#include "RandomTools.h"
+#include "Genome.h"
 
 class Cell
 {
@@ -26,7 +28,8 @@ private:
 	double broadcastCoeff; //modifies amplification level and sign of this cell's post-action potential signal to other cells (any value)
 	double decayRate; //modifies speed of stimulus loss per stimulate() level if the cell does not reach action potential (>= 0.0 *total loss*, <= 1 *no loss*)
 	unsigned char refractoryPeriod; //the number of stimulate() levels following activation when stimulus is reset to zero and this cell can be reactivated (> 0)	
-	UniformList<Link> postLinks; //list of links (cells and linkCoeffs) corresponding this cell's output connections (assumed to always be populated)
+	ExtensibleArray<Link> postLinks; //array of links (cells and linkCoeffs) corresponding this cell's output connections in ascending postCellIndex order (assumed to always be populated)
+	ExtensibleArray<unsigned long long> postLinksOccupancy; //bitset (bit index % 64 of word index / 64) marking thisCellIndex, each postCellIndex in postLinks and the padding bits past the last cell as unavailable (empty until the first structural mutation)
 
 	//updateable stimulus calculation properties
 	unsigned short priorLinksCount; //the tracked number of cells which send this cell stimulus
@@ -38,500 +41,387 @@ private:
 	unsigned short roundRefractionComplete; //stores the count (starting from 1) of the stimulus round in which this cell will have passed it's refractory period after activation (0 if never activated)
 	unsigned short activationCount; //tracks number of activations per stimulate() call
 
+	//sharing property
+	unsigned int shareCount; //number of nets (and incremental evaluation traces) currently referring to this cell; a cell is only modified in place when shareCount == 1
+
 	//***private sub-mutation methods***
 
-	//finds the nearest available postCell value, either before or after
-	//startingAndReturnLinkNode, which is not currently in this cell's
-	//postLinks list; assumes postLinks length is < totalCellCount - 1
-	//sets value of startingAndReturnIndex to the index of the nearest
-	//available post cell index and sets startingAndReturnLinkNode to the
-	//post cell node just prior to where new post link will be inserted
-	//(NULL if at list start)
-	inline void sub_MutatePostLinks_FindNearestAvailablePostCellIndex(const unsigned short totalCellCount,
-		unsigned short &startingAndReturnIndex, UniformNode<Link> *&startingAndReturnLinkNode)
+	//returns the position in postLinks of the first link with a postCellIndex
+	//>= postCellIndex (postLinks length if there is none); postLinks is kept
+	//in ascending postCellIndex order so a binary search is used
+	inline unsigned short sub_MutatePostLinks_FindPostLinkPosition(const unsigned short postCellIndex) const
 	{
 
-		//initial setup
-		unsigned short forwardIterationIndex(startingAndReturnIndex);
-		UniformNode<Link> *forwardLinkNode(startingAndReturnLinkNode);
-		unsigned short backwardIterationIndex(startingAndReturnIndex);
-		UniformNode<Link> *backwardLinkNode(startingAndReturnLinkNode);
+		unsigned short lowPosition(0);
+		unsigned short highPosition(postLinks.get_ArrayLength());
+		unsigned short midPosition;
 
-		//main loop
-		do
+		while (lowPosition < highPosition)
 		{
 
-			//single forward iteration
-			forwardLinkNode = forwardLinkNode->get_NextNode();
-			{
-
-				if (!forwardLinkNode)
-				{
-
-					//terminal states with no available postCell indices
-					if (forwardIterationIndex == (totalCellCount - 1)
-						|| (forwardIterationIndex == (totalCellCount - 2) && thisCellIndex == (totalCellCount - 1)))
-					{
-
-						//iterate backwards to completion
-						do
-						{
-
-							backwardLinkNode = backwardLinkNode->get_PriorNode();
-							backwardIterationIndex--;
-
-							if (!backwardLinkNode)
-							{
-
-								if (backwardIterationIndex == thisCellIndex)
-									backwardIterationIndex--;
-
-								startingAndReturnLinkNode = NULL;
-								startingAndReturnIndex = backwardIterationIndex;
-
-								return;
-
-							}
-
-							else
-							{
+			midPosition = lowPosition + ((highPosition - lowPosition) / 2);
 
-								if (backwardIterationIndex != backwardLinkNode->content.postCellIndex)
-								{
+			if (postLinks.get_ElementAddress(midPosition)->postCellIndex < postCellIndex)
+				lowPosition = midPosition + 1;
 
-									if (backwardIterationIndex == thisCellIndex)
-									{
-
-										backwardIterationIndex--;
-
-										if (backwardIterationIndex != backwardLinkNode->content.postCellIndex)
-										{
+			else
+				highPosition = midPosition;
 
-											startingAndReturnLinkNode = backwardLinkNode;
-											startingAndReturnIndex = backwardIterationIndex;
+		}
 
-											return;
+		return lowPosition;
 
-										}
+	}
 
-									}
+	//returns the index of the lowest set bit of word (by halving the
+	//searched width each step); assumes word != 0
+	inline static unsigned short sub_MutatePostLinks_GetLowestBitIndex(unsigned long long word)
+	{
 
-									else
-									{
+		unsigned short bitIndex(0);
 
-										startingAndReturnLinkNode = backwardLinkNode;
-										startingAndReturnIndex = backwardIterationIndex;
+		for (unsigned short width = 32; width; width /= 2)
+		{
 
-										return;
+			//the lowest width bits are all clear
+			if (!(word << (64 - width)))
+			{
 
-									}
+				word >>= width;
+				bitIndex += width;
 
-								}
+			}
 
-							}
+		}
 
-						} while (true);
+		return bitIndex;
 
-					}
+	}
 
-					else
-					{
+	//returns the index of the highest set bit of word (by halving the
+	//searched width each step); assumes word != 0
+	inline static unsigned short sub_MutatePostLinks_GetHighestBitIndex(unsigned long long word)
+	{
 
-						forwardIterationIndex++;
-						
-						if (forwardIterationIndex == thisCellIndex)
-							forwardIterationIndex++;
+		unsigned short bitIndex(63);
 
-						startingAndReturnLinkNode = postLinks.get_LastNode();
-						startingAndReturnIndex = forwardIterationIndex;
+		for (unsigned short width = 32; width; width /= 2)
+		{
 
-						return;
+			//the highest width bits are all clear
+			if (!(word >> (64 - width)))
+			{
 
-					}
+				word <<= width;
+				bitIndex -= width;
 
-				}
+			}
 
-				else
-				{
+		}
 
-					forwardIterationIndex++;
+		return bitIndex;
 
-					if (forwardIterationIndex != forwardLinkNode->content.postCellIndex)
-					{
+	}
 
-						if (forwardIterationIndex == thisCellIndex)
-						{
+	//(re)builds postLinksOccupancy from thisCellIndex and postLinks unless it is
+	//already sized for totalCellCount (it is kept current by the insert, delete
+	//and relocate methods below)
+	inline void sub_MutatePostLinks_PrepareOccupancy(const unsigned short totalCellCount)
+	{
 
-							forwardIterationIndex++;
+		const unsigned short wordCount((totalCellCount + 63) / 64);
 
-							if (forwardIterationIndex != forwardLinkNode->content.postCellIndex)
-							{
+		if (postLinksOccupancy.get_ArrayLength() == wordCount)
+			return;
 
-								startingAndReturnLinkNode = forwardLinkNode->get_PriorNode();
-								startingAndReturnIndex = forwardIterationIndex;
+		const unsigned short postLinksLength(postLinks.get_ArrayLength());
+		unsigned short count;
 
-								return;
+		postLinksOccupancy.resize_NoCopy(wordCount);
 
-							}
+		for (count = 0; count < wordCount; count++)
+			*(postLinksOccupancy.get_ElementAddress(count)) = 0;
 
-						}
+		//padding bits past the last cell are never available
+		if (totalCellCount % 64)
+			*(postLinksOccupancy.get_ElementAddress(wordCount - 1)) = (~0ULL << (totalCellCount % 64));
 
-						else
-						{
+		sub_MutatePostLinks_SetOccupied(thisCellIndex, true);
 
-							startingAndReturnLinkNode = forwardLinkNode->get_PriorNode();
-							startingAndReturnIndex = forwardIterationIndex;
+		for (count = 0; count < postLinksLength; count++)
+			sub_MutatePostLinks_SetOccupied(postLinks.get_ElementAddress(count)->postCellIndex, true);
 
-							return;
+	}
 
-						}
+	//sets (occupied == true) or clears the postLinksOccupancy bit of postCellIndex
+	inline void sub_MutatePostLinks_SetOccupied(const unsigned short postCellIndex, const bool occupied)
+	{
 
-					}
+		if (occupied)
+			*(postLinksOccupancy.get_ElementAddress(postCellIndex / 64)) |= (1ULL << (postCellIndex % 64));
 
-				}
+		else
+			*(postLinksOccupancy.get_ElementAddress(postCellIndex / 64)) &= ~(1ULL << (postCellIndex % 64));
 
-			}
+	}
 
-			//single backward iteration
-			backwardLinkNode = backwardLinkNode->get_PriorNode();
-			{
+	//returns true if a link to postCellIndex may be added to postLinks
+	//(postCellIndex is neither thisCellIndex nor already in postLinks);
+	//assumes postLinksOccupancy has been prepared
+	inline bool sub_MutatePostLinks_TestPostCellIndexAvailable(const unsigned short postCellIndex) const
+	{
 
-				if (!backwardLinkNode)
-				{
+		return !(postLinksOccupancy.get_Element(postCellIndex / 64) & (1ULL << (postCellIndex % 64)));
 
-					//terminal states with no available postCell indices
-					if (backwardIterationIndex == 0
-						|| backwardIterationIndex == 1 && thisCellIndex == 0)
-					{
+	}
 
-						//iterate forward to completion
-						do
-						{
+	//sets returnIndex to the lowest available post cell index >= fromIndex, scanning
+	//postLinksOccupancy a word at a time; returns false if there is none;
+	//assumes postLinksOccupancy has been prepared and fromIndex < totalCellCount
+	inline bool sub_MutatePostLinks_FindNextAvailablePostCellIndex(const unsigned short fromIndex,
+		unsigned short &returnIndex) const
+	{
 
-							forwardLinkNode = forwardLinkNode->get_NextNode();
-							forwardIterationIndex++;
+		const unsigned short wordCount(postLinksOccupancy.get_ArrayLength());
+		unsigned short wordIndex(fromIndex / 64);
+		unsigned long long availableBits(~postLinksOccupancy.get_Element(wordIndex) & (~0ULL << (fromIndex % 64)));
 
-							if (!forwardLinkNode)
-							{
+		while (!availableBits)
+		{
 
-								if (forwardIterationIndex == thisCellIndex)
-									forwardIterationIndex++;
+			wordIndex++;
 
-								startingAndReturnLinkNode = postLinks.get_LastNode();
-								startingAndReturnIndex = forwardIterationIndex;
+			if (wordIndex == wordCount)
+				return false;
 
-								return;
+			availableBits = ~postLinksOccupancy.get_Element(wordIndex);
 
-							}
+		}
 
-							else
-							{
+		returnIndex = (wordIndex * 64) + sub_MutatePostLinks_GetLowestBitIndex(availableBits);
+		return true;
 
-								if (forwardIterationIndex != forwardLinkNode->content.postCellIndex)
-								{
+	}
 
-									if (forwardIterationIndex == thisCellIndex)
-									{
+	//sets returnIndex to the highest available post cell index <= fromIndex, scanning
+	//postLinksOccupancy a word at a time; returns false if there is none;
+	//assumes postLinksOccupancy has been prepared and fromIndex < totalCellCount
+	inline bool sub_MutatePostLinks_FindPreviousAvailablePostCellIndex(const unsigned short fromIndex,
+		unsigned short &returnIndex) const
+	{
 
-										forwardIterationIndex++;
+		unsigned short wordIndex(fromIndex / 64);
+		unsigned long long availableBits(~postLinksOccupancy.get_Element(wordIndex) & (~0ULL >> (63 - (fromIndex % 64))));
 
-										if (forwardIterationIndex != forwardLinkNode->content.postCellIndex)
-										{
+		while (!availableBits)
+		{
 
-											startingAndReturnLinkNode = forwardLinkNode->get_PriorNode();
-											startingAndReturnIndex = forwardIterationIndex;
+			if (!wordIndex)
+				return false;
 
-											return;
+			wordIndex--;
+			availableBits = ~postLinksOccupancy.get_Element(wordIndex);
 
-										}
+		}
 
-									}
+		returnIndex = (wordIndex * 64) + sub_MutatePostLinks_GetHighestBitIndex(availableBits);
+		return true;
 
-									else
-									{
+	}
 
-										startingAndReturnLinkNode = forwardLinkNode->get_PriorNode();
-										startingAndReturnIndex = forwardIterationIndex;
+	//sets startingAndReturnIndex to the nearest available post cell index (the
+	//later index if two are equally near); assumes postLinksOccupancy has been
+	//prepared and postLinks length is < totalCellCount - 1
+	inline void sub_MutatePostLinks_FindNearestAvailablePostCellIndex(const unsigned short totalCellCount,
+		unsigned short &startingAndReturnIndex) const
+	{
 
-										return;
+		unsigned short nextIndex(0);
+		unsigned short previousIndex(0);
+		const bool nextFound(startingAndReturnIndex + 1 < totalCellCount
+			&& sub_MutatePostLinks_FindNextAvailablePostCellIndex(startingAndReturnIndex + 1, nextIndex));
+		const bool previousFound(startingAndReturnIndex > 0
+			&& sub_MutatePostLinks_FindPreviousAvailablePostCellIndex(startingAndReturnIndex - 1, previousIndex));
 
-									}
+		if (nextFound && (!previousFound
+			|| nextIndex - startingAndReturnIndex <= startingAndReturnIndex - previousIndex))
+			startingAndReturnIndex = nextIndex;
 
-								}
+		else
+			startingAndReturnIndex = previousIndex;
 
-							}
+	}
 
-						} while (true);
+	//inserts newLink at position in postLinks; the existing links are
+	//block copied into a single new allocation one element longer
+	inline void sub_MutatePostLinks_InsertPostLink(const unsigned short position, const Link &newLink)
+	{
 
-					}
+		unsigned short count(postLinks.get_ArrayLength());
 
-					else
-					{
+		sub_MutatePostLinks_SetOccupied(newLink.postCellIndex, true);
 
-						backwardIterationIndex--;
+		postLinks.resize_WithCopy(count + 1);
 
-						if (backwardIterationIndex == thisCellIndex)
-							backwardIterationIndex--;
+		while (count > position)
+		{
 
-						startingAndReturnLinkNode = NULL;
-						startingAndReturnIndex = backwardIterationIndex;
+			*(postLinks.get_ElementAddress(count)) = postLinks.get_Element(count - 1);
+			count--;
 
-						return;
+		}
 
-					}
+		*(postLinks.get_ElementAddress(position)) = newLink;
 
-				}
+	}
 
-				else
-				{
+	//removes the link at position in postLinks; assumes postLinks length > 1
+	inline void sub_MutatePostLinks_DeletePostLink(unsigned short position)
+	{
 
-					backwardIterationIndex--;
+		const unsigned short lastPosition(postLinks.get_ArrayLength() - 1);
 
-					if (backwardIterationIndex != backwardLinkNode->content.postCellIndex)
-					{
+		sub_MutatePostLinks_SetOccupied(postLinks.get_ElementAddress(position)->postCellIndex, false);
 
-						if (backwardIterationIndex == thisCellIndex)
-						{
+		while (position < lastPosition)
+		{
 
-							backwardIterationIndex--;
+			*(postLinks.get_ElementAddress(position)) = postLinks.get_Element(position + 1);
+			position++;
 
-							if (backwardIterationIndex != backwardLinkNode->content.postCellIndex)
-							{
+		}
 
-								startingAndReturnLinkNode = backwardLinkNode;
-								startingAndReturnIndex = backwardIterationIndex;
+		postLinks.resize_WithCopy(lastPosition);
 
-								return;
+	}
 
-							}
+	//changes the postCellIndex of the link at position to newPostCellIndex and
+	//shifts it within postLinks to keep ascending order (without reallocation)
+	inline void sub_MutatePostLinks_RelocatePostLink(unsigned short position,
+		const unsigned short newPostCellIndex)
+	{
 
-						}
+		const Link relocatedLink(newPostCellIndex, postLinks.get_ElementAddress(position)->linkCoeff);
+		const unsigned short lastPosition(postLinks.get_ArrayLength() - 1);
 
-						else
-						{
+		sub_MutatePostLinks_SetOccupied(postLinks.get_ElementAddress(position)->postCellIndex, false);
+		sub_MutatePostLinks_SetOccupied(newPostCellIndex, true);
 
-							startingAndReturnLinkNode = backwardLinkNode;
-							startingAndReturnIndex = backwardIterationIndex;
+		while (position < lastPosition
+			&& postLinks.get_ElementAddress(position + 1)->postCellIndex < newPostCellIndex)
+		{
 
-							return;
+			*(postLinks.get_ElementAddress(position)) = postLinks.get_Element(position + 1);
+			position++;
 
-						}
+		}
 
-					}
+		while (position > 0
+			&& postLinks.get_ElementAddress(position - 1)->postCellIndex > newPostCellIndex)
+		{
 
-				}
+			*(postLinks.get_ElementAddress(position)) = postLinks.get_Element(position - 1);
+			position--;
 
-			}
+		}
 
-		} while (true);
+		*(postLinks.get_ElementAddress(position)) = relocatedLink;
 
 	}
 
-	//assumes postLinks listLength > 0 and < totalCellCount - 1, and rand() is seeded
+	//assumes postLinks length > 0 and < totalCellCount - 1, and the random generator is seeded
 	inline void sub_MutatePostLinks_AddRandomPostLink(const unsigned short totalCellCount,
-		ExtensibleArray<Cell> &allNetCells)
+		ExtensibleArray<Cell*> &allNetCells)
 	{
 
 		//initial setup
 		unsigned short randomCellIndex;
-		UniformNode<Link> *linkNode(postLinks.get_FirstNode());
 
 		//select a random cell index to add
 		do
 		{
 
-			randomCellIndex = rand() % totalCellCount;
+			randomCellIndex = get_RandomInt() % totalCellCount;
 
 		} while (randomCellIndex == thisCellIndex);
 
-		//if randomCellIndex is not already present in postLinks,
-		//add it in at the appropriate location
-		do
-		{
-
-			if (randomCellIndex < linkNode->content.postCellIndex)
-			{
-
-				postLinks.add_NewNode(Link(randomCellIndex, linksCoeffCenter), linkNode, false);
-
-				allNetCells.get_ElementAddress(randomCellIndex)->priorLinksCount++;
-				allNetCells.get_ElementAddress(randomCellIndex)->update_InputDiffusalCoeff();
-
-				return;
-
-			}
-
-			if (randomCellIndex == linkNode->content.postCellIndex)
-				break;
-
-			else //randomCellIndex > linkNode->content.postCell
-			{
-
-				linkNode = linkNode->get_NextNode();
+		//if postLinks already contains a link corresponding to randomCellIndex
+		//set randomCellIndex to the nearest postCell index value not currently
+		//in postLinks
+		if (!sub_MutatePostLinks_TestPostCellIndexAvailable(randomCellIndex))
+			sub_MutatePostLinks_FindNearestAvailablePostCellIndex(totalCellCount, randomCellIndex);
 
-				if (!linkNode)
-				{
-
-					postLinks.add_NewNode(Link(randomCellIndex, linksCoeffCenter));
+		sub_MutatePostLinks_InsertPostLink(sub_MutatePostLinks_FindPostLinkPosition(randomCellIndex),
+			Link(randomCellIndex, linksCoeffCenter));
 
-					allNetCells.get_ElementAddress(randomCellIndex)->priorLinksCount++;
-					allNetCells.get_ElementAddress(randomCellIndex)->update_InputDiffusalCoeff();
-
-					return;
-
-				}
-
-			}
-
-		} while (true);
-
-		//postLinks already contains a linkCorresponding to randomCellIndex
-		//so set randomCellIndex to the nearest postCell index value
-		//not currently in postLinks and set linkNode to the node before the
-		//desired insertion location (NULL if at the start of postLinks)
-		sub_MutatePostLinks_FindNearestAvailablePostCellIndex(totalCellCount,
-			randomCellIndex, linkNode);
-
-		if (linkNode)
-			postLinks.add_NewNode(Link(randomCellIndex, linksCoeffCenter), linkNode);
-
-		else
-			postLinks.add_NewNode(Link(randomCellIndex, linksCoeffCenter), NULL, false);
-
-		allNetCells.get_ElementAddress(randomCellIndex)->priorLinksCount++;
-		allNetCells.get_ElementAddress(randomCellIndex)->update_InputDiffusalCoeff();
+		sub_MutatePostLinks_AdjustPriorLinksCount(allNetCells, randomCellIndex, true);
 
 	}
 
 	//removes a random postLinks member;
-	//assumes postLinksLength > 1, assumes rand() is seeded
+	//assumes postLinksLength > 1, assumes the random generator is seeded
 	inline void sub_MutatePostLinks_RemoveRandomPostLink(
-		ExtensibleArray<Cell> &allNetCells, const unsigned short postLinksLength)
+		ExtensibleArray<Cell*> &allNetCells, const unsigned short postLinksLength)
 	{
 
-		UniformNode<Link> *randomLinkNode = postLinks.get_NodeAddress(rand() % postLinksLength);
+		const unsigned short randomPosition(get_RandomInt() % postLinksLength);
+
+		sub_MutatePostLinks_AdjustPriorLinksCount(allNetCells,
+			postLinks.get_ElementAddress(randomPosition)->postCellIndex, false);
 
-		allNetCells.get_ElementAddress(randomLinkNode->content.postCellIndex)->priorLinksCount--;
-		allNetCells.get_ElementAddress(randomLinkNode->content.postCellIndex)->update_InputDiffusalCoeff();
-		postLinks.delete_Node(randomLinkNode);
+		sub_MutatePostLinks_DeletePostLink(randomPosition);
 
 	}
 
 	//replaces the postCell value of an existing link with a new,
 	//available value and relocates the link in list order
-	//assumes postLinksLength > 0 and < totalCellCount -1; rand() is seeded
+	//assumes postLinksLength > 0 and < totalCellCount -1; the random generator is seeded
 	inline void sub_MutatePostLinks_ReplaceRandomPostLink(const unsigned short totalCellCount,
-		ExtensibleArray<Cell> &allNetCells, const unsigned short postLinksLength)
+		ExtensibleArray<Cell*> &allNetCells, const unsigned short postLinksLength)
 	{
 
 		//initial setup
 		unsigned short randomIndex;
-		UniformNode<Link> *linkNode(postLinks.get_FirstNode());
-		UniformNode<Link> *nodeToReplace(postLinks.get_NodeAddress(
-			rand() % postLinksLength));
-		unsigned short currentIndex(linkNode->content.postCellIndex);
+		const unsigned short positionToReplace(get_RandomInt() % postLinksLength);
 
 		//select a random cell index to add
 		do
 		{
 
-			randomIndex = rand() % totalCellCount;
+			randomIndex = get_RandomInt() % totalCellCount;
 
 		} while (randomIndex == thisCellIndex);
 
-		//main loop
-		do
-		{
-
-			//randomCellIndex is not already represented in postLinks;
-			//change nodeToReplace postCellIndex to randomIndex and
-			//relocate it to correct position in list order (if not already there)
-			if (randomIndex < currentIndex)
-			{
-
-				allNetCells.get_ElementAddress(nodeToReplace->content.postCellIndex)->priorLinksCount--;
-				allNetCells.get_ElementAddress(nodeToReplace->content.postCellIndex)->update_InputDiffusalCoeff();
-
-				nodeToReplace->content.postCellIndex = randomIndex;
-
-				allNetCells.get_ElementAddress(randomIndex)->priorLinksCount++;
-				allNetCells.get_ElementAddress(randomIndex)->update_InputDiffusalCoeff();
-
-				//move nodeToReplace into correct position if not already there
-				if (nodeToReplace != linkNode && nodeToReplace != linkNode->get_PriorNode())
-					postLinks.move_Node(nodeToReplace, linkNode, false);
-
-				return;
-
-			}
-
-			//postLinks already contains a link corresponding to randomIndex
-			else if (randomIndex == currentIndex)
-				break;
-
-			//randomIndex > linkNode->content.postCell, iterate to next link
-			else
-			{
-
-				linkNode = linkNode->get_NextNode();
-
-				//randomIndex is not already represented in postLinks;
-				//change nodeToReplace postCellIndex to randomIndex and
-				//relocate it to last position in list order (if not already there)
-				if (!linkNode)
-				{
-
-					allNetCells.get_ElementAddress(nodeToReplace->content.postCellIndex)->priorLinksCount--;
-					allNetCells.get_ElementAddress(nodeToReplace->content.postCellIndex)->update_InputDiffusalCoeff();
-
-					nodeToReplace->content.postCellIndex = randomIndex;
+		//if postLinks already contains a link corresponding to randomIndex
+		//set randomIndex to the nearest postCell index value not currently
+		//in postLinks
+		if (!sub_MutatePostLinks_TestPostCellIndexAvailable(randomIndex))
+			sub_MutatePostLinks_FindNearestAvailablePostCellIndex(totalCellCount, randomIndex);
 
-					allNetCells.get_ElementAddress(randomIndex)->priorLinksCount++;
-					allNetCells.get_ElementAddress(randomIndex)->update_InputDiffusalCoeff();
+		sub_MutatePostLinks_AdjustPriorLinksCount(allNetCells,
+			postLinks.get_ElementAddress(positionToReplace)->postCellIndex, false);
 
-					//move nodeToReplace into correct position if not already there
-					if (nodeToReplace != postLinks.get_LastNode())
-						postLinks.move_Node(nodeToReplace);
+		sub_MutatePostLinks_AdjustPriorLinksCount(allNetCells, randomIndex, true);
 
-					return;
+		sub_MutatePostLinks_RelocatePostLink(positionToReplace, randomIndex);
 
-				}
-
-				else
-					currentIndex = linkNode->content.postCellIndex;
-
-			}
-
-		} while (true);
-
-		//set randomCellIndex to the nearest postCell index value
-		//not currently in postLinks and set linkNode to the node before the
-		//desired insertion location (NULL if at the start of postLinks)
-		sub_MutatePostLinks_FindNearestAvailablePostCellIndex(totalCellCount, randomIndex, linkNode);
-
-		allNetCells.get_ElementAddress(nodeToReplace->content.postCellIndex)->priorLinksCount--;
-		allNetCells.get_ElementAddress(nodeToReplace->content.postCellIndex)->update_InputDiffusalCoeff();
-
-		nodeToReplace->content.postCellIndex = randomIndex;
-
-		allNetCells.get_ElementAddress(randomIndex)->priorLinksCount++;
-		allNetCells.get_ElementAddress(randomIndex)->update_InputDiffusalCoeff();
+	}
 
-		if (linkNode)
-		{
+	//increments (increment == true) or decrements the priorLinksCount of the cell at
+	//cellIndex in allNetCells, first giving this net a private copy of that cell if it is shared
+	inline static void sub_MutatePostLinks_AdjustPriorLinksCount(ExtensibleArray<Cell*> &allNetCells,
+		const unsigned short cellIndex, const bool increment)
+	{
 
-			if (nodeToReplace != linkNode && nodeToReplace != linkNode->get_NextNode())
-				postLinks.move_Node(nodeToReplace, linkNode);
+		Cell *postCell(get_WritableCell(allNetCells, cellIndex));
 
-		}
+		if (increment)
+			postCell->priorLinksCount++;
 
 		else
-		{
-
-			if (nodeToReplace != postLinks.get_FirstNode())
-				postLinks.move_Node(nodeToReplace, NULL, false);
+			postCell->priorLinksCount--;
 
-		}
+		postCell->update_InputDiffusalCoeff();
 
 	}
 
@@ -602,14 +492,14 @@ public:
 		linksCoeffCenter(1.0), internalSpread(1.0), broadcastSpread(1.0),
 		linksCoeffSpread(1.0), decayRateSpread(1.0), refractoryPeriodSpread(2),
 		broadcastSwitchSignFreq(0.01), linksSwitchSignFreq(0.01), internalCoeff(1.0),
-		broadcastCoeff(1.0), decayRate(0.5), refractoryPeriod(2), inputDiffusalCoeff(1.0)
+		broadcastCoeff(1.0), decayRate(0.5), refractoryPeriod(2), postLinks(1), inputDiffusalCoeff(1.0), shareCount(1)
 	{
 		
 		if (thisCellIndex < (totalCellCount - 1))
-			postLinks.add_NewNode(Link((thisCellIndex + 1), 1.0));
+			*(postLinks.get_ElementAddress(0)) = Link((thisCellIndex + 1), 1.0);
 
 		else
-			postLinks.add_NewNode(Link(0, 1.0));
+			*(postLinks.get_ElementAddress(0)) = Link(0, 1.0);
 
 		if (thisCellIndex < inputCellCount)
 			priorLinksCount = 2;
@@ -635,23 +525,78 @@ public:
 		broadcastSpread(aBroadcastSpread), linksCoeffSpread(aLinksCoeffSpread), decayRateSpread(aDecayRateSpread),
 		refractoryPeriodSpread(aRefractoryPeriodSpread), broadcastSwitchSignFreq(aBroadcastSwitchSignFreq),
 		linksSwitchSignFreq(aLinksSwitchSignFreq), internalCoeff(aInternalCoeff), broadcastCoeff(aBroadcastCoeff),
-		decayRate(aDecayRate), refractoryPeriod(aRefractoryPeriod)
+		decayRate(aDecayRate), refractoryPeriod(aRefractoryPeriod), postLinks(tempPostLinksList), shareCount(1)
 	{
 
-		postLinks.add_CutWholeList(tempPostLinksList);
+		tempPostLinksList.delete_WholeList();
 
 	}
 
 	//default destructor
 	~Cell() {}
 
+	//***sharing methods***
+
+	//cells are shared between parent and child nets rather than copied during
+	//reproduction; a net holds a pointer to each of its cells and only
+	//receives a private copy of a cell when it is about to modify it; stimulus
+	//tracking properties are reset at the start of every data frame, so nets
+	//which share a cell may use it in turn during (serial) stimulation; shared
+	//cells are not immutable blocks, since they still hold that per-frame
+	//stimulus state, so nets sharing a cell must never be stimulated concurrently
+
+	//registers one more net referring to sharedCell; returns sharedCell
+	static Cell *share(Cell *sharedCell)
+	{
+
+		sharedCell->shareCount++;
+		return sharedCell;
+
+	}
+
+	//unregisters one net referring to sharedCell, deleting it
+	//when no net refers to it any longer
+	static void release(Cell *sharedCell)
+	{
+
+		if (sharedCell->shareCount > 1)
+			sharedCell->shareCount--;
+
+		else
+			delete sharedCell;
+
+	}
+
+	//returns a cell at cellIndex in allNetCells which is safe to modify; if that
+	//cell is shared with other nets it is first replaced by a private copy
+	static Cell *get_WritableCell(ExtensibleArray<Cell*> &allNetCells, const unsigned short cellIndex)
+	{
+
+		Cell *cell(allNetCells.get_Element(cellIndex));
+
+		if (cell->shareCount > 1)
+		{
+
+			cell->shareCount--;
+
+			cell = new Cell(*cell);
+			cell->shareCount = 1;
+
+			*(allNetCells.get_ElementAddress(cellIndex)) = cell;
+
+		}
+
+		return cell;
+
+	}
+
 	//mutation functions
 
 	//modifies internalCoeff (ensures it will remain >= 0.0)
 	void mutate_InternalCoeff(const double mutationAmplitude)
 	{
 
-		double tempDouble = ((static_cast<double>(rand() % 10000) / 10000.0) - 0.5)
+		double tempDouble = ((static_cast<double>(get_RandomInt() % 10000) / 10000.0) - 0.5)
 			* internalSpread * mutationAmplitude;
 
 		if (internalCoeff + tempDouble >= 0.0)
@@ -663,11 +608,11 @@ public:
 	}
 
 	//modifies broadcastCoeff (resulting value is any double)
-	//assumes rand() is seeded
+	//assumes the random generator is seeded
 	void mutate_BroadcastCoeff(const double mutationAmplitude)
 	{
 
-		double tempDouble = (static_cast<double>(rand() % 10000) / 10000.0);
+		double tempDouble = (static_cast<double>(get_RandomInt() % 10000) / 10000.0);
 
 		if (tempDouble < broadcastSwitchSignFreq)
 			broadcastCoeff = (-1) * (broadcastCoeff + ((tempDouble - 0.5)
@@ -682,20 +627,22 @@ public:
 	//randomly either adds, deletes, or replaces a postLink member;
 	//ensures that postLinks remains populated with at least 1 member and
 	//never contains more than totalCellCount - 1 members
-	//assumes rand() has been seeded; totalCellCount >= 3
+	//assumes the random generator has been seeded; totalCellCount >= 3
 	//assumes thisCellIndex is this Cell's array index in net context
 	//assumes mutationType is 0 (add), 1 (replace), or 2 (remove)
-	void mutate_PostLinks(const unsigned short totalCellCount, ExtensibleArray<Cell> &allNetCells,
+	void mutate_PostLinks(const unsigned short totalCellCount, ExtensibleArray<Cell*> &allNetCells,
 		const unsigned short mutationType)
 	{
 
-		unsigned short postLinksLength = postLinks.get_ListLength();
+		unsigned short postLinksLength = postLinks.get_ArrayLength();
+
+		sub_MutatePostLinks_PrepareOccupancy(totalCellCount);
 
 		//postLinks is at min length, add or replace link
 		if (postLinksLength == 1)
 		{
 
-			if(rand() % 2)
+			if(get_RandomInt() % 2)
 				sub_MutatePostLinks_AddRandomPostLink(totalCellCount,
 					allNetCells);
 
@@ -729,31 +676,31 @@ public:
 	}
 
 	//modifies a random linkCoeff (resulting value is any double)
-	//assumes that postLinks is populated; assumes rand() has been seeded;
+	//assumes that postLinks is populated; assumes the random generator has been seeded;
 	void mutate_RandomLinkCoeff(const double mutationAmplitude)
 	{
 
-		UniformNode<Link> *randomLinkNode = postLinks.get_NodeAddress(rand()
-			% postLinks.get_ListLength());
+		Link *randomLink = postLinks.get_ElementAddress(get_RandomInt()
+			% postLinks.get_ArrayLength());
 
-		double tempDouble = (static_cast<double>(rand() % 10000) / 10000.0);
+		double tempDouble = (static_cast<double>(get_RandomInt() % 10000) / 10000.0);
 
 		if (tempDouble < linksSwitchSignFreq)
-			randomLinkNode->content.linkCoeff = (-1) * (randomLinkNode->content.linkCoeff + ((tempDouble - 0.5)
+			randomLink->linkCoeff = (-1) * (randomLink->linkCoeff + ((tempDouble - 0.5)
 				* linksCoeffSpread * mutationAmplitude));
 
 		else
-			randomLinkNode->content.linkCoeff += ((tempDouble - 0.5) * broadcastSpread
+			randomLink->linkCoeff += ((tempDouble - 0.5) * broadcastSpread
 				* mutationAmplitude);
 
 	}
 
 	//modifies a decayRate ensuring it remains >= 0.0 and <= 1.0
-	// assumes rand() has been seeded
+	// assumes the random generator has been seeded
 	void mutate_DecayRate(const double mutationAmplitude)
 	{
 
-		decayRate += ((static_cast<double>(rand() % 10000) / 10000.0) - 0.5)
+		decayRate += ((static_cast<double>(get_RandomInt() % 10000) / 10000.0) - 0.5)
 			* 0.1 * decayRateSpread * mutationAmplitude;
 
 		if (decayRate >= 0.0)
@@ -772,17 +719,26 @@ public:
 
 	}
 
-	//modifies a refractoryPeriod ensuring it is >= 1; assumes rand() has been seeded;
+	//modifies a refractoryPeriod ensuring it is >= 1; mutationAmplitude is clamped to the
+	//range of unsigned char (0 - 255) for the step; assumes the random generator has been seeded;
 	void mutate_RefractoryPeriod(const double mutationAmplitude)
 	{
 
-		if (rand() % 2)
-			refractoryPeriod += static_cast<unsigned char>((rand() % refractoryPeriodSpread)
-			* static_cast<unsigned char>(mutationAmplitude) + 1);
+		unsigned char amplitudeStep(255);
+
+		if (mutationAmplitude <= 0.0)
+			amplitudeStep = 0;
+
+		else if (mutationAmplitude < 255.0)
+			amplitudeStep = static_cast<unsigned char>(mutationAmplitude);
+
+		if (get_RandomInt() % 2)
+			refractoryPeriod += static_cast<unsigned char>((get_RandomInt() % refractoryPeriodSpread)
+			* amplitudeStep + 1);
 
 		else
-			refractoryPeriod -= static_cast<unsigned char>((rand() % refractoryPeriodSpread)
-			* static_cast<unsigned char>(mutationAmplitude) + 1);
+			refractoryPeriod -= static_cast<unsigned char>((get_RandomInt() % refractoryPeriodSpread)
+			* amplitudeStep + 1);
 
 		if (refractoryPeriod > 0)
 			return;
@@ -814,7 +770,7 @@ public:
 	unsigned short get_PostLinksLength() const
 	{
 
-		return postLinks.get_ListLength();
+		return postLinks.get_ArrayLength();
 
 	}
 
@@ -879,6 +835,15 @@ public:
 
 	}
 
+	//returns true if this cell received stimulus or was activated since the
+	//last reset(); a cell which was not touched had no effect on the frame
+	bool test_Touched() const
+	{
+
+		return (lastRoundStimulusChanged || roundRefractionComplete);
+
+	}
+
 	//calculates the value of this tracker's stimulus (without any actual modification)
 	//accounting for any stimulus decay based on decayRate and the number of stimulus
 	//rounds passed since lastRoundStimulusChanged (if any); assumes decayRate
@@ -937,19 +902,20 @@ public:
 	//passes modified stimulus from this activated preCell to all it's postCells;
 	//assumes this cell is activated, being contained in the most recent activation
 	//round list
-	void addStimulus_LaterRounds(ExtensibleArray<Cell> &allNetCells, const unsigned short currentStimulusRound)
+	void addStimulus_LaterRounds(ExtensibleArray<Cell*> &allNetCells, const unsigned short currentStimulusRound)
 	{
 
 		//initial setup
-		UniformNode<Link> *postLinkNode(postLinks.get_FirstNode());
+		Link *postLink(postLinks.get_ElementAddress(0));
+		Link *const postLinksEnd(postLink + postLinks.get_ArrayLength());
 		unsigned short postCellIndex;
 		Cell *postCell;
 
 		do
 		{
 
-			postCellIndex = postLinkNode->content.get_PostCellIndex();
-			postCell = allNetCells.get_ElementAddress(postCellIndex);
+			postCellIndex = postLink->get_PostCellIndex();
+			postCell = allNetCells.get_Element(postCellIndex);
 
 			//the post cell has (a) never been activated, (b) is currently
 			//in its refractory period, or (c) has passed a refractory period
@@ -966,7 +932,7 @@ public:
 					//the inputDiffusalCoeff of the post cell and
 					//the linkCoeff of the associated postlink node
 					postCell->stimulus += broadcastCoeff * postCell->inputDiffusalCoeff
-						* postLinkNode->content.get_LinkCoeff();
+						* postLink->get_LinkCoeff();
 
 					//set the tracker's lastRoundStimulusChanged to the current round
 					postCell->lastRoundStimulusChanged = currentStimulusRound;
@@ -996,7 +962,7 @@ public:
 					//the inputDiffusalCoeff of the post cell and
 					//the linkCoeff of the associated postlink node
 					postCell->stimulus += broadcastCoeff * postCell->inputDiffusalCoeff
-						* postLinkNode->content.get_LinkCoeff();
+						* postLink->get_LinkCoeff();
 
 				}
 
@@ -1009,7 +975,7 @@ public:
 					//the inputDiffusalCoeff of the post cell and
 					//the linkCoeff of the associated postlink node
 					postCell->stimulus += broadcastCoeff * postCell->inputDiffusalCoeff
-						* postLinkNode->content.get_LinkCoeff();
+						* postLink->get_LinkCoeff();
 
 					//set postCell's lastRoundStimulusChanged to the current round
 					postCell->lastRoundStimulusChanged = currentStimulusRound;
@@ -1018,9 +984,9 @@ public:
 
 			}
 
-			postLinkNode = postLinkNode->get_NextNode();
+			postLink++;
 
-		} while (postLinkNode);
+		} while (postLink != postLinksEnd);
 
 	}
 
@@ -1054,21 +1020,22 @@ public:
 	//the element index of nextRoundActivationList which has not been
 	//(re)initialized as of yet in the current stimulus round
 	void populateNextActivationList_FromPostCells(
-		ExtensibleArray<Cell> &allNetCells, const unsigned short currentStimulusRound,
+		ExtensibleArray<Cell*> &allNetCells, const unsigned short currentStimulusRound,
 		ExtensibleArray<int> *nextRoundActivationList, unsigned short &activationListPositionIndex)
 	{
 
 		//initial setup
-		UniformNode<Link> *postLinkNode(postLinks.get_FirstNode());
+		Link *postLink(postLinks.get_ElementAddress(0));
+		Link *const postLinksEnd(postLink + postLinks.get_ArrayLength());
 		unsigned short postCellIndex;
 
 		//loop to iterate through each post cell and test activation
 		do
 		{
 
-			postCellIndex = postLinkNode->content.get_PostCellIndex();
+			postCellIndex = postLink->get_PostCellIndex();
 
-			if (allNetCells.get_ElementAddress(postCellIndex)->testActivation_LaterRounds(currentStimulusRound))
+			if (allNetCells.get_Element(postCellIndex)->testActivation_LaterRounds(currentStimulusRound))
 			{
 
 				//add the postCell index to nextRoundActivationList and iterate nextRoundAvailableIndex
@@ -1080,9 +1047,9 @@ public:
 
 			}
 
-			postLinkNode = postLinkNode->get_NextNode();
+			postLink++;
 
-		} while (postLinkNode);
+		} while (postLink != postLinksEnd);
 
 	}
 
@@ -1092,8 +1059,8 @@ public:
 	void output_ToOpenFile_XML(ofstream &outputFile)
 	{
 
-		unsigned short count(0);
-		UniformNode<Link> *linkNode(postLinks.get_FirstNode());
+		unsigned short count;
+		const unsigned short postLinksLength(postLinks.get_ArrayLength());
 
 		//tracking variables
 
@@ -1113,17 +1080,14 @@ public:
 
 		//postLinks
 		outputFile << "\n\t\t\t\t\t<postLinks>";
-		do
+		for (count = 0; count < postLinksLength; count++)
 		{
 
 			outputFile << "\n\t\t\t\t\t\t<pl_" << count << ">";
-			linkNode->content.output_ToOpenFile_XML(outputFile);
+			postLinks.get_ElementAddress(count)->output_ToOpenFile_XML(outputFile);
 			outputFile << "\n\t\t\t\t\t\t</pl_" << count << ">";
 
-			count++;
-			linkNode = linkNode->get_NextNode();
-
-		} while (linkNode);
+		}
 		outputFile << "\n\t\t\t\t\t</postLinks>";
 
 	}
@@ -1132,9 +1096,8 @@ public:
 	void output_ToOpenFile_JSON(ofstream &outputFile)
 	{
 
-		unsigned short count(0);
-		UniformNode<Link> *linkNode(postLinks.get_FirstNode());
-		UniformNode<Link> *lastNode(postLinks.get_LastNode());
+		unsigned short count;
+		const unsigned short lastPosition(postLinks.get_ArrayLength() - 1);
 
 		//tracking variables
 
@@ -1154,23 +1117,192 @@ public:
 
 		//postLinks
 		outputFile << "\"postLinks\":[";
-		while (linkNode != lastNode)
+		for (count = 0; count < lastPosition; count++)
 		{
 
 			outputFile << "{";
-			linkNode->content.output_ToOpenFile_JSON(outputFile);
+			postLinks.get_ElementAddress(count)->output_ToOpenFile_JSON(outputFile);
 			outputFile << "},";
 
-			count++;
-			linkNode = linkNode->get_NextNode();
-
 		}
 		outputFile << "{";
-		linkNode->content.output_ToOpenFile_JSON(outputFile);
+		postLinks.get_ElementAddress(count)->output_ToOpenFile_JSON(outputFile);
 		outputFile << "}]";
 
 	}
 
+	//appends every property other than the tracking and sharing properties to
+	//genome (see Genome) so that decode_FromGenome() restores the cell; the fixed
+	//mutation control properties are replaced by a flag when they equal those of
+	//previousCell (cells made from the same cell control share them), postLinks
+	//indices are stored as gaps from the previous index and inputDiffusalCoeff is
+	//recomputed on decoding; if quantized, coefficients are rounded to single
+	//precision, otherwise the cell is restored exactly
+	void encode_ToGenome(Genome &genome, const Cell *previousCell, const bool quantized) const
+	{
+
+		const unsigned short postLinksLength(postLinks.get_ArrayLength());
+		const bool repeatedControl(previousCell && linksCoeffCenter == previousCell->linksCoeffCenter
+			&& internalSpread == previousCell->internalSpread && broadcastSpread == previousCell->broadcastSpread
+			&& linksCoeffSpread == previousCell->linksCoeffSpread && decayRateSpread == previousCell->decayRateSpread
+			&& refractoryPeriodSpread == previousCell->refractoryPeriodSpread
+			&& broadcastSwitchSignFreq == previousCell->broadcastSwitchSignFreq
+			&& linksSwitchSignFreq == previousCell->linksSwitchSignFreq);
+		unsigned short previousPostCellIndex(0);
+		const Link *postLink;
+
+		genome.append_Varint(repeatedControl);
+
+		if (!repeatedControl)
+		{
+
+			genome.append_Real(linksCoeffCenter, quantized);
+			genome.append_Real(internalSpread, quantized);
+			genome.append_Real(broadcastSpread, quantized);
+			genome.append_Real(linksCoeffSpread, quantized);
+			genome.append_Real(decayRateSpread, quantized);
+			genome.append_Varint(refractoryPeriodSpread);
+			genome.append_Real(broadcastSwitchSignFreq, quantized);
+			genome.append_Real(linksSwitchSignFreq, quantized);
+
+		}
+
+		genome.append_Real(internalCoeff, quantized);
+		genome.append_Real(broadcastCoeff, quantized);
+		genome.append_Real(decayRate, quantized);
+		genome.append_Varint(refractoryPeriod);
+		genome.append_Varint(priorLinksCount);
+
+		genome.append_Varint(postLinksLength);
+
+		for (unsigned short count = 0; count < postLinksLength; count++)
+		{
+
+			postLink = postLinks.get_ElementAddress(count);
+
+			//the first index is stored whole, later (strictly ascending) ones as the gap - 1
+			if (count)
+				genome.append_Varint(postLink->postCellIndex - previousPostCellIndex - 1);
+
+			else
+				genome.append_Varint(postLink->postCellIndex);
+
+			genome.append_Real(postLink->linkCoeff, quantized);
+			previousPostCellIndex = postLink->postCellIndex;
+
+		}
+
+	}
+
+	//reads a cell appended by encode_ToGenome() (with the same previousCell and
+	//quantized values) from genome into this cell at index aThisCellIndex; returns
+	//false if the read fails or the cell does not fit a net of totalCellCount cells
+	//(properties must be in their documented ranges and postLinks must be populated,
+	//within range and not refer to this cell); assumes this cell is not shared
+	bool decode_FromGenome(Genome &genome, const Cell *previousCell, const bool quantized,
+		const unsigned short aThisCellIndex, const unsigned short totalCellCount)
+	{
+
+		unsigned long long repeatedControl;
+		unsigned long long value;
+		unsigned long long postCellIndex(0);
+		unsigned short postLinksLength;
+		unsigned short count;
+		Link *postLink;
+
+		thisCellIndex = aThisCellIndex;
+
+		if (!genome.read_Varint(repeatedControl, 1) || (repeatedControl && !previousCell))
+			return false;
+
+		if (repeatedControl)
+		{
+
+			linksCoeffCenter = previousCell->linksCoeffCenter;
+			internalSpread = previousCell->internalSpread;
+			broadcastSpread = previousCell->broadcastSpread;
+			linksCoeffSpread = previousCell->linksCoeffSpread;
+			decayRateSpread = previousCell->decayRateSpread;
+			refractoryPeriodSpread = previousCell->refractoryPeriodSpread;
+			broadcastSwitchSignFreq = previousCell->broadcastSwitchSignFreq;
+			linksSwitchSignFreq = previousCell->linksSwitchSignFreq;
+
+		}
+
+		else
+		{
+
+			if (!genome.read_Real(linksCoeffCenter, quantized) || !genome.read_Real(internalSpread, quantized)
+				|| !genome.read_Real(broadcastSpread, quantized) || !genome.read_Real(linksCoeffSpread, quantized)
+				|| !genome.read_Real(decayRateSpread, quantized) || !genome.read_Varint(value, 255)
+				|| !genome.read_Real(broadcastSwitchSignFreq, quantized)
+				|| !genome.read_Real(linksSwitchSignFreq, quantized))
+				return false;
+
+			refractoryPeriodSpread = static_cast<unsigned char>(value);
+
+			if (!(linksCoeffCenter > 0.0) || !(internalSpread > 0.0) || !(broadcastSpread > 0.0)
+				|| !(linksCoeffSpread > 0.0) || !(decayRateSpread > 0.0) || !refractoryPeriodSpread
+				|| !(broadcastSwitchSignFreq >= 0.0 && broadcastSwitchSignFreq <= 1.0)
+				|| !(linksSwitchSignFreq >= 0.0 && linksSwitchSignFreq <= 1.0))
+				return false;
+
+		}
+
+		if (!genome.read_Real(internalCoeff, quantized) || !genome.read_Real(broadcastCoeff, quantized)
+			|| !genome.read_Real(decayRate, quantized) || !genome.read_Varint(value, 255)
+			|| !value)
+			return false;
+
+		refractoryPeriod = static_cast<unsigned char>(value);
+
+		if (!(internalCoeff >= 0.0) || broadcastCoeff != broadcastCoeff
+			|| !(decayRate >= 0.0 && decayRate <= 1.0))
+			return false;
+
+		if (!genome.read_Varint(value, 65535))
+			return false;
+
+		priorLinksCount = static_cast<unsigned short>(value);
+		update_InputDiffusalCoeff();
+
+		if (!genome.read_Varint(value, totalCellCount - 1) || !value)
+			return false;
+
+		postLinksLength = static_cast<unsigned short>(value);
+
+		if (postLinksLength != postLinks.get_ArrayLength())
+			postLinks.resize_NoCopy(postLinksLength);
+
+		for (count = 0; count < postLinksLength; count++)
+		{
+
+			postLink = postLinks.get_ElementAddress(count);
+
+			if (!genome.read_Varint(value, totalCellCount))
+				return false;
+
+			if (count)
+				postCellIndex += value + 1;
+
+			else
+				postCellIndex = value;
+
+			if (postCellIndex >= totalCellCount || postCellIndex == thisCellIndex
+				|| !genome.read_Real(postLink->linkCoeff, quantized) || postLink->linkCoeff != postLink->linkCoeff)
+				return false;
+
+			postLink->postCellIndex = static_cast<unsigned short>(postCellIndex);
+
+		}
+
+		//the occupancy bitset is rebuilt on the next structural mutation
+		postLinksOccupancy = ExtensibleArray<unsigned long long>();
+
+		return true;
+
+	}
+
 };
 
 #endif // CELL_H_INCLUDED
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define EVOLUTIONCONTROL_H_INCLUDED
 
 #include "MemoryTools.h"
+#include "StringTools.h"
 
 class EvolutionControl
 {
@@ -81,6 +82,51 @@ public:
 
 	}
 
+	//writes this control to outputFile as raw bytes; assumes outputFile is
+	//open in binary mode
+	void output_ToOpenFile_Binary(ofstream &outputFile) const
+	{
+
+		const unsigned long long length(dataSetRowIndices.get_ArrayLength());
+
+		outputValue_ToOpenFile_Binary(maxPopulationSize, outputFile);
+		outputValue_ToOpenFile_Binary(survivalThreshold, outputFile);
+		outputValue_ToOpenFile_Binary(totalRepetitions, outputFile);
+		outputValue_ToOpenFile_Binary(length, outputFile);
+
+		for (unsigned long long count = 0; count < length; count++)
+			outputValue_ToOpenFile_Binary(dataSetRowIndices.get_Element(count), outputFile);
+
+	}
+
+	//reads a control written by output_ToOpenFile_Binary(); returns false if the
+	//read fails or no data set row indices were written (the indices are validated
+	//in population context); assumes inputFile is open in binary mode
+	bool load_FromOpenFile_Binary(ifstream &inputFile)
+	{
+
+		unsigned long long length;
+
+		if (!inputValue_FromOpenFile_Binary(maxPopulationSize, inputFile)
+			|| !inputValue_FromOpenFile_Binary(survivalThreshold, inputFile)
+			|| !inputValue_FromOpenFile_Binary(totalRepetitions, inputFile)
+			|| !inputValue_FromOpenFile_Binary(length, inputFile) || !length)
+			return false;
+
+		dataSetRowIndices.resize_NoCopy(length);
+
+		for (unsigned long long count = 0; count < length; count++)
+		{
+
+			if (!inputValue_FromOpenFile_Binary(*(dataSetRowIndices.get_ElementAddress(count)), inputFile))
+				return false;
+
+		}
+
+		return true;
+
+	}
+
 };
 
 #endif // EVOLUTIONCONTROL_H_INCLUDED
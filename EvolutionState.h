@@ -0,0 +1,216 @@
+#ifndef EVOLUTIONSTATE_H_INCLUDED
+#define EVOLUTIONSTATE_H_INCLUDED
+
+#include <cfloat>
+#include "StringTools.h"
+#include "MutationControl.h"
+
+//holds everything an evolution run carries from one cycle to the next (other
+//than the nets themselves) so that Population can checkpoint a run and resume
+//it exactly; its members are used directly by Population::sub_Evolve()
+class EvolutionState
+{
+
+	friend class Population;
+
+private:
+
+	//evolution parameters
+	unsigned short maxSpliceLength; //0 means asexual reproduction, otherwise the maximum splice length in sexual reproduction
+	bool adaptiveMutation; //if true, mutationControl is adapted each cycle
+	MutationControl mutationControl; //mutations per net and mutation amplitude of the current cycle
+
+	//evolution schedule position
+	unsigned int cycleCount; //number of cycles completed
+	unsigned long long evolutionControlIndex; //index of the evolution control used by the next cycle
+	unsigned short repetitionCount; //number of cycles the current evolution control has been used for
+	unsigned short survivorCount; //number of nets which survived the last cycle
+
+	//children of the last cycle (used in mutation adaptation and screening)
+	ExtensibleArray<unsigned short> childSlotIndices; //slot indices of the children, array of size totalNetCount
+	ExtensibleArray<double> parentFitnessRatings; //fitnessRating of each child's (better) parent, array of size totalNetCount
+	unsigned short childCount; //number of children in childSlotIndices
+	unsigned long long childEvolutionControlIndex; //index of the evolution control the children's parents were evaluated with
+
+	//stop condition tracking
+	double priorElapsedSeconds; //wall clock seconds the run used before it was last (re)started
+	unsigned long long netRowEvaluations; //single net, single data set row evaluations made so far
+	double bestFitnessRating; //best fitnessRating of any cycle so far
+	unsigned int stagnantCycleCount; //cycles since bestFitnessRating last improved
+	unsigned short restartCount; //number of stagnation restarts so far
+
+	//screening tracking
+	unsigned long long screenedOutChildTotal; //number of children predicted uncompetitive so far (including audited children)
+	ExtensibleArray<unsigned long long> probeFitnessKeys; //content hash (see Net::get_ContentHash()) of the net in each slot when its probe fitnessRating was found, 0 if none, array of size totalNetCount
+	ExtensibleArray<double> probeFitnessRatings; //probe fitnessRating of the net in each slot (see Population::screen_Children()), array of size totalNetCount
+
+	//early abort tracking
+	bool negativeCriteriaValueFound; //true once an evaluation criteria expression returned a negative value in this run, which suspends early abort culling for the rest of the run (see Population::set_EarlyAbort())
+
+public:
+
+	//default constructor
+	EvolutionState() : maxSpliceLength(0), adaptiveMutation(false), cycleCount(0),
+		evolutionControlIndex(0), repetitionCount(0), survivorCount(1), childSlotIndices(2),
+		parentFitnessRatings(2), childCount(0), childEvolutionControlIndex(0), priorElapsedSeconds(0.0),
+		netRowEvaluations(0), bestFitnessRating(DBL_MAX), stagnantCycleCount(0), restartCount(0),
+		screenedOutChildTotal(0), probeFitnessKeys(2), probeFitnessRatings(2),
+		negativeCriteriaValueFound(false)
+	{
+
+		clear_ProbeFitnessRatings();
+
+	}
+
+	//modified constructor; the state at the start of a new run of a population of
+	//totalNetCount nets; assumes totalNetCount >= 2, aMutationsPerNet >= 1 and
+	//aMutationAmplitude > 0.0
+	EvolutionState(const unsigned short totalNetCount, const unsigned short aMutationsPerNet,
+		const double aMutationAmplitude, const unsigned short aMaxSpliceLength,
+		const bool aAdaptiveMutation) : maxSpliceLength(aMaxSpliceLength),
+		adaptiveMutation(aAdaptiveMutation), mutationControl(aMutationsPerNet, aMutationAmplitude),
+		cycleCount(0), evolutionControlIndex(0), repetitionCount(0), survivorCount(1),
+		childSlotIndices(totalNetCount), parentFitnessRatings(totalNetCount), childCount(0),
+		childEvolutionControlIndex(0), priorElapsedSeconds(0.0), netRowEvaluations(0),
+		bestFitnessRating(DBL_MAX), stagnantCycleCount(0), restartCount(0), screenedOutChildTotal(0),
+		probeFitnessKeys(totalNetCount), probeFitnessRatings(totalNetCount),
+		negativeCriteriaValueFound(false)
+	{
+
+		clear_ProbeFitnessRatings();
+
+	}
+
+	//destructor
+	~EvolutionState() {}
+
+	//forgets every probe fitnessRating (used when the probe rows change)
+	void clear_ProbeFitnessRatings()
+	{
+
+		for (unsigned long long count = 0; count < probeFitnessKeys.get_ArrayLength(); count++)
+		{
+
+			*(probeFitnessKeys.get_ElementAddress(count)) = 0;
+			*(probeFitnessRatings.get_ElementAddress(count)) = DBL_MAX;
+
+		}
+
+	}
+
+	//getter
+	unsigned int get_CycleCount() const
+	{
+
+		return cycleCount;
+
+	}
+
+	//writes the state to outputFile as raw bytes with elapsedSeconds (the wall clock
+	//seconds used so far) in place of priorElapsedSeconds; assumes outputFile is open
+	//in binary mode
+	void output_ToOpenFile_Binary(ofstream &outputFile, const double elapsedSeconds) const
+	{
+
+		outputValue_ToOpenFile_Binary(maxSpliceLength, outputFile);
+		outputValue_ToOpenFile_Binary(adaptiveMutation, outputFile);
+		mutationControl.output_ToOpenFile_Binary(outputFile);
+
+		outputValue_ToOpenFile_Binary(cycleCount, outputFile);
+		outputValue_ToOpenFile_Binary(evolutionControlIndex, outputFile);
+		outputValue_ToOpenFile_Binary(repetitionCount, outputFile);
+		outputValue_ToOpenFile_Binary(survivorCount, outputFile);
+
+		outputValue_ToOpenFile_Binary(childCount, outputFile);
+
+		for (unsigned short count = 0; count < childCount; count++)
+		{
+
+			outputValue_ToOpenFile_Binary(childSlotIndices.get_Element(count), outputFile);
+			outputValue_ToOpenFile_Binary(parentFitnessRatings.get_Element(count), outputFile);
+
+		}
+
+		outputValue_ToOpenFile_Binary(childEvolutionControlIndex, outputFile);
+
+		outputValue_ToOpenFile_Binary(elapsedSeconds, outputFile);
+		outputValue_ToOpenFile_Binary(netRowEvaluations, outputFile);
+		outputValue_ToOpenFile_Binary(bestFitnessRating, outputFile);
+		outputValue_ToOpenFile_Binary(stagnantCycleCount, outputFile);
+		outputValue_ToOpenFile_Binary(restartCount, outputFile);
+
+		outputValue_ToOpenFile_Binary(screenedOutChildTotal, outputFile);
+
+		for (unsigned long long count = 0; count < probeFitnessKeys.get_ArrayLength(); count++)
+		{
+
+			outputValue_ToOpenFile_Binary(probeFitnessKeys.get_Element(count), outputFile);
+			outputValue_ToOpenFile_Binary(probeFitnessRatings.get_Element(count), outputFile);
+
+		}
+
+		outputValue_ToOpenFile_Binary(negativeCriteriaValueFound, outputFile);
+
+	}
+
+	//reads a state written by output_ToOpenFile_Binary() for a population of
+	//totalNetCount nets; returns false if the read fails or the state does not fit
+	//the population (schedule positions are validated in population context);
+	//assumes inputFile is open in binary mode
+	bool load_FromOpenFile_Binary(ifstream &inputFile, const unsigned short totalNetCount)
+	{
+
+		if (!inputValue_FromOpenFile_Binary(maxSpliceLength, inputFile)
+			|| !inputValue_FromOpenFile_Binary(adaptiveMutation, inputFile)
+			|| !mutationControl.load_FromOpenFile_Binary(inputFile)
+			|| !inputValue_FromOpenFile_Binary(cycleCount, inputFile)
+			|| !inputValue_FromOpenFile_Binary(evolutionControlIndex, inputFile)
+			|| !inputValue_FromOpenFile_Binary(repetitionCount, inputFile)
+			|| !inputValue_FromOpenFile_Binary(survivorCount, inputFile)
+			|| !inputValue_FromOpenFile_Binary(childCount, inputFile))
+			return false;
+
+		if (!survivorCount || survivorCount > totalNetCount || childCount > totalNetCount)
+			return false;
+
+		childSlotIndices.resize_NoCopy(totalNetCount);
+		parentFitnessRatings.resize_NoCopy(totalNetCount);
+
+		for (unsigned short count = 0; count < childCount; count++)
+		{
+
+			if (!inputValue_FromOpenFile_Binary(*(childSlotIndices.get_ElementAddress(count)), inputFile)
+				|| !inputValue_FromOpenFile_Binary(*(parentFitnessRatings.get_ElementAddress(count)), inputFile)
+				|| childSlotIndices.get_Element(count) >= totalNetCount)
+				return false;
+
+		}
+
+		if (!inputValue_FromOpenFile_Binary(childEvolutionControlIndex, inputFile)
+			|| !inputValue_FromOpenFile_Binary(priorElapsedSeconds, inputFile)
+			|| !inputValue_FromOpenFile_Binary(netRowEvaluations, inputFile)
+			|| !inputValue_FromOpenFile_Binary(bestFitnessRating, inputFile)
+			|| !inputValue_FromOpenFile_Binary(stagnantCycleCount, inputFile)
+			|| !inputValue_FromOpenFile_Binary(restartCount, inputFile)
+			|| !inputValue_FromOpenFile_Binary(screenedOutChildTotal, inputFile))
+			return false;
+
+		probeFitnessKeys.resize_NoCopy(totalNetCount);
+		probeFitnessRatings.resize_NoCopy(totalNetCount);
+
+		for (unsigned short count = 0; count < totalNetCount; count++)
+		{
+
+			if (!inputValue_FromOpenFile_Binary(*(probeFitnessKeys.get_ElementAddress(count)), inputFile)
+				|| !inputValue_FromOpenFile_Binary(*(probeFitnessRatings.get_ElementAddress(count)), inputFile))
+				return false;
+
+		}
+
+		return inputValue_FromOpenFile_Binary(negativeCriteriaValueFound, inputFile);
+
+	}
+
+};
+
+#endif // EVOLUTIONSTATE_H_INCLUDED
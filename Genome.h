@@ -0,0 +1,336 @@
+#ifndef GENOME_H_INCLUDED
+#define GENOME_H_INCLUDED
+
+#include <cstring>
+#include "MemoryTools.h"
+
+//a compact byte encoding of a net (see Net::encode_Genome()) used to keep large
+//archives of nets, to compare and hash nets and to move nets between processes;
+//unsigned integers are stored as variable length quantities (7 bits per byte, low
+//bits first, high bit set on every byte but the last) and floating point values
+//as little endian IEEE 754 bytes, so an encoding is independent of the byte order
+//of the machine which produced it; bytes are appended to the end and read from a
+//read position which starts at the first byte
+class Genome
+{
+
+private:
+
+	ExtensibleArray<unsigned char> bytes; //storage; only the first length bytes are used
+	unsigned long long length; //number of bytes appended
+	unsigned long long readPosition; //index of the next byte read
+
+	//makes room for at least extraLength more bytes, doubling storage as needed
+	void sub_Reserve(const unsigned long long extraLength)
+	{
+
+		unsigned long long newCapacity(bytes.get_ArrayLength());
+
+		if (length + extraLength <= newCapacity)
+			return;
+
+		if (newCapacity < 16)
+			newCapacity = 16;
+
+		while (newCapacity < length + extraLength)
+			newCapacity *= 2;
+
+		bytes.resize_WithCopy(newCapacity);
+
+	}
+
+	//appends the lowest byteCount bytes of bits, lowest byte first
+	void sub_AppendBits(unsigned long long bits, const unsigned char byteCount)
+	{
+
+		sub_Reserve(byteCount);
+
+		for (unsigned char count = 0; count < byteCount; count++)
+		{
+
+			*(bytes.get_ElementAddress(length++)) = static_cast<unsigned char>(bits);
+			bits >>= 8;
+
+		}
+
+	}
+
+	//reads byteCount bytes written by sub_AppendBits() into bits; returns
+	//false (leaving the read position unchanged) if too few bytes remain
+	bool sub_ReadBits(unsigned long long &bits, const unsigned char byteCount)
+	{
+
+		if (length - readPosition < byteCount)
+			return false;
+
+		bits = 0;
+
+		for (unsigned char count = 0; count < byteCount; count++)
+			bits |= static_cast<unsigned long long>(bytes.get_Element(readPosition + count)) << (8 * count);
+
+		readPosition += byteCount;
+
+		return true;
+
+	}
+
+public:
+
+	//default constructor
+	Genome() : length(0), readPosition(0) {}
+
+	//destructor
+	~Genome() {}
+
+	//empties the genome (keeping its storage for reuse)
+	void clear()
+	{
+
+		length = 0;
+		readPosition = 0;
+
+	}
+
+	//releases storage beyond the bytes in use; used before archiving a
+	//genome since appending leaves up to half of its storage unused
+	void shrink_ToFit()
+	{
+
+		if (length && length < bytes.get_ArrayLength())
+			bytes.resize_WithCopy(length);
+
+	}
+
+	//getter
+	unsigned long long get_Length() const
+	{
+
+		return length;
+
+	}
+
+	//returns true if every byte has been read
+	bool test_ReadComplete() const
+	{
+
+		return (readPosition == length);
+
+	}
+
+	//moves the read position back to the first byte
+	void restart_Reading()
+	{
+
+		readPosition = 0;
+
+	}
+
+	//appends value as a variable length quantity (1 byte for values < 128)
+	void append_Varint(unsigned long long value)
+	{
+
+		sub_Reserve(10);
+
+		while (value >= 0x80)
+		{
+
+			*(bytes.get_ElementAddress(length++)) = static_cast<unsigned char>(value | 0x80);
+			value >>= 7;
+
+		}
+
+		*(bytes.get_ElementAddress(length++)) = static_cast<unsigned char>(value);
+
+	}
+
+	//appends value exactly in 8 bytes
+	void append_Double(const double value)
+	{
+
+		unsigned long long bits;
+
+		memcpy(&bits, &value, sizeof(bits));
+		sub_AppendBits(bits, 8);
+
+	}
+
+	//appends value rounded to single precision in 4 bytes
+	void append_Float(const double value)
+	{
+
+		const float singleValue(static_cast<float>(value));
+		unsigned int bits;
+
+		memcpy(&bits, &singleValue, sizeof(bits));
+		sub_AppendBits(bits, 4);
+
+	}
+
+	//appends value in 4 bytes (rounded) if quantized, otherwise in 8 (exactly)
+	void append_Real(const double value, const bool quantized)
+	{
+
+		if (quantized)
+			append_Float(value);
+
+		else
+			append_Double(value);
+
+	}
+
+	//reads a value written by append_Varint() which must fit in maxValue;
+	//returns false if too few bytes remain or the value is too large
+	bool read_Varint(unsigned long long &value, const unsigned long long maxValue = ~0ULL)
+	{
+
+		unsigned long long position(readPosition);
+		unsigned char shift(0);
+		unsigned char byte;
+
+		value = 0;
+
+		do
+		{
+
+			if (position == length || shift > 63)
+				return false;
+
+			byte = bytes.get_Element(position++);
+			value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+			shift += 7;
+
+		} while (byte & 0x80);
+
+		if (value > maxValue)
+			return false;
+
+		readPosition = position;
+
+		return true;
+
+	}
+
+	//reads a value written by append_Double(); returns false if too few bytes remain
+	bool read_Double(double &value)
+	{
+
+		unsigned long long bits;
+
+		if (!sub_ReadBits(bits, 8))
+			return false;
+
+		memcpy(&value, &bits, sizeof(value));
+
+		return true;
+
+	}
+
+	//reads a value written by append_Float(); returns false if too few bytes remain
+	bool read_Float(double &value)
+	{
+
+		unsigned long long bits;
+		unsigned int singleBits;
+		float singleValue;
+
+		if (!sub_ReadBits(bits, 4))
+			return false;
+
+		singleBits = static_cast<unsigned int>(bits);
+		memcpy(&singleValue, &singleBits, sizeof(singleValue));
+		value = static_cast<double>(singleValue);
+
+		return true;
+
+	}
+
+	//reads a value written by append_Real() with the same quantized setting;
+	//returns false if too few bytes remain
+	bool read_Real(double &value, const bool quantized)
+	{
+
+		if (quantized)
+			return read_Float(value);
+
+		return read_Double(value);
+
+	}
+
+	//returns the 64 bit FNV-1a hash of the bytes; equal genomes have
+	//equal hashes
+	unsigned long long get_Hash() const
+	{
+
+		unsigned long long hash(0xCBF29CE484222325ULL);
+
+		for (unsigned long long count = 0; count < length; count++)
+		{
+
+			hash ^= bytes.get_Element(count);
+			hash *= 0x100000001B3ULL;
+
+		}
+
+		return hash;
+
+	}
+
+	//returns true if otherGenome holds the same bytes
+	bool test_Equal(const Genome &otherGenome) const
+	{
+
+		if (length != otherGenome.length)
+			return false;
+
+		for (unsigned long long count = 0; count < length; count++)
+		{
+
+			if (bytes.get_Element(count) != otherGenome.bytes.get_Element(count))
+				return false;
+
+		}
+
+		return true;
+
+	}
+
+	//writes the length and bytes to outputFile; assumes outputFile is open
+	//in binary mode
+	void output_ToOpenFile_Binary(ofstream &outputFile) const
+	{
+
+		outputFile.write(reinterpret_cast<const char*>(&length), sizeof(length));
+
+		if (length)
+			outputFile.write(reinterpret_cast<const char*>(bytes.get_ElementAddress(0)), length);
+
+	}
+
+	//replaces the bytes with a genome written by output_ToOpenFile_Binary() of at
+	//most maxLength bytes; returns false if the read fails or the genome is too
+	//long; assumes inputFile is open in binary mode
+	bool load_FromOpenFile_Binary(ifstream &inputFile, const unsigned long long maxLength)
+	{
+
+		unsigned long long loadedLength;
+
+		clear();
+
+		if (!inputFile.read(reinterpret_cast<char*>(&loadedLength), sizeof(loadedLength))
+			|| loadedLength > maxLength)
+			return false;
+
+		sub_Reserve(loadedLength);
+
+		if (loadedLength && !inputFile.read(reinterpret_cast<char*>(bytes.get_ElementAddress(0)), loadedLength))
+			return false;
+
+		length = loadedLength;
+
+		return true;
+
+	}
+
+};
+
+#endif // GENOME_H_INCLUDED
@@ -521,13 +521,22 @@ public:
 
 	//getter, used in population read recording,
 	//assumes name wont be modified
-	Word &get_RowName(const unsigned short rowIndex)
+	Word &get_RowName(const unsigned long long rowIndex)
 	{
 
 		return rows.get_ElementAddress(rowIndex)->get_Name();
 
 	}
 
+	//replaces the row at rowIndex with newRow (used by windowed evolution); assumes
+	//rowIndex < the number of rows and newRow has been validated in population context
+	void replace_Row(const unsigned long long rowIndex, DataSetRow &newRow)
+	{
+
+		*(rows.get_ElementAddress(rowIndex)) = newRow;
+
+	}
+
 	//assumes that outputFile is already open
 	void output_ToOpenFile_XML(ofstream &outputFile)
 	{
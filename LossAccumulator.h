@@ -0,0 +1,287 @@
+#ifndef LOSSACCUMULATOR_H_INCLUDED
+#define LOSSACCUMULATOR_H_INCLUDED
+
+#include <cmath>
+#include "MemoryTools.h"
+#include "StringTools.h"
+#include "Genome.h"
+
+//a built-in loss between one output and one fixed input column over the data frames of
+//a data set row; the output value of each data frame is recorded into a per-row buffer
+//(see record_Output()) and the loss is computed from the buffer in one pass at the end
+//of the row (see accumulate()), where evaluation criteria expressions read it through
+//a variable named name
+class LossAccumulator
+{
+
+private:
+
+	//identifier (the name of the variable evaluation criteria expressions refer to)
+	Word name;
+
+	//loss properties
+	unsigned char lossType; //0 means sum of squared error, 1 sum of absolute error, 2 thresholded accuracy
+	unsigned short outputIndex; //index of the output compared
+	unsigned short columnIndex; //index of the fixed input column holding the target values
+	unsigned short columnSubIndex; //data frame sub index of the target data point within each data frame
+	double threshold; //outputs and targets at or above threshold are positives (thresholded accuracy only)
+
+	//functional value
+	double value; //loss of the last data set row accumulated
+
+	//per-row buffers
+	ExtensibleArray<double> outputValues; //output value after each data frame of the current data set row
+	ExtensibleArray<double> targetValues; //target values gathered into a contiguous array when the column's frames overlap
+
+	//returns the sum of squared differences of the first frameCount elements of
+	//outputs and targets; four independent partial sums let the loop vectorize
+	//without reassociating a single sum
+	static double sub_SumSquaredError(const double *outputs, const double *targets,
+		const unsigned long long frameCount)
+	{
+
+		double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double difference;
+		unsigned long long frameIndex(0);
+
+		for (; frameIndex + 4 <= frameCount; frameIndex += 4)
+		{
+
+			for (unsigned char lane = 0; lane < 4; lane++)
+			{
+
+				difference = outputs[frameIndex + lane] - targets[frameIndex + lane];
+				sums[lane] += difference * difference;
+
+			}
+
+		}
+
+		for (; frameIndex < frameCount; frameIndex++)
+		{
+
+			difference = outputs[frameIndex] - targets[frameIndex];
+			sums[0] += difference * difference;
+
+		}
+
+		return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+	}
+
+	//returns the sum of absolute differences of the first frameCount elements of
+	//outputs and targets (see sub_SumSquaredError())
+	static double sub_SumAbsoluteError(const double *outputs, const double *targets,
+		const unsigned long long frameCount)
+	{
+
+		double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+		unsigned long long frameIndex(0);
+
+		for (; frameIndex + 4 <= frameCount; frameIndex += 4)
+		{
+
+			for (unsigned char lane = 0; lane < 4; lane++)
+				sums[lane] += fabs(outputs[frameIndex + lane] - targets[frameIndex + lane]);
+
+		}
+
+		for (; frameIndex < frameCount; frameIndex++)
+			sums[0] += fabs(outputs[frameIndex] - targets[frameIndex]);
+
+		return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+	}
+
+	//returns the number of the first frameCount elements of outputs and targets
+	//which fall on the same side of aThreshold (see sub_SumSquaredError())
+	static double sub_CountHits(const double *outputs, const double *targets,
+		const unsigned long long frameCount, const double aThreshold)
+	{
+
+		double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+		unsigned long long frameIndex(0);
+
+		for (; frameIndex + 4 <= frameCount; frameIndex += 4)
+		{
+
+			for (unsigned char lane = 0; lane < 4; lane++)
+				sums[lane] += ((outputs[frameIndex + lane] >= aThreshold)
+					== (targets[frameIndex + lane] >= aThreshold)) ? 1.0 : 0.0;
+
+		}
+
+		for (; frameIndex < frameCount; frameIndex++)
+			sums[0] += ((outputs[frameIndex] >= aThreshold) == (targets[frameIndex] >= aThreshold)) ? 1.0 : 0.0;
+
+		return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+	}
+
+public:
+
+	//default constructor; generally safe null state
+	LossAccumulator() : name("unidentified_loss"), lossType(0), outputIndex(0), columnIndex(0),
+		columnSubIndex(0), threshold(0.0), value(0.0) {}
+
+	//modified constructor, assumes aName is populated, aLossType <= 2, and the indices
+	//are valid for the population
+	LossAccumulator(Word &aName, const unsigned char aLossType, const unsigned short aOutputIndex,
+		const unsigned short aColumnIndex, const unsigned short aColumnSubIndex, const double aThreshold)
+		: name(aName), lossType(aLossType), outputIndex(aOutputIndex), columnIndex(aColumnIndex),
+		columnSubIndex(aColumnSubIndex), threshold(aThreshold), value(0.0) {}
+
+	//default destructor
+	~LossAccumulator() {}
+
+	//sizes the per-row buffers for data set rows of totalDataFrameCount data frames;
+	//assumes totalDataFrameCount >= 1
+	void set_FrameCount(const unsigned long long totalDataFrameCount)
+	{
+
+		outputValues.resize_NoCopy(totalDataFrameCount);
+		targetValues.resize_NoCopy(totalDataFrameCount);
+
+	}
+
+	//getter, used in population initialization,
+	//assumes name wont be modified
+	Word &get_Name()
+	{
+
+		return name;
+
+	}
+
+	//getter, used in population initialization
+	double *get_ValueAddress()
+	{
+
+		return &value;
+
+	}
+
+	//getter
+	double get_Value() const
+	{
+
+		return value;
+
+	}
+
+	//getter
+	unsigned short get_OutputIndex() const
+	{
+
+		return outputIndex;
+
+	}
+
+	//getter
+	unsigned short get_ColumnIndex() const
+	{
+
+		return columnIndex;
+
+	}
+
+	//getter
+	unsigned short get_ColumnSubIndex() const
+	{
+
+		return columnSubIndex;
+
+	}
+
+	//records outputValue as the output value after data frame dataFrameIndex;
+	//assumes dataFrameIndex is less than the frame count set
+	void record_Output(const unsigned long long dataFrameIndex, const double outputValue)
+	{
+
+		*(outputValues.get_ElementAddress(dataFrameIndex)) = outputValue;
+
+	}
+
+	//sets value to the loss of the first frameCount recorded output values against the
+	//target data points firstTarget, firstTarget + targetStride, ... (the target data
+	//point of each data frame); thresholded accuracy is the fraction of data frames hit;
+	//assumes frameCount >= 1 and is no more than the frame count set
+	void accumulate(const double *firstTarget, const unsigned long long targetStride,
+		const unsigned long long frameCount)
+	{
+
+		const double *targets(firstTarget);
+
+		//overlapping frames interleave the column's data points, gather the targets
+		if (targetStride != 1)
+		{
+
+			double *gatheredTargets(targetValues.get_ElementAddress(0));
+
+			for (unsigned long long frameIndex = 0; frameIndex < frameCount; frameIndex++)
+				gatheredTargets[frameIndex] = firstTarget[frameIndex * targetStride];
+
+			targets = gatheredTargets;
+
+		}
+
+		if (lossType == 0)
+			value = sub_SumSquaredError(outputValues.get_ElementAddress(0), targets, frameCount);
+
+		else if (lossType == 1)
+			value = sub_SumAbsoluteError(outputValues.get_ElementAddress(0), targets, frameCount);
+
+		else
+			value = sub_CountHits(outputValues.get_ElementAddress(0), targets, frameCount, threshold)
+				/ static_cast<double>(frameCount);
+
+	}
+
+	//assumes that outputFile is already open
+	void output_ToOpenFile_XML(ofstream &outputFile)
+	{
+
+		outputFile << "\n\t\t\t<name>";
+		name.output_ToOpenFile(outputFile);
+		outputFile << "</name>";
+
+		outputFile << "\n\t\t\t<lossType>" << static_cast<unsigned short>(lossType) << "</lossType>";
+		outputFile << "\n\t\t\t<outputIndex>" << outputIndex << "</outputIndex>";
+		outputFile << "\n\t\t\t<columnIndex>" << columnIndex << "</columnIndex>";
+		outputFile << "\n\t\t\t<columnSubIndex>" << columnSubIndex << "</columnSubIndex>";
+		outputFile << "\n\t\t\t<threshold>" << threshold << "</threshold>";
+
+	}
+
+	//assumes that outputFile is already open
+	void output_ToOpenFile_JSON(ofstream &outputFile)
+	{
+
+		outputFile << "\"name\":\"";
+		name.output_ToOpenFile(outputFile);
+		outputFile << "\",";
+
+		outputFile << "\"lossType\":" << static_cast<unsigned short>(lossType) << ",";
+		outputFile << "\"outputIndex\":" << outputIndex << ",";
+		outputFile << "\"columnIndex\":" << columnIndex << ",";
+		outputFile << "\"columnSubIndex\":" << columnSubIndex << ",";
+		outputFile << "\"threshold\":" << threshold;
+
+	}
+
+	//appends the properties which affect the loss to evaluationContent (see
+	//Population::get_RowEvaluationKey())
+	void append_ToKey(Genome &evaluationContent) const
+	{
+
+		evaluationContent.append_Varint(lossType);
+		evaluationContent.append_Varint(outputIndex);
+		evaluationContent.append_Varint(columnIndex);
+		evaluationContent.append_Varint(columnSubIndex);
+		evaluationContent.append_Double(threshold);
+
+	}
+
+};
+
+#endif // LOSSACCUMULATOR_H_INCLUDED
@@ -1,6 +1,9 @@
 #ifndef MATHTOOLS_H_INCLUDED
 #define MATHTOOLS_H_INCLUDED
 
+#include <cfloat>
+#include <cmath>
+#include <cstring>
 #include "MemoryTools.h"
 #include "StringTools.h"
 
@@ -19,15 +22,285 @@ long long roundToInteger(const double valueToRound)
 
 }
 
-double squareRoot(double squaredValue, const unsigned char iterationCount)
+//returns the square root of squaredValue (NaN if squaredValue is negative); the
+//hardware square root is exact to the last bit, so the unnamed iteration count (the
+//number of Newton iterations this once ran) is no longer used
+double squareRoot(const double squaredValue, const unsigned char)
 {
 
-	double tempDouble = 1.0;
+	return sqrt(squaredValue);
 
-	for (unsigned char count = 0; count < iterationCount; count++)
-		tempDouble = 0.5 * (tempDouble + (squaredValue / tempDouble));
+}
+
+//returns baseValue raised to the non-negative integer power magnitude by squaring
+//(a multiplication per bit of magnitude rather than per unit), multiplying the
+//partial product by each square in the same order for every base, so squares and
+//cubes are calculated as baseValue * baseValue and baseValue * (baseValue * baseValue)
+double positiveIntegerExponent(const double baseValue, unsigned long long magnitude)
+{
+
+	double calculatedValue(1.0);
+	double square(baseValue);
+
+	while (true)
+	{
+
+		if (magnitude & 1)
+			calculatedValue *= square;
+
+		magnitude >>= 1;
+
+		if (!magnitude)
+			return calculatedValue;
+
+		square *= square;
+
+	}
+
+}
+
+//returns baseValue raised to powerValue rounded to the nearest integer; assumes
+//baseValue and powerValue are not simulatneously both 0 (because that situation
+//is mathematically undefined, even if defined here)
+double integerExponent(const double baseValue, const double powerValue)
+{
+
+	const long long power(roundToInteger(powerValue));
+
+	if (power == 0)
+		return 1.0;
+
+	//positive exponent
+	if (power > 0)
+		return positiveIntegerExponent(baseValue, power);
+
+	//negative exponent
+	return 1.0 / positiveIntegerExponent(baseValue, 0 - static_cast<unsigned long long>(power));
+
+}
+
+//returns the root of baseValue with the positive integer power rootPower; square roots
+//are the correctly rounded sqrt(), cube roots cbrt() (within an ulp), other roots are
+//calculated with pow(); odd roots of negative values are negative, even roots of negative values
+//are NaN
+double positiveIntegerRoot(const unsigned long long rootPower, const double baseValue)
+{
+
+	if (rootPower == 1)
+		return baseValue;
+
+	if (rootPower == 2)
+		return sqrt(baseValue);
+
+	if (rootPower == 3)
+		return cbrt(baseValue);
+
+	if (baseValue < 0.0)
+	{
+
+		if (rootPower & 1)
+			return -pow(-baseValue, 1.0 / static_cast<double>(rootPower));
+
+		return sqrt(baseValue);
+
+	}
+
+	return pow(baseValue, 1.0 / static_cast<double>(rootPower));
+
+}
+
+//returns the root of baseValue with power rootPowerValue rounded to the nearest
+//integer (e.g. 2 means square root, 3 cube root, etc; negative powers give the
+//reciprocal root); assumes rootPowerValue does not round to 0 (because that situation
+//is mathematically undefined, even if defined here)
+double integerRoot(const double rootPowerValue, const double baseValue)
+{
+
+	const long long rootPower(roundToInteger(rootPowerValue));
+
+	if (rootPower == 0)
+		return 1.0;
+
+	//positive root
+	if (rootPower > 0)
+		return positiveIntegerRoot(rootPower, baseValue);
+
+	//negative root
+	return 1.0 / positiveIntegerRoot(0 - static_cast<unsigned long long>(rootPower), baseValue);
+
+}
+
+//sets values[lane] to integerExponent(values[lane], powerValues[lane]) for each of
+//laneCount lanes; when every power rounds to the same integer (the usual case, a
+//constant power) the lanes are squared and multiplied together one step at a time,
+//so the multiplications vectorize; results are the same as integerExponent()'s
+void integerExponent_Batch(double *values, const double *powerValues, const unsigned short laneCount)
+{
+
+	const unsigned short chunkLength(64);
+	double calculatedValues[chunkLength];
+	double squares[chunkLength];
+	unsigned long long magnitude;
+	long long power;
+	unsigned short chunkStart;
+	unsigned short chunkLaneCount;
+	unsigned short lane;
+
+	if (!laneCount)
+		return;
+
+	power = roundToInteger(powerValues[0]);
+
+	for (lane = 1; lane < laneCount; lane++)
+	{
+
+		//mixed powers, calculate lane by lane
+		if (roundToInteger(powerValues[lane]) != power)
+		{
+
+			for (lane = 0; lane < laneCount; lane++)
+				values[lane] = integerExponent(values[lane], powerValues[lane]);
+
+			return;
+
+		}
+
+	}
+
+	if (power == 0)
+	{
+
+		for (lane = 0; lane < laneCount; lane++)
+			values[lane] = 1.0;
+
+		return;
+
+	}
+
+	for (chunkStart = 0; chunkStart < laneCount; chunkStart += chunkLaneCount)
+	{
+
+		chunkLaneCount = ((laneCount - chunkStart < chunkLength) ? (laneCount - chunkStart) : chunkLength);
+
+		//as positiveIntegerExponent(), across the chunk
+		if (power > 0)
+			magnitude = power;
+
+		else
+			magnitude = 0 - static_cast<unsigned long long>(power);
+
+		for (lane = 0; lane < chunkLaneCount; lane++)
+		{
+
+			calculatedValues[lane] = 1.0;
+			squares[lane] = values[chunkStart + lane];
+
+		}
+
+		while (true)
+		{
+
+			if (magnitude & 1)
+			{
+
+				for (lane = 0; lane < chunkLaneCount; lane++)
+					calculatedValues[lane] *= squares[lane];
+
+			}
+
+			magnitude >>= 1;
+
+			if (!magnitude)
+				break;
+
+			for (lane = 0; lane < chunkLaneCount; lane++)
+				squares[lane] *= squares[lane];
+
+		}
+
+		if (power > 0)
+		{
+
+			for (lane = 0; lane < chunkLaneCount; lane++)
+				values[chunkStart + lane] = calculatedValues[lane];
+
+		}
+
+		else
+		{
+
+			for (lane = 0; lane < chunkLaneCount; lane++)
+				values[chunkStart + lane] = 1.0 / calculatedValues[lane];
+
+		}
+
+	}
+
+}
+
+//sets rootPowerValues[lane] to integerRoot(rootPowerValues[lane], baseValues[lane])
+//for each of laneCount lanes (the root power is the storage operand of a root, see
+//ExpressionInstruction::calculate()); when every root power rounds to the same
+//integer (the usual case, a constant root) the root is chosen once and applied to
+//every lane in a simple loop; results are the same as integerRoot()'s
+void integerRoot_Batch(double *rootPowerValues, const double *baseValues, const unsigned short laneCount)
+{
+
+	long long rootPower;
+	unsigned short lane;
+
+	if (!laneCount)
+		return;
+
+	rootPower = roundToInteger(rootPowerValues[0]);
+
+	for (lane = 1; lane < laneCount; lane++)
+	{
+
+		//mixed root powers, calculate lane by lane
+		if (roundToInteger(rootPowerValues[lane]) != rootPower)
+		{
+
+			for (lane = 0; lane < laneCount; lane++)
+				rootPowerValues[lane] = integerRoot(rootPowerValues[lane], baseValues[lane]);
+
+			return;
+
+		}
+
+	}
+
+	if (rootPower == 0)
+	{
+
+		for (lane = 0; lane < laneCount; lane++)
+			rootPowerValues[lane] = 1.0;
+
+	}
+
+	else if (rootPower == 2)
+	{
+
+		for (lane = 0; lane < laneCount; lane++)
+			rootPowerValues[lane] = sqrt(baseValues[lane]);
+
+	}
 
-	return tempDouble;
+	else if (rootPower == -2)
+	{
+
+		for (lane = 0; lane < laneCount; lane++)
+			rootPowerValues[lane] = 1.0 / sqrt(baseValues[lane]);
+
+	}
+
+	else
+	{
+
+		for (lane = 0; lane < laneCount; lane++)
+			rootPowerValues[lane] = integerRoot(rootPowerValues[lane], baseValues[lane]);
+
+	}
 
 }
 
@@ -124,15 +397,19 @@ private:
 	double *value;
 	double safetyValue;
 
+	//distance (in doubles) between the variable's values in successive data
+	//frames; 0 means the variable has a single value (see set_FrameStride())
+	unsigned long long frameStride;
+
 public:
 
 	//default constructor
 	Variable_Double() : SimpleComponent(), name("x"), utilized(false),
-		value(&safetyValue), safetyValue(1.0) {}
+		value(&safetyValue), safetyValue(1.0), frameStride(0) {}
 
 	//modified constructor - assumes aValue != NULL
 	Variable_Double(Word &aName, double *aValue) : SimpleComponent(),
-		name(aName), utilized(false), value(aValue) {}
+		name(aName), utilized(false), value(aValue), frameStride(0) {}
 
 	//default destructor
 	~Variable_Double() {}
@@ -143,6 +420,7 @@ public:
 
 		name = otherVariable.name;
 		utilized = otherVariable.utilized;
+		frameStride = otherVariable.frameStride;
 
 		if (otherVariable.value != &(otherVariable.safetyValue))
 			value = otherVariable.value;
@@ -158,6 +436,7 @@ public:
 
 		name = otherVariable.name;
 		utilized = otherVariable.utilized;
+		frameStride = otherVariable.frameStride;
 
 		if (otherVariable.value != &(otherVariable.safetyValue))
 			value = otherVariable.value;
@@ -206,7 +485,7 @@ public:
 
 	}
 
-	//getter
+	//getter (the value of the first data frame if the variable is strided)
 	double get_Value()
 	{
 
@@ -217,6 +496,16 @@ public:
 	//setter (should never be used for a variable)
 	void set_Value(const double newValue) {}
 
+	//returns the address of the pointer to the external double, which stays
+	//valid through reassign_Value(); used by expression programs to read the
+	//variable without a virtual call
+	double * const *get_ValueAddress() const
+	{
+
+		return &value;
+
+	}
+
 	//setter - for reasigning the variable to a new external double
 	//assumes externalValue != NULL
 	void reassign_Value(double *newExternalValue)
@@ -226,6 +515,26 @@ public:
 
 	}
 
+	//returns the address of frameStride, which stays valid through
+	//set_FrameStride(); used by expression programs with get_ValueAddress()
+	const unsigned long long *get_FrameStrideAddress() const
+	{
+
+		return &frameStride;
+
+	}
+
+	//setter - makes the external double the first of a strided sequence of
+	//values, one per data frame: an expression evaluated for data frame f reads
+	//the double f * newFrameStride doubles after it (see Expression_Double::evaluate());
+	//a variable can then be bound once per data set row rather than once per frame
+	void set_FrameStride(const unsigned long long newFrameStride)
+	{
+
+		frameStride = newFrameStride;
+
+	}
+
 };
 
 //stores temporary values used in sequential calculations
@@ -759,50 +1068,7 @@ public:
 	void calculate()
 	{
 
-		long long power(roundToInteger(actionOperand->get_Value()));
-
-		if (power == 0)
-			storageOperand->set_Value(1.0);
-
-		else
-		{
-
-			double baseValue(storageOperand->get_Value());
-			double calculatedValue(baseValue);
-
-			//positive exponent
-			if (power > 0)
-			{
-
-				while (power > 1)
-				{
-
-					calculatedValue *= baseValue;
-					power--;
-
-				}
-
-				storageOperand->set_Value(calculatedValue);
-
-			}
-
-			//negative exponent
-			else
-			{
-
-				while (power < -1)
-				{
-
-					calculatedValue *= baseValue;
-					power++;
-
-				}
-
-				storageOperand->set_Value(1.0 / calculatedValue);
-
-			}
-
-		}
+		storageOperand->set_Value(integerExponent(storageOperand->get_Value(), actionOperand->get_Value()));
 
 	}
 
@@ -880,65 +1146,7 @@ public:
 	void calculate()
 	{
 
-		long long rootPower(roundToInteger(storageOperand->get_Value()));
-
-		if (rootPower == 0)
-			storageOperand->set_Value(1.0);
-
-		else
-		{
-
-			bool negative;
-			unsigned long long count;
-			unsigned char charCount;
-
-			double baseValue(actionOperand->get_Value());
-			double Xn(1.0);
-			double Xn_BaseValue;
-			double Xn_to_the_pMinus1;
-
-			//positive root
-			if (rootPower > 0)
-				negative = false;
-
-			//negative root
-			else
-			{
-
-				negative = true;
-				rootPower *= (-1);
-
-			}
-
-			//the newtonian method: X(n+1) = Xn - (f(Xn) / f'(Xn-1))
-			//and power rule for derivatives: d/dx(X^n) = n(x^(n-1)) 
-			//lead to the following derivation for finding the pth root
-			//(where p is rootPower, a is known value of the root function?):
-			//Xn+1 = Xn - (Xn/p) + a/(p * Xn^(p-1))
-
-			//number of iterations set to 20 (arbitrary)
-			for (charCount = 0; charCount < 20; charCount++)
-			{
-
-				//calculate value of Xn^(p-1)
-				Xn_BaseValue = Xn;
-				Xn_to_the_pMinus1 = Xn;
-
-				for (count = 2; count < rootPower; count++)
-					Xn_to_the_pMinus1 *= Xn_BaseValue;
-
-				Xn = Xn - (Xn / rootPower) + (baseValue / (rootPower * Xn_to_the_pMinus1));
-
-			}
-
-			//complete the calculation
-			if (negative)
-				storageOperand->set_Value(1.0 / Xn);
-
-			else
-				storageOperand->set_Value(Xn);
-
-		}
+		storageOperand->set_Value(integerRoot(storageOperand->get_Value(), actionOperand->get_Value()));
 
 	}
 
@@ -1027,7 +1235,7 @@ private:
 	//actionOperand (binary) or the storageOperand (unary)
 	//not initialized in construction but later in a WrittenExpression
 	//sub_Initialize function
-	unsigned char keyValueIndex;
+	unsigned long long keyValueIndex;
 
 public:
 
@@ -1081,7 +1289,7 @@ public:
 	}
 
 	//getter
-	unsigned char get_KeyValueIndex() const
+	unsigned long long get_KeyValueIndex() const
 	{
 
 		return keyValueIndex;
@@ -1089,7 +1297,7 @@ public:
 	}
 
 	//setter
-	void set_KeyValueIndex(const unsigned char newKeyValueIndex)
+	void set_KeyValueIndex(const unsigned long long newKeyValueIndex)
 	{
 
 		keyValueIndex = newKeyValueIndex;
@@ -1098,1464 +1306,897 @@ public:
 
 };
 
-/*
-
-class conceptual design:
-
-each component stores an index number referencing which element of keyValues
-will be updated when the value associated with that node is in the second
-operand position in a calculation.
-
-keyValues is an ExtensibleArray<SimpleComponent> member of Expression_Double;
-the size of keyValues is calculated in Expression_Double::initialize() based
-on the structure of the BranchingList components derived from the Word writtenForm;
-keyValues has one element per key component branch (a branch of components which
-can calculated serially using a one Temporary_Double to store each successive calculation result;
-a new key component branch (and corresponding assigned keyValues element)
-starts with any complex component (parenthetical, distributive, power, root) which is not
-itself a first child and extends both vertically to descendants level after level until if
-and when new key component branches are encountered (again beginning with a complex component
-which is not a first child); the keyValueIndex of each component is assigned from top to bottom
-of the components structure; the last operation in the expression's operations list always
-assignes the calculated value to the [0] element of keyValues
-
-*/
-
-class Expression_Double
+//a single instruction of an Expression_Double's program, run by
+//Expression_Double::evaluate(); each instruction applies its operation to the
+//register at storageRegisterIndex and one operand, either the register at
+//operandRegisterIndex (a key value or a constant) or, when variableValueAddress
+//is not NULL, the external double of a Variable_Double
+class ExpressionInstruction
 {
 
-private:
-
-	//Word which represents the expression
-	Word writtenForm;
-
-	//internal storage array for all constant values
-	//(variables are stored externally)
-	UniformList<Constant_Double> constants;
-
-	//stored operations (both unary and binary)
-	UniformList<Negative> negatives;
-	UniformList<Assign> assignments;
-	UniformList<Add> additions;
-	UniformList<Subtract> subtractions;
-	UniformList<Multiply> multiplications;
-	UniformList<Divide> divisions;
-	UniformList<IntegerExponent> exponents;
-	UniformList<IntegerRoot> roots;
+	friend class Expression_Double;
 
-	//sequenced pointers to each operation in the lists above 
-	ExtensibleArray<Operator*> operations;
+private:
 
-	//used to store values of each successive calculation in operations
-	ExtensibleArray<Temporary_Double> keyValues;
+	unsigned char operationType; //as Operator::get_OperationType(); 0 means assignment, 1 addition, 2 subtraction, 3 multiplication, 4 division, 5 exponent, 6 root, 7 negative, and from optimization 8 square, 9 cube, 10 reciprocal
+	unsigned long long storageRegisterIndex; //register which is both the first operand and the result
+	unsigned long long operandRegisterIndex; //register holding the second operand (unused if variableValueAddress is not NULL)
+	double * const *variableValueAddress; //see Variable_Double::get_ValueAddress(); NULL if the second operand is a register
+	const unsigned long long *variableFrameStrideAddress; //see Variable_Double::get_FrameStrideAddress() (unused if variableValueAddress is NULL)
+	unsigned long long variableIndex; //index of the variable in Expression_Double::variables (unused if variableValueAddress is NULL)
 
 public:
 
 	//default constructor
-	Expression_Double() : writtenForm("0"), operations(1), keyValues(1)
-	{
-
-		constants.add_NewNode(Constant_Double(0));
+	ExpressionInstruction() : operationType(0), storageRegisterIndex(0), operandRegisterIndex(0),
+		variableValueAddress(NULL), variableFrameStrideAddress(NULL), variableIndex(0) {}
 
-		*(operations.get_ElementAddress(0)) = &(assignments.add_NewNode(Assign(
-			keyValues.get_ElementAddress(0), &(constants.get_FirstNode()->content)))->content);
-
-	}
+	//destructor
+	~ExpressionInstruction() {}
 
-	//modified constructor
-	Expression_Double(Word &aWrittenForm,
-		UniformList<Variable_Double> &initializedVariables)
+	//returns true if the operation uses its second operand
+	bool test_Binary() const
 	{
 
-		initialize(aWrittenForm, initializedVariables);
+		return (operationType < 7);
 
 	}
 
-	//copy constructor
-	Expression_Double(const Expression_Double& otherExpression)
+	//returns the result of the operation on storageValue and operandValue
+	//(operandValue is ignored by unary operations)
+	double calculate(const double storageValue, const double operandValue) const
 	{
 
-		writtenForm = otherExpression.writtenForm;
+		switch (operationType)
+		{
 
-		constants = otherExpression.constants;
+		case 0:
+			return operandValue;
 
-		unsigned long long operationsLength(otherExpression.operations.get_ArrayLength());
-		unsigned long long keyValuesLength(otherExpression.keyValues.get_ArrayLength());
+		case 1:
+			return storageValue + operandValue;
 
-		operations.resize_NoCopy(operationsLength);
-		keyValues.resize_NoCopy(keyValuesLength);
+		case 2:
+			return storageValue - operandValue;
 
-		unsigned char type;
-		unsigned long long opperationCount;
-		unsigned long long keyValueCount;
-		Operator* currentOperation;
-		UniformNode<Constant_Double> *otherConstant;
-		UniformNode<Constant_Double> *thisConstant;
-		SimpleComponent *actionOperand;
-		SimpleComponent *storageOperand;
+		case 3:
+			return storageValue * operandValue;
 
-		UniformNode<Assign> *assignmentNode;
-		UniformNode<Add> *additionNode;
-		UniformNode<Subtract> *subtractionNode;
-		UniformNode<Multiply> *multiplicationNode;
-		UniformNode<Divide> *divisionNode;
-		UniformNode<IntegerExponent> *exponentNode;
-		UniformNode<IntegerRoot> *rootNode;
-		UniformNode<Negative> *negativeNode;
+		case 4:
+			return storageValue / operandValue;
 
-		for (opperationCount = 0; opperationCount < operationsLength; opperationCount++)
-		{
+		case 5:
+			return integerExponent(storageValue, operandValue);
 
-			currentOperation = otherExpression.operations.get_Element(opperationCount);
-			type = currentOperation->get_OperationType();
-			
-			//assignment
-			if (type == 0)
-			{
+		case 6:
+			return integerRoot(storageValue, operandValue);
 
-				assignmentNode = otherExpression.assignments.get_FirstNode();
+		case 7:
+			return -storageValue;
 
-				do
-				{
+		//square and cube multiply in the same order as integerExponent()
+		case 8:
+			return storageValue * storageValue;
 
-					if (currentOperation == &assignmentNode->content)
-						break;
+		case 9:
+			return storageValue * storageValue * storageValue;
 
-					assignmentNode = assignmentNode->get_NextNode();
+		default:
+			return 1.0 / storageValue;
 
-				} while (true);
+		}
 
-				//find action operand
-				type = assignmentNode->content.get_ActionOperandType();
+	}
 
-				//actionOperand points to a keyValue
-				if (type == 2)
-				{
+};
 
-					keyValueCount = 0;
+//a value computed within an expression program, identified while the program is
+//optimized (see Expression_Double::sub_OptimizeProgram()); registers holding the
+//same value number hold equal values
+class ExpressionValueNumber
+{
 
-					do
-					{
+	friend class Expression_Double;
 
-						if (assignmentNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-				}
-
-				//actionOperand points to a constant
-				else if (type == 0)
-				{
-
-					otherConstant = otherExpression.constants.get_FirstNode();
-					thisConstant = constants.get_FirstNode();
-
-					do
-					{
-
-						if (assignmentNode->content.get_ActionOperand() == &(otherConstant->content))
-							break;
-
-						otherConstant = otherConstant->get_NextNode();
-						thisConstant = thisConstant->get_NextNode();
-
-					} while (true);
-
-					actionOperand = &(thisConstant->content);
-
-				}
-
-				//actionOperand points to a variable which can be taken directly
-				//from assignmentNode because variables are stored externally;
-				else
-					actionOperand = assignmentNode->content.get_ActionOperand();
-
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
-
-				do
-				{
-
-					if (assignmentNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
-
-					keyValueCount++;
+private:
 
-				} while (true);
+	unsigned char kind; //0 means a constant, 1 a variable, 2 the content of a register before the program runs, 3 the result of an operation
+	unsigned char operationType; //operation producing the value, as ExpressionInstruction (kind 3 only)
+	unsigned long long firstIndex; //variable index for kind 1, register index for kind 2, value number of the storage operand for kind 3
+	unsigned long long secondIndex; //value number of the second operand (kind 3 binary operations only)
+	double constantValue; //kind 0 only
+	double * const *variableValueAddress; //kind 1 only
+	unsigned long long holderRegisterIndex; //register last given this value plus 1; 0 means none
 
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
+public:
 
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(assignments.add_NewNode(
-					Assign(storageOperand, actionOperand))->content);
+	//default constructor
+	ExpressionValueNumber() : kind(0), operationType(0), firstIndex(0), secondIndex(0),
+		constantValue(0.0), variableValueAddress(NULL), holderRegisterIndex(0) {}
 
-			}
+	//destructor
+	~ExpressionValueNumber() {}
 
-			//addition
-			else if (type == 1)
-			{
+	//returns true if otherValueNumber describes the same value; constants
+	//match bit for bit (so 0.0 and -0.0 remain distinct)
+	bool test_Matches(const ExpressionValueNumber &otherValueNumber) const
+	{
 
-				additionNode = otherExpression.additions.get_FirstNode();
+		if (kind != otherValueNumber.kind)
+			return false;
 
-				do
-				{
+		if (kind == 0)
+			return !memcmp(&constantValue, &otherValueNumber.constantValue, sizeof(constantValue));
 
-					if (currentOperation == &additionNode->content)
-						break;
+		if (kind == 1)
+			return (variableValueAddress == otherValueNumber.variableValueAddress);
 
-					additionNode = additionNode->get_NextNode();
+		if (kind == 2)
+			return (firstIndex == otherValueNumber.firstIndex);
 
-				} while (true);
+		return (operationType == otherValueNumber.operationType && firstIndex == otherValueNumber.firstIndex
+			&& secondIndex == otherValueNumber.secondIndex);
 
-				//find action operand
-				type = additionNode->content.get_ActionOperandType();
+	}
 
-				//actionOperand points to a keyValue
-				if (type == 2)
-				{
+};
 
-					keyValueCount = 0;
+//an expression compiled to native code (see Expression_Double::output_NativeFunction());
+//its parameters are the expression's registers, the value and frame stride addresses
+//of its variables, the data frame index and the functions it calls for exponents and roots
+typedef double (*NativeExpressionFunction)(double*, double * const * const*,
+	const unsigned long long * const *, unsigned long long, double (*)(double, double),
+	double (*)(double, double));
+
+//a column of values one variable takes across a batch of evaluations (see
+//Expression_Double::evaluate_Batch()); in evaluation i the variable takes
+//values[i * stride]
+class VariableColumn
+{
 
-					do
-					{
+	friend class Expression_Double;
 
-						if (additionNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
+private:
 
-						keyValueCount++;
+	Variable_Double *variable; //generally a member of the list used in Expression_Double::initialize()
+	const double *values;
+	unsigned long long stride; //distance between successive values (1 means contiguous)
 
-					} while (true);
+public:
 
-					actionOperand = keyValues.get_ElementAddress(keyValueCount);
+	//default constructor
+	VariableColumn() : variable(NULL), values(NULL), stride(1) {}
 
-				}
+	//modified constructor - assumes aVariable and aValues are non-NULL
+	VariableColumn(Variable_Double *aVariable, const double *aValues, const unsigned long long aStride = 1)
+		: variable(aVariable), values(aValues), stride(aStride) {}
 
-				//actionOperand points to a constant
-				else if (type == 0)
-				{
+	//destructor
+	~VariableColumn() {}
 
-					otherConstant = otherExpression.constants.get_FirstNode();
-					thisConstant = constants.get_FirstNode();
+};
 
-					do
-					{
+/*
 
-						if (additionNode->content.get_ActionOperand() == &(otherConstant->content))
-							break;
+class conceptual design:
 
-						otherConstant = otherConstant->get_NextNode();
-						thisConstant = thisConstant->get_NextNode();
+each component stores an index number referencing which element of keyValues
+will be updated when the value associated with that node is in the second
+operand position in a calculation.
 
-					} while (true);
+keyValues are the first keyValueCount registers of Expression_Double;
+the number of keyValues is calculated in Expression_Double::initialize() based
+on the structure of the BranchingList components derived from the Word writtenForm;
+there is one keyValue per key component branch (a branch of components which
+can calculated serially using a one Temporary_Double to store each successive calculation result;
+a new key component branch (and corresponding assigned keyValues element)
+starts with any complex component (parenthetical, distributive, power, root) which is not
+itself a first child and extends both vertically to descendants level after level until if
+and when new key component branches are encountered (again beginning with a complex component
+which is not a first child); the keyValueIndex of each component is assigned from top to bottom
+of the components structure; the last operation in the expression's program always
+assignes the calculated value to the [0] element of keyValues
 
-					actionOperand = &(thisConstant->content);
+*/
 
-				}
+class Expression_Double
+{
 
-				//actionOperand points to a variable which can be taken directly
-				//from additionNode because variables are stored externally;
-				else
-					actionOperand = additionNode->content.get_ActionOperand();
+private:
 
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
+	//Word which represents the expression
+	Word writtenForm;
 
-				do
-				{
+	//constants of the written form, referred to by components while initialize()
+	//runs (program keeps its own copies in registers)
+	UniformList<Constant_Double> constants;
 
-					if (additionNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
+	//number of key values, held in the first registers
+	unsigned long long keyValueCount;
 
-					keyValueCount++;
+	//the expression as instructions over registers (see ExpressionInstruction); the
+	//first keyValueCount registers hold the key values, the rest hold constant operands
+	ExtensibleArray<ExpressionInstruction> program;
+	ExtensibleArray<double> registers;
 
-				} while (true);
+	//the distinct variables program refers to (by index), each with its position in
+	//the list used in initialize() (see rebind_Variables())
+	ExtensibleArray<Variable_Double*> variables;
+	ExtensibleArray<unsigned long long> variablePositions;
 
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
+	//the value and frame stride addresses of each of variables (see
+	//Variable_Double::get_ValueAddress()), each followed by NULL; passed to nativeFunction
+	ExtensibleArray<double * const *> variableValueAddresses;
+	ExtensibleArray<const unsigned long long *> variableFrameStrideAddresses;
 
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(additions.add_NewNode(
-					Add(storageOperand, actionOperand))->content);
+	//number of evaluations evaluate_Batch() carries through the program together
+	static const unsigned short batchBlockLength = 64;
 
-			}
+	//native form of program (see attach_NativeFunction()); NULL means evaluate()
+	//interprets program
+	NativeExpressionFunction nativeFunction;
 
-			//subtraction
-			else if (type == 2)
-			{
+	//returns true if firstValue and secondValue are the same double bit for bit, or both NaN
+	bool sub_TestSameValue(const double firstValue, const double secondValue) const
+	{
 
-				subtractionNode = otherExpression.subtractions.get_FirstNode();
+		if (firstValue != firstValue)
+			return (secondValue != secondValue);
 
-				do
-				{
+		return !memcmp(&firstValue, &secondValue, sizeof(firstValue));
 
-					if (currentOperation == &subtractionNode->content)
-						break;
+	}
 
-					subtractionNode = subtractionNode->get_NextNode();
+	//writes value to output as an exact C++ double literal
+	void sub_OutputNativeConstant(ostream &output, const double value) const
+	{
 
-				} while (true);
+		char literal[64];
 
-				//find action operand
-				type = subtractionNode->content.get_ActionOperandType();
+		if (value != value)
+			output << "(0.0 / 0.0)";
 
-				//actionOperand points to a keyValue
-				if (type == 2)
-				{
+		else if (value > DBL_MAX)
+			output << "(1.0 / 0.0)";
 
-					keyValueCount = 0;
+		else if (value < -DBL_MAX)
+			output << "(-1.0 / 0.0)";
 
-					do
-					{
+		else
+		{
 
-						if (subtractionNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
+			snprintf(literal, sizeof(literal), "%a", value);
+			output << '(' << literal << ')';
 
-						keyValueCount++;
+		}
 
-					} while (true);
+	}
 
-					actionOperand = keyValues.get_ElementAddress(keyValueCount);
+	//writes the second operand of instruction to output in native source
+	void sub_OutputNativeOperand(ostream &output, const ExpressionInstruction &instruction) const
+	{
 
-				}
+		if (instruction.variableValueAddress)
+			output << "(*v[" << instruction.variableIndex << "])[f * *s[" << instruction.variableIndex << "]]";
 
-				//actionOperand points to a constant
-				else if (type == 0)
-				{
+		else if (instruction.operandRegisterIndex < keyValueCount)
+			output << 'k' << instruction.operandRegisterIndex;
 
-					otherConstant = otherExpression.constants.get_FirstNode();
-					thisConstant = constants.get_FirstNode();
+		else
+			sub_OutputNativeConstant(output, registers.get_Element(instruction.operandRegisterIndex));
 
-					do
-					{
+	}
 
-						if (subtractionNode->content.get_ActionOperand() == &(otherConstant->content))
-							break;
+	//sets the expression to the null state, "0"
+	void sub_SetNullState()
+	{
 
-						otherConstant = otherConstant->get_NextNode();
-						thisConstant = thisConstant->get_NextNode();
+		ExpressionInstruction *instruction;
 
-					} while (true);
+		writtenForm = "0";
+		constants.delete_WholeList();
+		keyValueCount = 1;
 
-					actionOperand = &(thisConstant->content);
+		//the program assigns the constant in register 1 to the key value
+		program.resize_NoCopy(1);
+		instruction = program.get_ElementAddress(0);
+		*instruction = ExpressionInstruction();
+		instruction->operandRegisterIndex = 1;
 
-				}
+		registers.resize_NoCopy(2);
+		*(registers.get_ElementAddress(0)) = 1.0;
+		*(registers.get_ElementAddress(1)) = 0.0;
 
-				//actionOperand points to a variable which can be taken directly
-				//from subtractionNode because variables are stored externally;
-				else
-					actionOperand = subtractionNode->content.get_ActionOperand();
+		variables = ExtensibleArray<Variable_Double*>();
+		variablePositions = ExtensibleArray<unsigned long long>();
+		sub_BindProgramVariables();
 
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
+		nativeFunction = NULL;
 
-				do
-				{
+	}
 
-					if (subtractionNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
+	//sets the variable addresses (variableValueAddresses, variableFrameStrideAddresses
+	//and those of each instruction of program) from variables
+	void sub_BindProgramVariables()
+	{
 
-					keyValueCount++;
+		const unsigned long long variablesLength(variables.get_ArrayLength());
+		ExpressionInstruction *instruction;
+		unsigned long long count;
 
-				} while (true);
+		variableValueAddresses.resize_NoCopy(variablesLength + 1);
+		variableFrameStrideAddresses.resize_NoCopy(variablesLength + 1);
 
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
+		for (count = 0; count < variablesLength; count++)
+		{
 
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(subtractions.add_NewNode(
-					Subtract(storageOperand, actionOperand))->content);
+			*(variableValueAddresses.get_ElementAddress(count)) = variables.get_Element(count)->get_ValueAddress();
+			*(variableFrameStrideAddresses.get_ElementAddress(count)) = variables.get_Element(count)->get_FrameStrideAddress();
 
-			}
+		}
 
-			//multiplication
-			else if (type == 3)
-			{
+		*(variableValueAddresses.get_ElementAddress(variablesLength)) = NULL;
+		*(variableFrameStrideAddresses.get_ElementAddress(variablesLength)) = NULL;
 
-				multiplicationNode = otherExpression.multiplications.get_FirstNode();
+		for (count = 0; count < program.get_ArrayLength(); count++)
+		{
 
-				do
-				{
+			instruction = program.get_ElementAddress(count);
 
-					if (currentOperation == &multiplicationNode->content)
-						break;
+			if (!instruction->variableValueAddress)
+				continue;
 
-					multiplicationNode = multiplicationNode->get_NextNode();
+			instruction->variableValueAddress = variableValueAddresses.get_Element(instruction->variableIndex);
+			instruction->variableFrameStrideAddress = variableFrameStrideAddresses.get_Element(instruction->variableIndex);
 
-				} while (true);
+		}
 
-				//find action operand
-				type = multiplicationNode->content.get_ActionOperandType();
+	}
 
-				//actionOperand points to a keyValue
-				if (type == 2)
-				{
+	//appends to rawProgram the operation operationType on the key value storageIndex
+	//and actionComponent (a constant or variable), or on the key value actionIndex if
+	//actionComponent is NULL; constants are numbered after the key values in the order
+	//they are appended to rawConstants, variables by their index in rawVariables
+	void sub_SequenceInstruction(UniformList<ExpressionInstruction> &rawProgram,
+		UniformList<double> &rawConstants, UniformList<Variable_Double*> &rawVariables,
+		const unsigned char operationType, const unsigned long long storageIndex,
+		SimpleComponent *actionComponent, const unsigned long long actionIndex)
+	{
 
-					keyValueCount = 0;
+		ExpressionInstruction instruction;
+		UniformNode<Variable_Double*> *variableNode(rawVariables.get_FirstNode());
+		Variable_Double *variable;
 
-					do
-					{
+		instruction.operationType = operationType;
+		instruction.storageRegisterIndex = storageIndex;
 
-						if (multiplicationNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
+		//key value
+		if (!actionComponent)
+			instruction.operandRegisterIndex = actionIndex;
 
-						keyValueCount++;
+		//constant
+		else if (!actionComponent->get_ComponentType())
+		{
 
-					} while (true);
+			instruction.operandRegisterIndex = keyValueCount + rawConstants.get_ListLength();
+			rawConstants.add_NewNode(actionComponent->get_Value());
 
-					actionOperand = keyValues.get_ElementAddress(keyValueCount);
+		}
 
-				}
+		//variable
+		else
+		{
 
-				//actionOperand points to a constant
-				else if (type == 0)
-				{
+			variable = static_cast<Variable_Double*>(actionComponent);
 
-					otherConstant = otherExpression.constants.get_FirstNode();
-					thisConstant = constants.get_FirstNode();
+			for (; variableNode && variableNode->content != variable; variableNode = variableNode->get_NextNode())
+				instruction.variableIndex++;
 
-					do
-					{
+			if (!variableNode)
+				rawVariables.add_NewNode(variable);
 
-						if (multiplicationNode->content.get_ActionOperand() == &(otherConstant->content))
-							break;
+			instruction.variableValueAddress = variable->get_ValueAddress();
 
-						otherConstant = otherConstant->get_NextNode();
-						thisConstant = thisConstant->get_NextNode();
+		}
 
-					} while (true);
+		rawProgram.add_NewNode(instruction);
 
-					actionOperand = &(thisConstant->content);
+	}
 
-				}
+	//sets program, registers and variables from the instructions, constants and
+	//variables sequenced from initializedVariables (see sub_SequenceInstruction()),
+	//then optimizes program
+	void sub_CompileProgram(UniformList<ExpressionInstruction> &rawProgram,
+		UniformList<double> &rawConstants, UniformList<Variable_Double*> &rawVariables,
+		UniformList<Variable_Double> &initializedVariables)
+	{
 
-				//actionOperand points to a variable which can be taken directly
-				//from multiplicationNode because variables are stored externally;
-				else
-					actionOperand = multiplicationNode->content.get_ActionOperand();
+		UniformNode<double> *constantNode(rawConstants.get_FirstNode());
+		UniformNode<Variable_Double> *variableNode(initializedVariables.get_FirstNode());
+		unsigned long long position(0);
+		unsigned long long count;
 
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
+		nativeFunction = NULL;
+		program = rawProgram;
+		registers.resize_NoCopy(keyValueCount + rawConstants.get_ListLength());
 
-				do
-				{
+		//key values start as Temporary_Double does
+		for (count = 0; count < keyValueCount; count++)
+			*(registers.get_ElementAddress(count)) = 1.0;
 
-					if (multiplicationNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
+		for (; constantNode; constantNode = constantNode->get_NextNode())
+			*(registers.get_ElementAddress(count++)) = constantNode->content;
 
-					keyValueCount++;
+		//the components no longer refer to the constants
+		constants.delete_WholeList();
 
-				} while (true);
+		variables = rawVariables;
 
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
+		if (variables.get_ArrayLength())
+			variablePositions.resize_NoCopy(variables.get_ArrayLength());
 
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(multiplications.add_NewNode(
-					Multiply(storageOperand, actionOperand))->content);
+		else
+			variablePositions = ExtensibleArray<unsigned long long>();
 
-			}
+		for (; variableNode; variableNode = variableNode->get_NextNode(), position++)
+		{
 
-			//division
-			else if (type == 4)
+			for (count = 0; count < variables.get_ArrayLength(); count++)
 			{
 
-				divisionNode = otherExpression.divisions.get_FirstNode();
-
-				do
-				{
-
-					if (currentOperation == &divisionNode->content)
-						break;
-
-					divisionNode = divisionNode->get_NextNode();
-
-				} while (true);
-
-				//find action operand
-				type = divisionNode->content.get_ActionOperandType();
-
-				//actionOperand points to a keyValue
-				if (type == 2)
-				{
-
-					keyValueCount = 0;
-
-					do
-					{
-
-						if (divisionNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-				}
-
-				//actionOperand points to a constant
-				else if (type == 0)
-				{
-
-					otherConstant = otherExpression.constants.get_FirstNode();
-					thisConstant = constants.get_FirstNode();
-
-					do
-					{
-
-						if (divisionNode->content.get_ActionOperand() == &(otherConstant->content))
-							break;
-
-						otherConstant = otherConstant->get_NextNode();
-						thisConstant = thisConstant->get_NextNode();
-
-					} while (true);
-
-					actionOperand = &(thisConstant->content);
-
-				}
-
-				//actionOperand points to a variable which can be taken directly
-				//from divsionNode because variables are stored externally;
-				else
-					actionOperand = divisionNode->content.get_ActionOperand();
-
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
-
-				do
-				{
-
-					if (divisionNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
-
-					keyValueCount++;
-
-				} while (true);
-
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
-
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(divisions.add_NewNode(
-					Divide(storageOperand, actionOperand))->content);
+				if (variables.get_Element(count) == &(variableNode->content))
+					*(variablePositions.get_ElementAddress(count)) = position;
 
 			}
 
-			//exponent
-			else if (type == 5)
-			{
-
-				exponentNode = otherExpression.exponents.get_FirstNode();
-
-				do
-				{
-
-					if (currentOperation == &exponentNode->content)
-						break;
-
-					exponentNode = exponentNode->get_NextNode();
-
-				} while (true);
-
-				//find action operand
-				type = exponentNode->content.get_ActionOperandType();
-
-				//actionOperand points to a keyValue
-				if (type == 2)
-				{
-
-					keyValueCount = 0;
-
-					do
-					{
-
-						if (exponentNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-				}
-
-				//actionOperand points to a constant
-				else if (type == 0)
-				{
-
-					otherConstant = otherExpression.constants.get_FirstNode();
-					thisConstant = constants.get_FirstNode();
-
-					do
-					{
-
-						if (exponentNode->content.get_ActionOperand() == &(otherConstant->content))
-							break;
-
-						otherConstant = otherConstant->get_NextNode();
-						thisConstant = thisConstant->get_NextNode();
-
-					} while (true);
-
-					actionOperand = &(thisConstant->content);
-
-				}
-
-				//actionOperand points to a variable which can be taken directly
-				//from divsionNode because variables are stored externally;
-				else
-					actionOperand = exponentNode->content.get_ActionOperand();
-
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
-
-				do
-				{
-
-					if (exponentNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
-
-					keyValueCount++;
-
-				} while (true);
-
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
+		}
 
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(exponents.add_NewNode(
-					IntegerExponent(storageOperand, actionOperand))->content);
+		sub_OptimizeProgram();
+		sub_BindProgramVariables();
 
-			}
-
-			//root
-			else if (type == 6)
-			{
+	}
 
-				rootNode = otherExpression.roots.get_FirstNode();
+	//returns the index in valueNumbers (of which valueNumberCount are in use) of the
+	//value number matching description, adding it if new
+	unsigned long long sub_GetValueNumber(ExtensibleArray<ExpressionValueNumber> &valueNumbers,
+		unsigned long long &valueNumberCount, const ExpressionValueNumber &description)
+	{
 
-				do
-				{
+		unsigned long long count;
 
-					if (currentOperation == &rootNode->content)
-						break;
+		for (count = 0; count < valueNumberCount; count++)
+		{
 
-					rootNode = rootNode->get_NextNode();
+			if (valueNumbers.get_ElementAddress(count)->test_Matches(description))
+				return count;
 
-				} while (true);
+		}
 
-				//find action operand
-				type = rootNode->content.get_ActionOperandType();
+		if (valueNumberCount == valueNumbers.get_ArrayLength())
+			valueNumbers.resize_WithCopy(valueNumberCount * 2);
 
-				//actionOperand points to a keyValue
-				if (type == 2)
-				{
+		*(valueNumbers.get_ElementAddress(valueNumberCount)) = description;
 
-					keyValueCount = 0;
+		return valueNumberCount++;
 
-					do
-					{
+	}
 
-						if (rootNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
+	//returns the index of the value number of constantValue (see sub_GetValueNumber())
+	unsigned long long sub_GetConstantValueNumber(ExtensibleArray<ExpressionValueNumber> &valueNumbers,
+		unsigned long long &valueNumberCount, const double constantValue)
+	{
 
-						keyValueCount++;
+		ExpressionValueNumber description;
 
-					} while (true);
+		description.constantValue = constantValue;
 
-					actionOperand = keyValues.get_ElementAddress(keyValueCount);
+		return sub_GetValueNumber(valueNumbers, valueNumberCount, description);
 
-				}
+	}
 
-				//actionOperand points to a constant
-				else if (type == 0)
-				{
+	//returns the register holding constantValue in the optimized program, whose
+	//constants (constantCount of them) are listed in constantValues, adding it if new
+	unsigned long long sub_GetConstantRegister(ExtensibleArray<double> &constantValues,
+		unsigned long long &constantCount, const double constantValue)
+	{
 
-					otherConstant = otherExpression.constants.get_FirstNode();
-					thisConstant = constants.get_FirstNode();
+		unsigned long long count;
 
-					do
-					{
+		for (count = 0; count < constantCount; count++)
+		{
 
-						if (rootNode->content.get_ActionOperand() == &(otherConstant->content))
-							break;
+			if (!memcmp(constantValues.get_ElementAddress(count), &constantValue, sizeof(constantValue)))
+				return keyValueCount + count;
 
-						otherConstant = otherConstant->get_NextNode();
-						thisConstant = thisConstant->get_NextNode();
+		}
 
-					} while (true);
+		if (constantCount == constantValues.get_ArrayLength())
+			constantValues.resize_WithCopy(constantCount * 2);
 
-					actionOperand = &(thisConstant->content);
+		*(constantValues.get_ElementAddress(constantCount)) = constantValue;
 
-				}
+		return keyValueCount + constantCount++;
 
-				//actionOperand points to a variable which can be taken directly
-				//from divsionNode because variables are stored externally;
-				else
-					actionOperand = rootNode->content.get_ActionOperand();
+	}
 
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
+	//returns the index of the value number of the result of operationType applied to
+	//the values numbered storageIndex and operandIndex (see sub_GetValueNumber());
+	//operations on constants are folded, operations leaving their storage operand
+	//unchanged return storageIndex, and small integer exponents change operationType
+	//to the equivalent square, cube or reciprocal
+	unsigned long long sub_NumberOperation(ExtensibleArray<ExpressionValueNumber> &valueNumbers,
+		unsigned long long &valueNumberCount, unsigned char &operationType,
+		unsigned long long storageIndex, unsigned long long operandIndex)
+	{
 
-				do
-				{
+		const ExpressionValueNumber storageValue(valueNumbers.get_Element(storageIndex));
+		const ExpressionValueNumber operandValue(valueNumbers.get_Element(operandIndex));
+		const double positiveZero(0.0);
+		ExpressionInstruction folding;
+		ExpressionValueNumber description;
+		unsigned long long swapIndex;
+		long long power;
 
-					if (rootNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
+		//assignment
+		if (!operationType)
+			return operandIndex;
 
-					keyValueCount++;
+		folding.operationType = operationType;
 
-				} while (true);
+		//constant operands (or a unary operation on a constant)
+		if (storageValue.kind == 0 && (operandValue.kind == 0 || !folding.test_Binary()))
+			return sub_GetConstantValueNumber(valueNumbers, valueNumberCount,
+				folding.calculate(storageValue.constantValue, operandValue.constantValue));
 
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
+		//constant second operand
+		if (operandValue.kind == 0 && folding.test_Binary())
+		{
 
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(roots.add_NewNode(
-					IntegerRoot(storageOperand, actionOperand))->content);
+			if ((operationType == 3 || operationType == 4) && operandValue.constantValue == 1.0)
+				return storageIndex;
 
-			}
+			//x - 0.0 is x, even for x = -0.0 (unlike x - -0.0)
+			if (operationType == 2 && !memcmp(&operandValue.constantValue, &positiveZero, sizeof(positiveZero)))
+				return storageIndex;
 
-			//negative
-			else if (type == 7)
+			if (operationType == 5)
 			{
 
-				negativeNode = otherExpression.negatives.get_FirstNode();
+				power = roundToInteger(operandValue.constantValue);
 
-				do
-				{
+				if (power == 0)
+					return sub_GetConstantValueNumber(valueNumbers, valueNumberCount, 1.0);
 
-					if (currentOperation == &negativeNode->content)
-						break;
+				if (power == 1)
+					return storageIndex;
 
-					negativeNode = negativeNode->get_NextNode();
+				if (power == 2)
+					operationType = 8;
 
-				} while (true);
+				else if (power == 3)
+					operationType = 9;
 
-				//find storage operand (always points to a keyValue)
-				keyValueCount = 0;
-
-				do
-				{
-
-					if (negativeNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-						break;
-
-					keyValueCount++;
-
-				} while (true);
-
-				storageOperand = keyValues.get_ElementAddress(keyValueCount);
-
-				//add create the new operation
-				*(operations.get_ElementAddress(opperationCount)) = &(negatives.add_NewNode(
-					Negative(storageOperand))->content);
+				else if (power == -1)
+					operationType = 10;
 
 			}
 
 		}
 
-	}
+		//a root of power 0 is always 1.0 (see integerRoot())
+		if (operationType == 6 && storageValue.kind == 0 && !roundToInteger(storageValue.constantValue))
+			return sub_GetConstantValueNumber(valueNumbers, valueNumberCount, 1.0);
 
-	//copy assignement operator
-	Expression_Double& operator=(Expression_Double const& otherExpression)
-	{
+		//-(-x) is x
+		if (operationType == 7 && storageValue.kind == 3 && storageValue.operationType == 7)
+			return storageValue.firstIndex;
 
-		if (&otherExpression != this)
+		//addition and multiplication are commutative (exactly, in floating point)
+		if ((operationType == 1 || operationType == 3) && operandIndex < storageIndex)
 		{
 
-			writtenForm = otherExpression.writtenForm;
-
-			constants = otherExpression.constants;
-
-			unsigned long long operationsLength(otherExpression.operations.get_ArrayLength());
-			unsigned long long keyValuesLength(otherExpression.keyValues.get_ArrayLength());
-
-			operations.resize_NoCopy(operationsLength);
-			keyValues.resize_NoCopy(keyValuesLength);
-
-			assignments.delete_WholeList();
-			additions.delete_WholeList();
-			subtractions.delete_WholeList();
-			multiplications.delete_WholeList();
-			divisions.delete_WholeList();
-			exponents.delete_WholeList();
-			roots.delete_WholeList();
-			negatives.delete_WholeList();
-
-			unsigned char type;
-			unsigned long long opperationCount;
-			unsigned long long keyValueCount;
-			Operator* currentOperation;
-			UniformNode<Constant_Double> *otherConstant;
-			UniformNode<Constant_Double> *thisConstant;
-			SimpleComponent *actionOperand;
-			SimpleComponent *storageOperand;
-
-			UniformNode<Assign> *assignmentNode;
-			UniformNode<Add> *additionNode;
-			UniformNode<Subtract> *subtractionNode;
-			UniformNode<Multiply> *multiplicationNode;
-			UniformNode<Divide> *divisionNode;
-			UniformNode<IntegerExponent> *exponentNode;
-			UniformNode<IntegerRoot> *rootNode;
-			UniformNode<Negative> *negativeNode;
-
-			for (opperationCount = 0; opperationCount < operationsLength; opperationCount++)
-			{
-
-				currentOperation = otherExpression.operations.get_Element(opperationCount);
-				type = currentOperation->get_OperationType();
-
-				//assignment
-				if (type == 0)
-				{
-
-					assignmentNode = otherExpression.assignments.get_FirstNode();
-
-					do
-					{
-
-						if (currentOperation == &assignmentNode->content)
-							break;
-
-						assignmentNode = assignmentNode->get_NextNode();
-
-					} while (true);
-
-					//find action operand
-					type = assignmentNode->content.get_ActionOperandType();
-
-					//actionOperand points to a keyValue
-					if (type == 2)
-					{
-
-						keyValueCount = 0;
-
-						do
-						{
-
-							if (assignmentNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-								break;
-
-							keyValueCount++;
-
-						} while (true);
-
-						actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					}
-
-					//actionOperand points to a constant
-					else if (type == 0)
-					{
-
-						otherConstant = otherExpression.constants.get_FirstNode();
-						thisConstant = constants.get_FirstNode();
-
-						do
-						{
-
-							if (assignmentNode->content.get_ActionOperand() == &(otherConstant->content))
-								break;
-
-							otherConstant = otherConstant->get_NextNode();
-							thisConstant = thisConstant->get_NextNode();
-
-						} while (true);
-
-						actionOperand = &(thisConstant->content);
-
-					}
-
-					//actionOperand points to a variable which can be taken directly
-					//from assignmentNode because variables are stored externally;
-					else
-						actionOperand = assignmentNode->content.get_ActionOperand();
-
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
-
-					do
-					{
-
-						if (assignmentNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(assignments.add_NewNode(
-						Assign(storageOperand, actionOperand))->content);
-
-				}
-
-				//addition
-				else if (type == 1)
-				{
-
-					additionNode = otherExpression.additions.get_FirstNode();
-
-					do
-					{
-
-						if (currentOperation == &additionNode->content)
-							break;
-
-						additionNode = additionNode->get_NextNode();
-
-					} while (true);
-
-					//find action operand
-					type = additionNode->content.get_ActionOperandType();
-
-					//actionOperand points to a keyValue
-					if (type == 2)
-					{
-
-						keyValueCount = 0;
-
-						do
-						{
-
-							if (additionNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-								break;
-
-							keyValueCount++;
-
-						} while (true);
-
-						actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					}
-
-					//actionOperand points to a constant
-					else if (type == 0)
-					{
-
-						otherConstant = otherExpression.constants.get_FirstNode();
-						thisConstant = constants.get_FirstNode();
-
-						do
-						{
-
-							if (additionNode->content.get_ActionOperand() == &(otherConstant->content))
-								break;
-
-							otherConstant = otherConstant->get_NextNode();
-							thisConstant = thisConstant->get_NextNode();
-
-						} while (true);
-
-						actionOperand = &(thisConstant->content);
-
-					}
-
-					//actionOperand points to a variable which can be taken directly
-					//from additionNode because variables are stored externally;
-					else
-						actionOperand = additionNode->content.get_ActionOperand();
-
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
-
-					do
-					{
-
-						if (additionNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(additions.add_NewNode(
-						Add(storageOperand, actionOperand))->content);
-
-				}
-
-				//subtraction
-				else if (type == 2)
-				{
-
-					subtractionNode = otherExpression.subtractions.get_FirstNode();
-
-					do
-					{
-
-						if (currentOperation == &subtractionNode->content)
-							break;
-
-						subtractionNode = subtractionNode->get_NextNode();
-
-					} while (true);
-
-					//find action operand
-					type = subtractionNode->content.get_ActionOperandType();
-
-					//actionOperand points to a keyValue
-					if (type == 2)
-					{
-
-						keyValueCount = 0;
-
-						do
-						{
-
-							if (subtractionNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-								break;
-
-							keyValueCount++;
-
-						} while (true);
+			swapIndex = storageIndex;
+			storageIndex = operandIndex;
+			operandIndex = swapIndex;
 
-						actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					}
-
-					//actionOperand points to a constant
-					else if (type == 0)
-					{
-
-						otherConstant = otherExpression.constants.get_FirstNode();
-						thisConstant = constants.get_FirstNode();
-
-						do
-						{
-
-							if (subtractionNode->content.get_ActionOperand() == &(otherConstant->content))
-								break;
-
-							otherConstant = otherConstant->get_NextNode();
-							thisConstant = thisConstant->get_NextNode();
-
-						} while (true);
-
-						actionOperand = &(thisConstant->content);
-
-					}
-
-					//actionOperand points to a variable which can be taken directly
-					//from subtractionNode because variables are stored externally;
-					else
-						actionOperand = subtractionNode->content.get_ActionOperand();
-
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
-
-					do
-					{
-
-						if (subtractionNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(subtractions.add_NewNode(
-						Subtract(storageOperand, actionOperand))->content);
-
-				}
-
-				//multiplication
-				else if (type == 3)
-				{
-
-					multiplicationNode = otherExpression.multiplications.get_FirstNode();
-
-					do
-					{
-
-						if (currentOperation == &multiplicationNode->content)
-							break;
-
-						multiplicationNode = multiplicationNode->get_NextNode();
-
-					} while (true);
-
-					//find action operand
-					type = multiplicationNode->content.get_ActionOperandType();
-
-					//actionOperand points to a keyValue
-					if (type == 2)
-					{
-
-						keyValueCount = 0;
-
-						do
-						{
-
-							if (multiplicationNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-								break;
-
-							keyValueCount++;
-
-						} while (true);
-
-						actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					}
-
-					//actionOperand points to a constant
-					else if (type == 0)
-					{
-
-						otherConstant = otherExpression.constants.get_FirstNode();
-						thisConstant = constants.get_FirstNode();
-
-						do
-						{
-
-							if (multiplicationNode->content.get_ActionOperand() == &(otherConstant->content))
-								break;
-
-							otherConstant = otherConstant->get_NextNode();
-							thisConstant = thisConstant->get_NextNode();
-
-						} while (true);
-
-						actionOperand = &(thisConstant->content);
-
-					}
-
-					//actionOperand points to a variable which can be taken directly
-					//from multiplicationNode because variables are stored externally;
-					else
-						actionOperand = multiplicationNode->content.get_ActionOperand();
-
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
-
-					do
-					{
-
-						if (multiplicationNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(multiplications.add_NewNode(
-						Multiply(storageOperand, actionOperand))->content);
-
-				}
-
-				//division
-				else if (type == 4)
-				{
-
-					divisionNode = otherExpression.divisions.get_FirstNode();
-
-					do
-					{
-
-						if (currentOperation == &divisionNode->content)
-							break;
-
-						divisionNode = divisionNode->get_NextNode();
-
-					} while (true);
-
-					//find action operand
-					type = divisionNode->content.get_ActionOperandType();
-
-					//actionOperand points to a keyValue
-					if (type == 2)
-					{
-
-						keyValueCount = 0;
-
-						do
-						{
-
-							if (divisionNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-								break;
-
-							keyValueCount++;
-
-						} while (true);
-
-						actionOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					}
-
-					//actionOperand points to a constant
-					else if (type == 0)
-					{
-
-						otherConstant = otherExpression.constants.get_FirstNode();
-						thisConstant = constants.get_FirstNode();
-
-						do
-						{
-
-							if (divisionNode->content.get_ActionOperand() == &(otherConstant->content))
-								break;
-
-							otherConstant = otherConstant->get_NextNode();
-							thisConstant = thisConstant->get_NextNode();
-
-						} while (true);
-
-						actionOperand = &(thisConstant->content);
-
-					}
-
-					//actionOperand points to a variable which can be taken directly
-					//from divsionNode because variables are stored externally;
-					else
-						actionOperand = divisionNode->content.get_ActionOperand();
-
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
-
-					do
-					{
-
-						if (divisionNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
-
-						keyValueCount++;
-
-					} while (true);
-
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
-
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(divisions.add_NewNode(
-						Divide(storageOperand, actionOperand))->content);
-
-				}
-
-				//exponent
-				else if (type == 5)
-				{
+		}
 
-					exponentNode = otherExpression.exponents.get_FirstNode();
+		description.kind = 3;
+		description.operationType = operationType;
+		description.firstIndex = storageIndex;
+		folding.operationType = operationType;
 
-					do
-					{
+		if (folding.test_Binary())
+			description.secondIndex = operandIndex;
 
-						if (currentOperation == &exponentNode->content)
-							break;
+		return sub_GetValueNumber(valueNumbers, valueNumberCount, description);
 
-						exponentNode = exponentNode->get_NextNode();
+	}
 
-					} while (true);
+	//appends an instruction to optimizedProgram (of which optimizedLength are in use)
+	void sub_EmitInstruction(ExtensibleArray<ExpressionInstruction> &optimizedProgram,
+		unsigned long long &optimizedLength, const unsigned char operationType,
+		const unsigned long long storageRegisterIndex, const unsigned long long operandRegisterIndex,
+		double * const *variableValueAddress, const unsigned long long variableIndex)
+	{
 
-					//find action operand
-					type = exponentNode->content.get_ActionOperandType();
+		ExpressionInstruction *instruction(optimizedProgram.get_ElementAddress(optimizedLength++));
 
-					//actionOperand points to a keyValue
-					if (type == 2)
-					{
+		instruction->operationType = operationType;
+		instruction->storageRegisterIndex = storageRegisterIndex;
+		instruction->operandRegisterIndex = operandRegisterIndex;
+		instruction->variableValueAddress = variableValueAddress;
+		instruction->variableIndex = variableIndex;
 
-						keyValueCount = 0;
+	}
 
-						do
-						{
+	//rewrites program, as sequenced from the written form, into an equivalent program which
+	//is usually shorter; values are numbered in program order (local value numbering),
+	//so that operations on constants are folded, operations repeating a value another
+	//register still holds become a copy of that register, operations leaving their
+	//storage operand unchanged (e.g. multiplying by 1) are dropped, and exponents of
+	//2, 3 and -1 become multiplies; instructions whose results are never read are then
+	//removed; every folded value is calculated as ExpressionInstruction::calculate()
+	//would at run time, so evaluate() returns exactly what the unoptimized program would
+	void sub_OptimizeProgram()
+	{
 
-							if (exponentNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-								break;
+		const unsigned long long keyValuesLength(keyValueCount);
+		const unsigned long long rawLength(program.get_ArrayLength());
+		ExtensibleArray<ExpressionInstruction> optimizedProgram(2 * rawLength + keyValuesLength + 1);
+		unsigned long long optimizedLength(0);
+		ExtensibleArray<ExpressionValueNumber> valueNumbers(keyValuesLength + 2 * rawLength + 2);
+		unsigned long long valueNumberCount(0);
+		ExtensibleArray<double> constantValues(rawLength + 1);
+		unsigned long long constantCount(0);
 
-							keyValueCount++;
+		ExtensibleArray<unsigned long long> registerValues(keyValuesLength); //value number of each register's current value
+		ExtensibleArray<bool> registerStored(keyValuesLength); //false if a register's (constant) value has not been written to it yet
+		ExtensibleArray<bool> initialContentRead(keyValuesLength); //true if the program reads a register's content before writing it
+		ExtensibleArray<bool> registerLive(keyValuesLength);
+		ExtensibleArray<bool> instructionLive(2 * rawLength + keyValuesLength + 1);
 
-						} while (true);
+		ExpressionValueNumber description;
+		const ExpressionInstruction *rawInstruction;
+		ExpressionInstruction *instruction;
+		unsigned long long storageIndex;
+		unsigned long long operandIndex;
+		unsigned long long resultIndex;
+		unsigned long long holderRegisterIndex;
+		unsigned long long operandRegisterIndex;
+		unsigned long long registerIndex;
+		unsigned long long liveLength(0);
+		unsigned long long count;
+		unsigned char operationType;
 
-						actionOperand = keyValues.get_ElementAddress(keyValueCount);
+		//each register starts with its content from before the program runs
+		for (registerIndex = 0; registerIndex < keyValuesLength; registerIndex++)
+		{
 
-					}
+			description.kind = 2;
+			description.firstIndex = registerIndex;
 
-					//actionOperand points to a constant
-					else if (type == 0)
-					{
+			*(registerValues.get_ElementAddress(registerIndex)) = sub_GetValueNumber(valueNumbers,
+				valueNumberCount, description);
+			*(registerStored.get_ElementAddress(registerIndex)) = true;
+			*(initialContentRead.get_ElementAddress(registerIndex)) = false;
 
-						otherConstant = otherExpression.constants.get_FirstNode();
-						thisConstant = constants.get_FirstNode();
+		}
 
-						do
-						{
+		//number values and emit the instructions still needed
+		for (count = 0; count < rawLength; count++)
+		{
 
-							if (exponentNode->content.get_ActionOperand() == &(otherConstant->content))
-								break;
+			rawInstruction = program.get_ElementAddress(count);
+			operationType = rawInstruction->operationType;
+			registerIndex = rawInstruction->storageRegisterIndex;
+			storageIndex = registerValues.get_Element(registerIndex);
 
-							otherConstant = otherConstant->get_NextNode();
-							thisConstant = thisConstant->get_NextNode();
+			//number the second operand
+			if (!rawInstruction->test_Binary())
+				operandIndex = storageIndex;
 
-						} while (true);
+			else if (rawInstruction->variableValueAddress)
+			{
 
-						actionOperand = &(thisConstant->content);
+				description = ExpressionValueNumber();
+				description.kind = 1;
+				description.firstIndex = rawInstruction->variableIndex;
+				description.variableValueAddress = rawInstruction->variableValueAddress;
 
-					}
+				operandIndex = sub_GetValueNumber(valueNumbers, valueNumberCount, description);
 
-					//actionOperand points to a variable which can be taken directly
-					//from divsionNode because variables are stored externally;
-					else
-						actionOperand = exponentNode->content.get_ActionOperand();
+			}
 
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
+			else if (rawInstruction->operandRegisterIndex >= keyValuesLength)
+				operandIndex = sub_GetConstantValueNumber(valueNumbers, valueNumberCount,
+					registers.get_Element(rawInstruction->operandRegisterIndex));
 
-					do
-					{
+			else
+				operandIndex = registerValues.get_Element(rawInstruction->operandRegisterIndex);
 
-						if (exponentNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
+			//note reads of content from before the program runs
+			if (operationType && valueNumbers.get_ElementAddress(storageIndex)->kind == 2)
+				*(initialContentRead.get_ElementAddress(valueNumbers.get_ElementAddress(storageIndex)->firstIndex)) = true;
 
-						keyValueCount++;
+			if (valueNumbers.get_ElementAddress(operandIndex)->kind == 2)
+				*(initialContentRead.get_ElementAddress(valueNumbers.get_ElementAddress(operandIndex)->firstIndex)) = true;
 
-					} while (true);
+			resultIndex = sub_NumberOperation(valueNumbers, valueNumberCount, operationType,
+				storageIndex, operandIndex);
 
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
+			//constants are only written to a register once they are needed there
+			if (valueNumbers.get_ElementAddress(resultIndex)->kind == 0)
+			{
 
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(exponents.add_NewNode(
-						IntegerExponent(storageOperand, actionOperand))->content);
+				*(registerValues.get_ElementAddress(registerIndex)) = resultIndex;
+				*(registerStored.get_ElementAddress(registerIndex)) = false;
 
-				}
+				continue;
 
-				//root
-				else if (type == 6)
-				{
+			}
 
-					rootNode = otherExpression.roots.get_FirstNode();
+			//the register already holds the result
+			if (resultIndex == storageIndex)
+				continue;
 
-					do
-					{
+			holderRegisterIndex = valueNumbers.get_ElementAddress(resultIndex)->holderRegisterIndex;
 
-						if (currentOperation == &rootNode->content)
-							break;
+			//another register still holds the result, copy it
+			if (holderRegisterIndex && holderRegisterIndex - 1 != registerIndex
+				&& registerValues.get_Element(holderRegisterIndex - 1) == resultIndex)
+				sub_EmitInstruction(optimizedProgram, optimizedLength, 0, registerIndex,
+					holderRegisterIndex - 1, NULL, 0);
 
-						rootNode = rootNode->get_NextNode();
+			else
+			{
 
-					} while (true);
+				//write a pending constant storage operand first
+				if (operationType && !registerStored.get_Element(registerIndex))
+					sub_EmitInstruction(optimizedProgram, optimizedLength, 0, registerIndex,
+						sub_GetConstantRegister(constantValues, constantCount,
+						valueNumbers.get_ElementAddress(storageIndex)->constantValue), NULL, 0);
 
-					//find action operand
-					type = rootNode->content.get_ActionOperandType();
+				//registers not holding constants hold their values, so the raw operand
+				//register is still valid
+				operandRegisterIndex = rawInstruction->operandRegisterIndex;
 
-					//actionOperand points to a keyValue
-					if (type == 2)
-					{
+				if (!rawInstruction->test_Binary() || operationType > 6)
+					operandRegisterIndex = registerIndex;
 
-						keyValueCount = 0;
+				else if (valueNumbers.get_ElementAddress(operandIndex)->kind == 0)
+					operandRegisterIndex = sub_GetConstantRegister(constantValues, constantCount,
+						valueNumbers.get_ElementAddress(operandIndex)->constantValue);
 
-						do
-						{
+				if (operationType <= 6 && valueNumbers.get_ElementAddress(operandIndex)->kind == 1)
+					sub_EmitInstruction(optimizedProgram, optimizedLength, operationType, registerIndex,
+						registerIndex, valueNumbers.get_ElementAddress(operandIndex)->variableValueAddress,
+						valueNumbers.get_ElementAddress(operandIndex)->firstIndex);
 
-							if (rootNode->content.get_ActionOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-								break;
+				else
+					sub_EmitInstruction(optimizedProgram, optimizedLength, operationType, registerIndex,
+						operandRegisterIndex, NULL, 0);
 
-							keyValueCount++;
+			}
 
-						} while (true);
+			*(registerValues.get_ElementAddress(registerIndex)) = resultIndex;
+			*(registerStored.get_ElementAddress(registerIndex)) = true;
+			valueNumbers.get_ElementAddress(resultIndex)->holderRegisterIndex = registerIndex + 1;
 
-						actionOperand = keyValues.get_ElementAddress(keyValueCount);
+		}
 
-					}
+		//the result, and any register whose content carries over between evaluations,
+		//must be written by the end
+		for (registerIndex = 0; registerIndex < keyValuesLength; registerIndex++)
+		{
 
-					//actionOperand points to a constant
-					else if (type == 0)
-					{
+			*(registerLive.get_ElementAddress(registerIndex)) = (!registerIndex
+				|| initialContentRead.get_Element(registerIndex));
 
-						otherConstant = otherExpression.constants.get_FirstNode();
-						thisConstant = constants.get_FirstNode();
+			if (registerLive.get_Element(registerIndex) && !registerStored.get_Element(registerIndex))
+				sub_EmitInstruction(optimizedProgram, optimizedLength, 0, registerIndex,
+					sub_GetConstantRegister(constantValues, constantCount, valueNumbers.get_ElementAddress(
+					registerValues.get_Element(registerIndex))->constantValue), NULL, 0);
 
-						do
-						{
+		}
 
-							if (rootNode->content.get_ActionOperand() == &(otherConstant->content))
-								break;
+		//remove instructions whose results are never read (working backwards)
+		for (count = optimizedLength; count > 0; count--)
+		{
 
-							otherConstant = otherConstant->get_NextNode();
-							thisConstant = thisConstant->get_NextNode();
+			instruction = optimizedProgram.get_ElementAddress(count - 1);
+			registerIndex = instruction->storageRegisterIndex;
 
-						} while (true);
+			*(instructionLive.get_ElementAddress(count - 1)) = registerLive.get_Element(registerIndex);
 
-						actionOperand = &(thisConstant->content);
+			if (!registerLive.get_Element(registerIndex))
+				continue;
 
-					}
+			liveLength++;
 
-					//actionOperand points to a variable which can be taken directly
-					//from divsionNode because variables are stored externally;
-					else
-						actionOperand = rootNode->content.get_ActionOperand();
+			//an assignment does not read its storage operand
+			if (!instruction->operationType)
+				*(registerLive.get_ElementAddress(registerIndex)) = false;
 
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
+			if (instruction->test_Binary() && !instruction->variableValueAddress
+				&& instruction->operandRegisterIndex < keyValuesLength)
+				*(registerLive.get_ElementAddress(instruction->operandRegisterIndex)) = true;
 
-					do
-					{
+		}
 
-						if (rootNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
+		//replace program and registers
+		if (liveLength)
+			program.resize_NoCopy(liveLength);
 
-						keyValueCount++;
+		else
+			program = ExtensibleArray<ExpressionInstruction>();
 
-					} while (true);
+		liveLength = 0;
 
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
+		for (count = 0; count < optimizedLength; count++)
+		{
 
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(roots.add_NewNode(
-						IntegerRoot(storageOperand, actionOperand))->content);
+			if (instructionLive.get_Element(count))
+				*(program.get_ElementAddress(liveLength++)) = optimizedProgram.get_Element(count);
 
-				}
+		}
 
-				//negative
-				else if (type == 7)
-				{
+		registers.resize_NoCopy(keyValuesLength + constantCount);
 
-					negativeNode = otherExpression.negatives.get_FirstNode();
+		//key values start as Temporary_Double does
+		for (registerIndex = 0; registerIndex < keyValuesLength; registerIndex++)
+			*(registers.get_ElementAddress(registerIndex)) = 1.0;
 
-					do
-					{
+		for (count = 0; count < constantCount; count++)
+			*(registers.get_ElementAddress(keyValuesLength + count)) = constantValues.get_Element(count);
 
-						if (currentOperation == &negativeNode->content)
-							break;
+	}
 
-						negativeNode = negativeNode->get_NextNode();
+public:
 
-					} while (true);
+	//default constructor
+	Expression_Double()
+	{
 
-					//find storage operand (always points to a keyValue)
-					keyValueCount = 0;
+		sub_SetNullState();
 
-					do
-					{
+	}
 
-						if (negativeNode->content.get_StorageOperand() == otherExpression.keyValues.get_ElementAddress(keyValueCount))
-							break;
+	//modified constructor
+	Expression_Double(Word &aWrittenForm,
+		UniformList<Variable_Double> &initializedVariables)
+	{
 
-						keyValueCount++;
+		initialize(aWrittenForm, initializedVariables);
 
-					} while (true);
+	}
 
-					storageOperand = keyValues.get_ElementAddress(keyValueCount);
+	//copy constructor; program refers to registers and variables by index, so the
+	//copy is made member by member (copies refer to the same variables, see
+	//rebind_Variables(), and are interpreted, see attach_NativeFunction())
+	Expression_Double(const Expression_Double& otherExpression) : writtenForm(otherExpression.writtenForm),
+		keyValueCount(otherExpression.keyValueCount), program(otherExpression.program),
+		registers(otherExpression.registers), variables(otherExpression.variables),
+		variablePositions(otherExpression.variablePositions),
+		variableValueAddresses(otherExpression.variableValueAddresses),
+		variableFrameStrideAddresses(otherExpression.variableFrameStrideAddresses), nativeFunction(NULL) {}
 
-					//add create the new operation
-					*(operations.get_ElementAddress(opperationCount)) = &(negatives.add_NewNode(
-						Negative(storageOperand))->content);
+	//copy assignement operator (see copy constructor)
+	Expression_Double& operator=(Expression_Double const& otherExpression)
+	{
 
-				}
+		if (this != &otherExpression)
+		{
 
-			}
+			writtenForm = otherExpression.writtenForm;
+			keyValueCount = otherExpression.keyValueCount;
+			program = otherExpression.program;
+			registers = otherExpression.registers;
+			variables = otherExpression.variables;
+			variablePositions = otherExpression.variablePositions;
+			variableValueAddresses = otherExpression.variableValueAddresses;
+			variableFrameStrideAddresses = otherExpression.variableFrameStrideAddresses;
+			nativeFunction = NULL;
 
 		}
 
@@ -2582,25 +2223,7 @@ public:
 		if(!sub_Initialize_ValidateSyntax(aWrittenForm, components, initializedVariables))
 		{
 
-			constants.delete_WholeList();
-
-			negatives.delete_WholeList();
-			assignments.delete_WholeList();
-			additions.delete_WholeList();
-			subtractions.delete_WholeList();
-			multiplications.delete_WholeList();
-			divisions.delete_WholeList();
-			exponents.delete_WholeList();
-			roots.delete_WholeList();
-
-			writtenForm = "0";
-			operations.resize_NoCopy(1);
-			keyValues.resize_NoCopy(1);
-
-			constants.add_NewNode(Constant_Double(0));
-
-			*(operations.get_ElementAddress(0)) = &(assignments.add_NewNode(Assign(
-				keyValues.get_ElementAddress(0), &(constants.get_FirstNode()->content)))->content);
+			sub_SetNullState();
 
 			return false;
 
@@ -2792,18 +2415,10 @@ public:
 		if (!aWrittenForm.test_ListPopulated())
 			return false;
 
-		//delete any content of the current storage lists
-		//(in case this expression has been previously populated)
+		//delete any content of the constants list
+		//(in case a previous validation failed)
 		constants.delete_WholeList();
 
-		negatives.delete_WholeList();
-		additions.delete_WholeList();
-		subtractions.delete_WholeList();
-		multiplications.delete_WholeList();
-		divisions.delete_WholeList();
-		exponents.delete_WholeList();
-		roots.delete_WholeList();
-
 		//syntax validation setup
 		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
 		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("()+*-/^#", 0));
@@ -2872,7 +2487,7 @@ public:
 
 				//test for variable
 				else if (workingCopy.validateWordNode_AlphaNumeric(wordNode, false, false)
-					|| workingCopy.validateWordNode_AlphaNumericIndexed(wordNode, false, false))
+					|| workingCopy.validateWordNode_IndexedAlphaNumericVariable(wordNode, false, false))
 				{
 
 					//test whether the found variable is in the initializedVariables
@@ -3221,13 +2836,13 @@ public:
 	{
 
 		//initial setup
-		unsigned char keyValueIndex(0);
-		unsigned char keyValueMax(0);
+		unsigned long long keyValueIndex(0);
+		unsigned long long keyValueMax(0);
 		BranchingNode<ComponentNode> *currentNode(components.get_FirstElder());
 		BranchingNode<ComponentNode> *currentParentNode(NULL);
 		bool concluded(false);
 
-		//assign keyValue indices to components and resize keyValues array
+		//assign keyValue indices to components and count keyValues
 		do
 		{
 
@@ -3302,19 +2917,20 @@ public:
 
 		} while (!concluded);
 
-		keyValues.resize_NoCopy(keyValueMax + 1);
+		keyValueCount = keyValueMax + 1;
 
-		//additional initial setup for initializing operations
-		UniformList<Operator*> tempOperations;
+		//additional initial setup for sequencing instructions
+		UniformList<ExpressionInstruction> rawProgram;
+		UniformList<double> rawConstants;
+		UniformList<Variable_Double*> rawVariables;
 		unsigned char typeCode;
-		SimpleComponent *storageComponent;
-		SimpleComponent *actionComponent(NULL); //initialized only to make compiler happy
+		unsigned long long actionIndex(0); //keyValue index of the action operand of complex components
 		bool frozenActionValue(false);
 
 		currentNode = components.get_FirstElder();
 		currentParentNode = NULL;
 
-		//initialize operations
+		//sequence instructions
 		do
 		{
 
@@ -3327,64 +2943,33 @@ public:
 				if (currentParentNode)
 				{
 					
-					//set actionComponent to parentNode's last child's keyValue if actionComponent
+					//set actionIndex to parentNode's last child's keyValue if actionIndex
 					//is not already frozen (last child should never be NULL)
 					if(!frozenActionValue)
-						actionComponent = keyValues.get_ElementAddress(
-							currentParentNode->get_LastChild()->content.get_KeyValueIndex());
-
-					//set storageComponent to parentNode's keyValue
-					storageComponent = keyValues.get_ElementAddress(
-						currentParentNode->content.get_KeyValueIndex());
+						actionIndex = currentParentNode->get_LastChild()->content.get_KeyValueIndex();
 
 					typeCode = currentParentNode->content.get_OperationType();
 
 					//test for negative
 					if (currentParentNode->content.get_Type() == 4)
-						tempOperations.add_NewNode(&(negatives.add_NewNode(
-							Negative(actionComponent))->content));
+						sub_SequenceInstruction(rawProgram, rawConstants, rawVariables, 7,
+							actionIndex, NULL, actionIndex);
 
 					//currentParentNode is a first child so assignment
 					//can be skipped so long as the the next non-assignment operation's
-					//actionComponent refers to the last child's storageComponent; //freeze
-					//actionComponent for later use by the next mandatory operation;
+					//action operand refers to the last child's keyValue; freeze
+					//actionIndex for later use by the next mandatory operation;
 					if (typeCode == 0)
 						frozenActionValue = true;
 
+					//the operation on parentNode's keyValue
 					else
 					{
 
 						frozenActionValue = false;
 
-						//addition
-						if (typeCode == 1)
-							tempOperations.add_NewNode(&(additions.add_NewNode(
-								Add(storageComponent, actionComponent))->content));
-
-						//subtraction
-						else if (typeCode == 2)
-							tempOperations.add_NewNode(&(subtractions.add_NewNode(
-								Subtract(storageComponent, actionComponent))->content));
-
-						//multiplication
-						else if (typeCode == 3)
-							tempOperations.add_NewNode(&(multiplications.add_NewNode(
-								Multiply(storageComponent, actionComponent))->content));
-
-						//division
-						else if (typeCode == 4)
-							tempOperations.add_NewNode(&(divisions.add_NewNode(
-								Divide(storageComponent, actionComponent))->content));
-
-						//exponent
-						else if (typeCode == 5)
-							tempOperations.add_NewNode(&(exponents.add_NewNode(
-								IntegerExponent(storageComponent, actionComponent))->content));
-
-						//root
-						else //(typeCode == 6)
-							tempOperations.add_NewNode(&(roots.add_NewNode(
-								IntegerRoot(storageComponent, actionComponent))->content));
+						sub_SequenceInstruction(rawProgram, rawConstants, rawVariables, typeCode,
+							currentParentNode->content.get_KeyValueIndex(), NULL, actionIndex);
 
 					}
 
@@ -3394,17 +2979,17 @@ public:
 
 				}
 
-				//the proceedure is concluded; copy operations and return
+				//the proceedure is concluded; compile the program and return
 				else
 				{
 
-					//add a final assignment of the froze actionComponent to keyValues[0]
+					//add a final assignment of the frozen actionIndex to keyValues[0]
 					//to set up the expression for evaluate()
 					if (frozenActionValue)
-						tempOperations.add_NewNode(&(assignments.add_NewNode(
-							Assign(keyValues.get_ElementAddress(0), actionComponent))->content));
+						sub_SequenceInstruction(rawProgram, rawConstants, rawVariables, 0,
+							0, NULL, actionIndex);
 
-					operations = tempOperations;
+					sub_CompileProgram(rawProgram, rawConstants, rawVariables, initializedVariables);
 					return;
 
 				}
@@ -3429,74 +3014,476 @@ public:
 
 				frozenActionValue = false;
 
-				storageComponent = keyValues.get_ElementAddress(currentNode->content.get_KeyValueIndex());
-
 				//this should work for either constants or variables
-				actionComponent = currentNode->content.get_AssociatedSimpleComponent();
+				sub_SequenceInstruction(rawProgram, rawConstants, rawVariables,
+					currentNode->content.get_OperationType(), currentNode->content.get_KeyValueIndex(),
+					currentNode->content.get_AssociatedSimpleComponent(), 0);
 
-				typeCode = currentNode->content.get_OperationType();
+				//move laterally by one node
+				currentNode = currentNode->get_NextSibling();
 
-				//assignment
-				if (typeCode == 0)
-					tempOperations.add_NewNode(&(assignments.add_NewNode(
-						Assign(storageComponent, actionComponent))->content));
+			}
 
-				//addition
-				else if (typeCode == 1)
-					tempOperations.add_NewNode(&(additions.add_NewNode(
-						Add(storageComponent, actionComponent))->content));
+		} while (true);
 
-				//subtraction
-				else if (typeCode == 2)
-					tempOperations.add_NewNode(&(subtractions.add_NewNode(
-						Subtract(storageComponent, actionComponent))->content));
+	}
 
-				//multiplication
-				else if (typeCode == 3)
-					tempOperations.add_NewNode(&(multiplications.add_NewNode(
-						Multiply(storageComponent, actionComponent))->content));
+	//returns the calculated value of the expression for data frame frameIndex (which
+	//only matters to variables with a frame stride, see Variable_Double::set_FrameStride());
+	//runs program
+	double evaluate(const unsigned long long frameIndex = 0)
+	{
 
-				//division
-				else if (typeCode == 4)
-					tempOperations.add_NewNode(&(divisions.add_NewNode(
-						Divide(storageComponent, actionComponent))->content));
+		if (nativeFunction)
+			return nativeFunction(registers.get_ElementAddress(0), variableValueAddresses.get_ElementAddress(0),
+				variableFrameStrideAddresses.get_ElementAddress(0), frameIndex, integerExponent, integerRoot);
 
-				//exponent
-				else if (typeCode == 5)
-					tempOperations.add_NewNode(&(exponents.add_NewNode(
-						IntegerExponent(storageComponent, actionComponent))->content));
+		double * const registerFile(registers.get_ElementAddress(0));
+		const ExpressionInstruction *instruction(program.get_ElementAddress(0));
+		const ExpressionInstruction * const programEnd(instruction + program.get_ArrayLength());
+		double *storage;
 
-				//root
-				else //(typeCode == 6)
-					tempOperations.add_NewNode(&(roots.add_NewNode(
-						IntegerRoot(storageComponent, actionComponent))->content));
+		for (; instruction != programEnd; instruction++)
+		{
 
-				//move laterally by one node
-				currentNode = currentNode->get_NextSibling();
+			storage = registerFile + instruction->storageRegisterIndex;
+
+			if (instruction->variableValueAddress)
+				*storage = instruction->calculate(*storage, (*(instruction->variableValueAddress))[
+					frameIndex * *(instruction->variableFrameStrideAddress)]);
+
+			else
+				*storage = instruction->calculate(*storage, registerFile[instruction->operandRegisterIndex]);
+
+		}
+
+		return registerFile[0];
+
+	}
+
+	//sets storage[lane] to the result of operationType on storage[lane] and operand[lane]
+	//(see ExpressionInstruction::calculate()) for each of laneCount lanes; each case is
+	//a simple loop so the arithmetic operations vectorize
+	void sub_CalculateLanes(const unsigned char operationType, double *storage, const double *operand,
+		const unsigned short laneCount)
+	{
+
+		unsigned short lane;
+
+		switch (operationType)
+		{
+
+		case 0:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] = operand[lane];
+			break;
+
+		case 1:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] += operand[lane];
+			break;
+
+		case 2:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] -= operand[lane];
+			break;
+
+		case 3:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] *= operand[lane];
+			break;
+
+		case 4:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] /= operand[lane];
+			break;
+
+		case 5:
+			integerExponent_Batch(storage, operand, laneCount);
+			break;
+
+		case 6:
+			integerRoot_Batch(storage, operand, laneCount);
+			break;
+
+		case 7:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] = -storage[lane];
+			break;
+
+		case 8:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] = storage[lane] * storage[lane];
+			break;
+
+		case 9:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] = storage[lane] * storage[lane] * storage[lane];
+			break;
+
+		default:
+			for (lane = 0; lane < laneCount; lane++)
+				storage[lane] = 1.0 / storage[lane];
+
+		}
+
+	}
+
+	//evaluates the expression batchLength times, writing result i to results[i] (an
+	//array of at least batchLength doubles); in evaluation i, each variable with a
+	//column in variableColumns takes that column's value i, other variables keep their
+	//current values (those of data frame frameIndex); each evaluation returns what
+	//evaluate() would, but the state evaluate() carries between calls is left unchanged;
+	//the program is run one instruction at a time over blocks of batchBlockLength
+	//evaluations, so the cost of interpreting it is shared by the block
+	void evaluate_Batch(const ExtensibleArray<VariableColumn> &variableColumns,
+		const unsigned long long batchLength, double *results, const unsigned long long frameIndex = 0)
+	{
+
+		const unsigned long long programLength(program.get_ArrayLength());
+		const unsigned long long registersLength(registers.get_ArrayLength());
+		const unsigned long long keyValuesLength(keyValueCount);
+		const unsigned long long columnsLength(variableColumns.get_ArrayLength());
+
+		//rows of batchBlockLength lanes: one per register, then one per column
+		//(gathered when its stride is not 1), then one per instruction whose
+		//operand is a variable without a column (its value repeated)
+		const unsigned long long rowsLength(registersLength + columnsLength + programLength);
+		ExtensibleArray<double> laneRows(rowsLength * batchBlockLength);
+
+		//per instruction, the row its operand is read from; values >= rowsLength
+		//mean the contiguous column at (value - rowsLength) is read directly
+		ExtensibleArray<unsigned long long> operandRows(programLength);
+
+		const ExpressionInstruction *instruction;
+		const VariableColumn *column;
+		double *row;
+		unsigned long long blockStart;
+		unsigned long long count;
+		unsigned long long columnCount;
+		unsigned long long operandRow;
+		unsigned short laneCount;
+		unsigned short lane;
+
+		//constants are the same in every lane
+		for (count = keyValuesLength; count < registersLength; count++)
+		{
+
+			row = laneRows.get_ElementAddress(count * batchBlockLength);
+
+			for (lane = 0; lane < batchBlockLength; lane++)
+				row[lane] = registers.get_Element(count);
+
+		}
+
+		//resolve operands
+		for (count = 0; count < programLength; count++)
+		{
+
+			instruction = program.get_ElementAddress(count);
+
+			if (!instruction->variableValueAddress)
+			{
+
+				*(operandRows.get_ElementAddress(count)) = instruction->operandRegisterIndex;
+				continue;
 
 			}
 
-		} while (true);
+			for (columnCount = 0; columnCount < columnsLength; columnCount++)
+			{
+
+				if (variableColumns.get_ElementAddress(columnCount)->variable->get_ValueAddress()
+					== instruction->variableValueAddress)
+					break;
+
+			}
+
+			if (columnCount < columnsLength)
+			{
+
+				if (variableColumns.get_ElementAddress(columnCount)->stride == 1)
+					*(operandRows.get_ElementAddress(count)) = rowsLength + columnCount;
+
+				else
+					*(operandRows.get_ElementAddress(count)) = registersLength + columnCount;
+
+			}
+
+			//a variable without a column keeps its current value
+			else
+			{
+
+				*(operandRows.get_ElementAddress(count)) = registersLength + columnsLength + count;
+				row = laneRows.get_ElementAddress((registersLength + columnsLength + count) * batchBlockLength);
+
+				for (lane = 0; lane < batchBlockLength; lane++)
+					row[lane] = (*(instruction->variableValueAddress))[
+						frameIndex * *(instruction->variableFrameStrideAddress)];
+
+			}
+
+		}
+
+		for (blockStart = 0; blockStart < batchLength; blockStart += batchBlockLength)
+		{
+
+			if (batchLength - blockStart < batchBlockLength)
+				laneCount = batchLength - blockStart;
+
+			else
+				laneCount = batchBlockLength;
+
+			//every lane starts from the current key values
+			for (count = 0; count < keyValuesLength; count++)
+			{
+
+				row = laneRows.get_ElementAddress(count * batchBlockLength);
+
+				for (lane = 0; lane < laneCount; lane++)
+					row[lane] = registers.get_Element(count);
+
+			}
+
+			//gather strided columns
+			for (columnCount = 0; columnCount < columnsLength; columnCount++)
+			{
+
+				column = variableColumns.get_ElementAddress(columnCount);
+
+				if (column->stride == 1)
+					continue;
+
+				row = laneRows.get_ElementAddress((registersLength + columnCount) * batchBlockLength);
+
+				for (lane = 0; lane < laneCount; lane++)
+					row[lane] = column->values[(blockStart + lane) * column->stride];
+
+			}
+
+			//run the program over the block
+			for (count = 0; count < programLength; count++)
+			{
+
+				instruction = program.get_ElementAddress(count);
+				operandRow = operandRows.get_Element(count);
+
+				if (operandRow < rowsLength)
+					sub_CalculateLanes(instruction->operationType, laneRows.get_ElementAddress(
+						instruction->storageRegisterIndex * batchBlockLength),
+						laneRows.get_ElementAddress(operandRow * batchBlockLength), laneCount);
+
+				else
+					sub_CalculateLanes(instruction->operationType, laneRows.get_ElementAddress(
+						instruction->storageRegisterIndex * batchBlockLength),
+						variableColumns.get_ElementAddress(operandRow - rowsLength)->values + blockStart, laneCount);
+
+			}
+
+			row = laneRows.get_ElementAddress(0);
+
+			for (lane = 0; lane < laneCount; lane++)
+				results[blockStart + lane] = row[lane];
+
+		}
 
 	}
 
-	//returns the calculated value of the expression
-	double evaluate()
+	//writes program to output as the C++ source of a function named
+	//nn_expression_<functionIndex> of type NativeExpressionFunction, which works on
+	//copies of the key value registers and stores them back at the end, so it leaves
+	//the same state as evaluate(); the source relies only on IEEE 754 double arithmetic
+	//and is exact when compiled without floating point contraction or fast math;
+	//variables are read by index, so the function also serves copies of this
+	//expression rebound to other variables (see rebind_Variables())
+	void output_NativeFunction(ostream &output, const unsigned long long functionIndex)
 	{
 
-		unsigned char operationsLength(operations.get_ArrayLength());
-		unsigned char count(0);
+		const unsigned long long keyValuesLength(keyValueCount);
+		const unsigned long long programLength(program.get_ArrayLength());
+		const ExpressionInstruction *instruction;
+		unsigned long long count;
 
-		do
+		output << "\n//";
+
+		for (UniformNode<char> *charNode = writtenForm.get_FirstNode(); charNode; charNode = charNode->get_NextNode())
+			output << charNode->content;
+
+		output << "\nextern \"C\" double nn_expression_" << functionIndex;
+		output << "(double *r, double * const * const *v, const unsigned long long * const *s, unsigned long long f, ";
+		output << "double (*integerExponent)(double, double), double (*integerRoot)(double, double))\n{\n";
+
+		for (count = 0; count < keyValuesLength; count++)
+			output << "\n\tdouble k" << count << "(r[" << count << "]);";
+
+		output << '\n';
+
+		for (count = 0; count < programLength; count++)
+		{
+
+			instruction = program.get_ElementAddress(count);
+
+			output << "\n\tk" << instruction->storageRegisterIndex << " = ";
+
+			if (instruction->operationType == 0)
+				sub_OutputNativeOperand(output, *instruction);
+
+			else if (instruction->operationType >= 1 && instruction->operationType <= 4)
+			{
+
+				output << 'k' << instruction->storageRegisterIndex << ' ';
+				output << "+-*/"[instruction->operationType - 1] << ' ';
+				sub_OutputNativeOperand(output, *instruction);
+
+			}
+
+			else if (instruction->operationType == 5 || instruction->operationType == 6)
+			{
+
+				if (instruction->operationType == 5)
+					output << "integerExponent(k";
+
+				else
+					output << "integerRoot(k";
+
+				output << instruction->storageRegisterIndex << ", ";
+				sub_OutputNativeOperand(output, *instruction);
+				output << ')';
+
+			}
+
+			else if (instruction->operationType == 7)
+				output << "-k" << instruction->storageRegisterIndex;
+
+			else if (instruction->operationType == 8)
+				output << 'k' << instruction->storageRegisterIndex << " * k" << instruction->storageRegisterIndex;
+
+			else if (instruction->operationType == 9)
+				output << 'k' << instruction->storageRegisterIndex << " * k" << instruction->storageRegisterIndex
+					<< " * k" << instruction->storageRegisterIndex;
+
+			else
+				output << "1.0 / k" << instruction->storageRegisterIndex;
+
+			output << ';';
+
+		}
+
+		output << '\n';
+
+		for (count = 0; count < keyValuesLength; count++)
+			output << "\n\tr[" << count << "] = k" << count << ';';
+
+		output << "\n\n\treturn k0;\n\n}\n";
+
+	}
+
+	//returns true if aNativeFunction (compiled from output_NativeFunction()) calculates
+	//the same value, and leaves the same registers, as program does from the current
+	//registers and variable values (of the first data frame); the registers are left
+	//as they were
+	bool test_NativeFunction(NativeExpressionFunction aNativeFunction)
+	{
+
+		const ExtensibleArray<double> startRegisters(registers);
+		ExtensibleArray<double> programRegisters;
+		const NativeExpressionFunction attachedFunction(nativeFunction);
+		double programValue;
+		double nativeValue;
+		bool matched;
+
+		nativeFunction = NULL;
+		programValue = evaluate();
+		programRegisters = registers;
+
+		registers = startRegisters;
+		nativeValue = aNativeFunction(registers.get_ElementAddress(0), variableValueAddresses.get_ElementAddress(0),
+			variableFrameStrideAddresses.get_ElementAddress(0), 0, integerExponent, integerRoot);
+
+		matched = sub_TestSameValue(programValue, nativeValue);
+
+		for (unsigned long long count = 0; matched && count < keyValueCount; count++)
+			matched = sub_TestSameValue(programRegisters.get_Element(count), registers.get_Element(count));
+
+		registers = startRegisters;
+		nativeFunction = attachedFunction;
+
+		return matched;
+
+	}
+
+	//evaluate() calls aNativeFunction (compiled from output_NativeFunction() of this
+	//expression, as it is now) in place of interpreting program; assumes aNativeFunction
+	//stays loaded until it is detached; rebuilding or copying an expression detaches it
+	void attach_NativeFunction(NativeExpressionFunction aNativeFunction)
+	{
+
+		nativeFunction = aNativeFunction;
+
+	}
+
+	//evaluate() interprets program again
+	void detach_NativeFunction()
+	{
+
+		nativeFunction = NULL;
+
+	}
+
+	//rebinds the expression (generally a copy made for another thread) to newVariables,
+	//a list of the same variables in the same order as the list used in initialize()
+	//(e.g. a copy of it referring to other doubles): each variable the expression
+	//refers to is replaced by the one at its position in newVariables, in time linear
+	//in the lengths of program and newVariables; an attached native function stays
+	//attached; returns false, leaving the expression unchanged, if newVariables is too short
+	bool rebind_Variables(UniformList<Variable_Double> &newVariables)
+	{
+
+		const unsigned long long variablesLength(variables.get_ArrayLength());
+		const unsigned long long newVariablesLength(newVariables.get_ListLength());
+		ExtensibleArray<Variable_Double*> newVariableAddresses;
+		UniformNode<Variable_Double> *variableNode(newVariables.get_FirstNode());
+		unsigned long long count;
+
+		if (!variablesLength)
+			return true;
+
+		for (count = 0; count < variablesLength; count++)
 		{
 
-			operations.get_Element(count)->calculate();
+			if (variablePositions.get_Element(count) >= newVariablesLength)
+				return false;
+
+		}
+
+		newVariableAddresses.resize_NoCopy(newVariablesLength);
+
+		for (count = 0; variableNode; variableNode = variableNode->get_NextNode())
+			*(newVariableAddresses.get_ElementAddress(count++)) = &(variableNode->content);
+
+		for (count = 0; count < variablesLength; count++)
+			*(variables.get_ElementAddress(count)) = newVariableAddresses.get_Element(variablePositions.get_Element(count));
+
+		sub_BindProgramVariables();
+
+		return true;
+
+	}
+
+	//returns true if component (generally a Variable_Double from the list
+	//used in initialize()) is an operand of any operation in this expression
+	bool test_RefersToComponent(SimpleComponent *component)
+	{
+
+		for (unsigned long long count = 0; count < variables.get_ArrayLength(); count++)
+		{
 
-			count++;
+			if (variables.get_Element(count) == component)
+				return true;
 
-		} while (count < operationsLength);
+		}
 
-		return keyValues.get_ElementAddress(0)->get_Value();
+		return false;
 
 	}
 
@@ -0,0 +1,318 @@
+
+#include <cmath>
+#include <cfloat>
+#include "MathTools.h"
+#include "RandomTools.h"
+
+using namespace std;
+
+//standalone check of squareRoot(), integerExponent(), integerRoot() and their batch
+//versions against reference values and against the iterative implementations they
+//replaced; built separately from main.cpp (g++ -std=c++17 -O2 -o MathToolsCheck
+//MathToolsCheck.cpp), returns 0 if every check passes
+
+//number of checks which failed so far
+unsigned int failureCount(0);
+
+//returns true if value is within relativeTolerance of referenceValue (both NaN counts
+//as a match, so NaN results can be checked too)
+bool test_Matches(const double value, const double referenceValue, const double relativeTolerance)
+{
+
+	if (referenceValue != referenceValue)
+		return (value != value);
+
+	//exact matches include infinities
+	if (value == referenceValue)
+		return true;
+
+	if (value != value)
+		return false;
+
+	if (referenceValue == 0.0)
+		return (fabs(value) <= relativeTolerance);
+
+	return (fabs(value - referenceValue) <= relativeTolerance * fabs(referenceValue));
+
+}
+
+//counts and reports a failed check
+void check(const char *checkName, const double value, const double referenceValue,
+	const double relativeTolerance)
+{
+
+	if (test_Matches(value, referenceValue, relativeTolerance))
+		return;
+
+	failureCount++;
+
+	cout << "\nfailed: " << checkName << " returned " << value << ", expected " << referenceValue;
+
+}
+
+//***replaced implementations, kept as references***
+
+//the Newton iteration squareRoot() ran before it used the hardware square root
+double oldSquareRoot(const double squaredValue, const unsigned char iterationCount)
+{
+
+	double tempDouble = 1.0;
+
+	for (unsigned char count = 0; count < iterationCount; count++)
+		tempDouble = 0.5 * (tempDouble + (squaredValue / tempDouble));
+
+	return tempDouble;
+
+}
+
+//the repeated multiplication IntegerExponent::calculate() ran before
+//exponentiation by squaring
+double oldIntegerExponent(const double baseValue, const double powerValue)
+{
+
+	long long power(roundToInteger(powerValue));
+
+	if (power == 0)
+		return 1.0;
+
+	double calculatedValue(baseValue);
+
+	//positive exponent
+	if (power > 0)
+	{
+
+		while (power > 1)
+		{
+
+			calculatedValue *= baseValue;
+			power--;
+
+		}
+
+		return calculatedValue;
+
+	}
+
+	//negative exponent
+	while (power < -1)
+	{
+
+		calculatedValue *= baseValue;
+		power++;
+
+	}
+
+	return 1.0 / calculatedValue;
+
+}
+
+//the 20 Newton iterations IntegerRoot::calculate() ran before the hardware roots;
+//only converges for root powers of magnitude 2 or more and positive baseValues
+//near 1 (a root power of 1 oscillated between baseValue and 1)
+double oldIntegerRoot(const double rootPowerValue, const double baseValue)
+{
+
+	long long rootPower(roundToInteger(rootPowerValue));
+
+	if (rootPower == 0)
+		return 1.0;
+
+	bool negative;
+	unsigned long long count;
+	unsigned char charCount;
+
+	double Xn(1.0);
+	double Xn_BaseValue;
+	double Xn_to_the_pMinus1;
+
+	//positive root
+	if (rootPower > 0)
+		negative = false;
+
+	//negative root
+	else
+	{
+
+		negative = true;
+		rootPower *= (-1);
+
+	}
+
+	//Xn+1 = Xn - (Xn/p) + a/(p * Xn^(p-1))
+	for (charCount = 0; charCount < 20; charCount++)
+	{
+
+		//calculate value of Xn^(p-1)
+		Xn_BaseValue = Xn;
+		Xn_to_the_pMinus1 = Xn;
+
+		for (count = 2; count < rootPower; count++)
+			Xn_to_the_pMinus1 *= Xn_BaseValue;
+
+		Xn = Xn - (Xn / rootPower) + (baseValue / (rootPower * Xn_to_the_pMinus1));
+
+	}
+
+	//complete the calculation
+	if (negative)
+		return 1.0 / Xn;
+
+	return Xn;
+
+}
+
+//returns a pseudo random value in the range [minValue, maxValue] from generator
+double get_RandomValue(RandomGenerator &generator, const double minValue, const double maxValue)
+{
+
+	return minValue + (maxValue - minValue) * (generator.get_Int() / 2147483647.0);
+
+}
+
+//checks integerExponent() against exactly representable powers
+void check_IntegerExponent()
+{
+
+	check("integerExponent(2, 10)", integerExponent(2.0, 10.0), 1024.0, 0.0);
+	check("integerExponent(-3, 3)", integerExponent(-3.0, 3.0), -27.0, 0.0);
+	check("integerExponent(-3, 4)", integerExponent(-3.0, 4.0), 81.0, 0.0);
+	check("integerExponent(2, -2)", integerExponent(2.0, -2.0), 0.25, 0.0);
+	check("integerExponent(0.5, -3)", integerExponent(0.5, -3.0), 8.0, 0.0);
+	check("integerExponent(1.5, 0)", integerExponent(1.5, 0.0), 1.0, 0.0);
+	check("integerExponent(7, 1)", integerExponent(7.0, 1.0), 7.0, 0.0);
+	check("integerExponent(10, 15)", integerExponent(10.0, 15.0), 1e15, 0.0);
+	check("integerExponent(2, 2.4)", integerExponent(2.0, 2.4), 4.0, 0.0);
+	check("integerExponent(2, 2.6)", integerExponent(2.0, 2.6), 8.0, 0.0);
+	check("integerExponent(1.1, 25)", integerExponent(1.1, 25.0), 10.834705943388395, 1e-14);
+	check("integerExponent(2, 1100)", integerExponent(2.0, 1100.0), HUGE_VAL, 0.0);
+
+}
+
+//checks integerRoot() against exact roots and roots rounded from higher precision
+void check_IntegerRoot()
+{
+
+	check("integerRoot(2, 81)", integerRoot(2.0, 81.0), 9.0, 0.0);
+	check("integerRoot(2, 2)", integerRoot(2.0, 2.0), 1.4142135623730951, 0.0);
+	check("integerRoot(3, -27)", integerRoot(3.0, -27.0), -3.0, 1e-15);
+	check("integerRoot(3, 2)", integerRoot(3.0, 2.0), 1.2599210498948732, 1e-15);
+	check("integerRoot(4, 16)", integerRoot(4.0, 16.0), 2.0, 1e-15);
+	check("integerRoot(5, 32)", integerRoot(5.0, 32.0), 2.0, 1e-15);
+	check("integerRoot(5, -32)", integerRoot(5.0, -32.0), -2.0, 1e-15);
+	check("integerRoot(1, 7)", integerRoot(1.0, 7.0), 7.0, 0.0);
+	check("integerRoot(-2, 4)", integerRoot(-2.0, 4.0), 0.5, 0.0);
+	check("integerRoot(2.4, 9)", integerRoot(2.4, 9.0), 3.0, 0.0);
+	check("integerRoot(7, 1e21)", integerRoot(7.0, 1e21), 1000.0, 1e-15);
+	check("integerRoot(2, -4)", integerRoot(2.0, -4.0), NAN, 0.0);
+	check("integerRoot(4, -16)", integerRoot(4.0, -16.0), NAN, 0.0);
+
+}
+
+//checks that the batch versions give exactly the scalar results, with the lanes
+//sharing one power (the uniform fast path) and with mixed powers
+void check_Batches()
+{
+
+	const unsigned short laneCount(11);
+	const double baseValues[laneCount] = { 2.0, -3.0, 0.5, 1.1, 0.0, 7.25, -1.5, 1e10, 3.0, 81.0, -27.0 };
+	const double mixedPowerValues[laneCount] = { 10.0, 3.0, -3.0, 25.0, 2.0, 1.0, 4.0, 2.0, -1.0, 2.0, 3.0 };
+	const double uniformPowerValues[4] = { 2.0, 3.0, 5.0, -2.0 };
+	double values[laneCount];
+	double powerValues[laneCount];
+	unsigned short lane;
+	unsigned char uniformIndex;
+
+	for (uniformIndex = 0; uniformIndex <= 4; uniformIndex++)
+	{
+
+		//the last pass uses mixedPowerValues
+		for (lane = 0; lane < laneCount; lane++)
+			powerValues[lane] = (uniformIndex < 4) ? uniformPowerValues[uniformIndex] : mixedPowerValues[lane];
+
+		for (lane = 0; lane < laneCount; lane++)
+			values[lane] = baseValues[lane];
+
+		integerExponent_Batch(values, powerValues, laneCount);
+
+		for (lane = 0; lane < laneCount; lane++)
+			check("integerExponent_Batch()", values[lane],
+				integerExponent(baseValues[lane], powerValues[lane]), 0.0);
+
+		//roots store their result over the root powers
+		for (lane = 0; lane < laneCount; lane++)
+			values[lane] = powerValues[lane];
+
+		integerRoot_Batch(values, baseValues, laneCount);
+
+		for (lane = 0; lane < laneCount; lane++)
+			check("integerRoot_Batch()", values[lane],
+				integerRoot(powerValues[lane], baseValues[lane]), 0.0);
+
+	}
+
+}
+
+//checks the new kernels against the implementations they replaced over randomInputCount
+//pseudo random inputs (the same inputs on every run) in the ranges where the replaced
+//implementations converge; squareRoot() is exact where the 64 iteration Newton method is
+//within an ulp, exponentiation by squaring rounds fewer times than repeated
+//multiplication (at most 30 roundings here), and roots differ by a few ulps
+void check_ReplacedImplementations(const unsigned int randomInputCount)
+{
+
+	RandomGenerator generator;
+	double value;
+	double baseValue;
+	double powerValue;
+
+	for (unsigned int count = 0; count < randomInputCount; count++)
+	{
+
+		//squared values spread over 2^-40 to 2^40
+		value = exp2(get_RandomValue(generator, -40.0, 40.0));
+		check("squareRoot()", squareRoot(value, 64), oldSquareRoot(value, 64), 2.0 * DBL_EPSILON);
+
+		//bases of either sign, powers of magnitude up to 30 (and not only integers)
+		baseValue = get_RandomValue(generator, 0.25, 4.0);
+
+		if (generator.get_Int() & 1)
+			baseValue = -baseValue;
+
+		powerValue = get_RandomValue(generator, -30.49, 30.49);
+		check("integerExponent()", integerExponent(baseValue, powerValue),
+			oldIntegerExponent(baseValue, powerValue), 64.0 * DBL_EPSILON);
+
+		//positive bases, root powers of magnitude 2 to 8
+		baseValue = get_RandomValue(generator, 0.25, 4.0);
+		powerValue = 2 + generator.get_Int() % 7;
+
+		if (generator.get_Int() & 1)
+			powerValue = -powerValue;
+
+		check("integerRoot()", integerRoot(powerValue, baseValue),
+			oldIntegerRoot(powerValue, baseValue), 8.0 * DBL_EPSILON);
+
+	}
+
+}
+
+int main()
+{
+
+	check_IntegerExponent();
+	check_IntegerRoot();
+	check_Batches();
+	check_ReplacedImplementations(100000);
+
+	if (failureCount)
+	{
+
+		cout << "\n\n" << failureCount << " math tools checks failed\n";
+		return 1;
+
+	}
+
+	cout << "\nall math tools checks passed\n";
+	return 0;
+
+}
@@ -12,6 +12,8 @@ Description:	a stand-alone header file containing all definitions and implementa
 
 #include <iostream>
 
+using namespace std;
+
 template<typename T> class UniformNode
 {
 
@@ -480,10 +482,10 @@ public:
 			else
 			{
 
-				newRangeLastNode->nextNode = inserPoint;
+				newRangeLastNode->nextNode = insertPoint;
 
 				if (insertPoint == firstNode)
-					firstNode = newRangefirstNode;
+					firstNode = newRangeFirstNode;
 
 				else
 				{
@@ -638,10 +640,10 @@ public:
 			else
 			{
 
-				newRangeLastNode->nextNode = inserPoint;
+				newRangeLastNode->nextNode = insertPoint;
 
 				if (insertPoint == firstNode)
-					firstNode = newRangefirstNode;
+					firstNode = newRangeFirstNode;
 
 				else
 				{
@@ -2101,7 +2103,7 @@ public:
 			{
 
 				rangeOriginNode = rangeOriginNode->nextNode;
-				count--;
+				nodeCount--;
 
 			}
 
@@ -2114,7 +2116,7 @@ public:
 			{
 
 				rangeOriginNode = rangeOriginNode->priorNode;
-				count--;
+				nodeCount--;
 
 			}
 
@@ -2213,19 +2215,19 @@ public:
 
 				//complete initial setup
 				rangeBoundaryNode = rangeOriginNode->priorNode;
-				laggingnode = rangeOriginNode;
+				laggingNode = rangeOriginNode;
 				leadingNode = rangeOriginNode->nextNode;
 
 				//disjointed inversion of any/all intervening range nodes
 				do
 				{
 
-					laggingnode->priorNode = leadingNode;
+					laggingNode->priorNode = leadingNode;
 
-					laggingnode = leadingNode;
+					laggingNode = leadingNode;
 					leadingNode = leadingNode->nextNode;
 
-					laggingnode->nextNode = laggingnode->priorNode;
+					laggingNode->nextNode = laggingNode->priorNode;
 
 					nodeCount--;
 
@@ -2266,19 +2268,19 @@ public:
 
 				//complete initial setup
 				rangeBoundaryNode = rangeOriginNode->nextNode;
-				laggingnode = rangeOriginNode;
+				laggingNode = rangeOriginNode;
 				leadingNode = rangeOriginNode->priorNode;
 
 				//disjointed inversion of any/all intervening range nodes
 				do
 				{
 
-					laggingnode->nextNode = leadingNode;
+					laggingNode->nextNode = leadingNode;
 
-					laggingnode = leadingNode;
+					laggingNode = leadingNode;
 					leadingNode = leadingNode->priorNode;
 
-					laggingnode->priorNode = laggingnode->nextNode;
+					laggingNode->priorNode = laggingNode->nextNode;
 
 					nodeCount--;
 
@@ -3677,7 +3679,7 @@ public:
 	Returns:	...
 	Effects:	...
 	***********************************************************************************/
-	void increment_WithCopy(const unsigned long long incrementLength,
+	void increment_WithCopy(unsigned long long incrementLength,
 		const bool extendAtEnd = true)
 	{
 
@@ -4042,7 +4044,7 @@ public:
 			else
 			{
 
-				BranchingNode<JSON_Node> *tempNode(parentNode);
+				BranchingNode<T> *tempNode(parentNode);
 
 				while (tempNode)
 				{
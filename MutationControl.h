@@ -0,0 +1,138 @@
+#ifndef MUTATIONCONTROL_H_INCLUDED
+#define MUTATIONCONTROL_H_INCLUDED
+
+#include "StringTools.h"
+
+//manages the mutation amplitude and number of mutations per net used in each
+//evolution cycle; when adapted, follows the 1/5th success rule: if more than a
+//fifth of the children fully evaluated in the last cycle outperformed their parents the
+//mutations are strengthened, if fewer they are weakened
+class MutationControl
+{
+
+private:
+
+	unsigned short mutationsPerNet; //number of mutations each child net will accumulate in the current cycle (>= 1)
+	double mutationAmplitude; //amplitude of each mutation in the current cycle (> 0.0)
+
+	//limits on adaptation, set relative to the values given at construction
+	unsigned short maxMutationsPerNet; //4 times the initial mutationsPerNet
+	double minMutationAmplitude; //1/100 of the initial mutationAmplitude
+	double maxMutationAmplitude; //100 times the initial mutationAmplitude
+
+public:
+
+	//default constructor - these values are very arbitrary
+	MutationControl() : mutationsPerNet(1), mutationAmplitude(1.0), maxMutationsPerNet(4),
+		minMutationAmplitude(0.01), maxMutationAmplitude(100.0) {}
+
+	//modified constructor - assumes aMutationsPerNet >= 1 and aMutationAmplitude > 0.0
+	MutationControl(const unsigned short aMutationsPerNet, const double aMutationAmplitude)
+		: mutationsPerNet(aMutationsPerNet), mutationAmplitude(aMutationAmplitude),
+		minMutationAmplitude(aMutationAmplitude * 0.01), maxMutationAmplitude(aMutationAmplitude * 100.0)
+	{
+
+		if (aMutationsPerNet < 16384)
+			maxMutationsPerNet = aMutationsPerNet * 4;
+
+		else
+			maxMutationsPerNet = 65535;
+
+	}
+
+	//destructor
+	~MutationControl() {}
+
+	//getter
+	unsigned short get_MutationsPerNet() const
+	{
+
+		return mutationsPerNet;
+
+	}
+
+	//getter
+	double get_MutationAmplitude() const
+	{
+
+		return mutationAmplitude;
+
+	}
+
+	//adjusts mutationsPerNet (by 1) and mutationAmplitude (by a factor of 0.85) based
+	//on the number of children (successCount of childCount) which outperformed their
+	//parents; returns true if any value changed; assumes successCount <= childCount
+	bool adapt(const unsigned short successCount, const unsigned short childCount)
+	{
+
+		if (!childCount)
+			return false;
+
+		const double previousMutationAmplitude(mutationAmplitude);
+		const unsigned short previousMutationsPerNet(mutationsPerNet);
+
+		//success rate above 1/5, strengthen mutations
+		if (successCount * 5 > childCount)
+		{
+
+			mutationAmplitude /= 0.85;
+
+			if (mutationAmplitude > maxMutationAmplitude)
+				mutationAmplitude = maxMutationAmplitude;
+
+			if (mutationsPerNet < maxMutationsPerNet)
+				mutationsPerNet++;
+
+		}
+
+		//success rate below 1/5, weaken mutations
+		else if (successCount * 5 < childCount)
+		{
+
+			mutationAmplitude *= 0.85;
+
+			if (mutationAmplitude < minMutationAmplitude)
+				mutationAmplitude = minMutationAmplitude;
+
+			if (mutationsPerNet > 1)
+				mutationsPerNet--;
+
+		}
+
+		return (mutationAmplitude != previousMutationAmplitude
+			|| mutationsPerNet != previousMutationsPerNet);
+
+	}
+
+	//writes the current values and limits to outputFile as raw bytes;
+	//assumes outputFile is open in binary mode
+	void output_ToOpenFile_Binary(ofstream &outputFile) const
+	{
+
+		outputValue_ToOpenFile_Binary(mutationsPerNet, outputFile);
+		outputValue_ToOpenFile_Binary(mutationAmplitude, outputFile);
+		outputValue_ToOpenFile_Binary(maxMutationsPerNet, outputFile);
+		outputValue_ToOpenFile_Binary(minMutationAmplitude, outputFile);
+		outputValue_ToOpenFile_Binary(maxMutationAmplitude, outputFile);
+
+	}
+
+	//reads values written by output_ToOpenFile_Binary(); returns false if the
+	//read fails or the values are invalid; assumes inputFile is open in binary mode
+	bool load_FromOpenFile_Binary(ifstream &inputFile)
+	{
+
+		if (!inputValue_FromOpenFile_Binary(mutationsPerNet, inputFile)
+			|| !inputValue_FromOpenFile_Binary(mutationAmplitude, inputFile)
+			|| !inputValue_FromOpenFile_Binary(maxMutationsPerNet, inputFile)
+			|| !inputValue_FromOpenFile_Binary(minMutationAmplitude, inputFile)
+			|| !inputValue_FromOpenFile_Binary(maxMutationAmplitude, inputFile))
+			return false;
+
+		return (mutationsPerNet && mutationAmplitude > 0.0);
+
+	}
+
+};
+
+#endif // MUTATIONCONTROL_H_INCLUDED
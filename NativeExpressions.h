@@ -0,0 +1,266 @@
+#ifndef NATIVEEXPRESSIONS_H_INCLUDED
+#define NATIVEEXPRESSIONS_H_INCLUDED
+
+#include <cstdlib>
+#include <cstring>
+#include "StringTools.h"
+#include "MathTools.h"
+
+//shared libraries are loaded with dlopen(), where the system provides it
+#if defined(__unix__) || defined(__APPLE__)
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <cerrno>
+#define NATIVE_EXPRESSIONS_AVAILABLE
+#endif
+
+//a shared library of expressions compiled to native code (see
+//Expression_Double::output_NativeFunction()); the generated C++ source is written
+//next to the library, built with the system compiler (the program named by the CXX
+//environment variable, c++ otherwise, run directly rather than through a shell) and loaded; the library is unloaded on destruction, so it
+//must outlive any expression its functions are attached to
+class NativeExpressionLibrary
+{
+
+private:
+
+	void *libraryHandle; //NULL unless a library is loaded
+
+#ifdef NATIVE_EXPRESSIONS_AVAILABLE
+
+	//returns a new c-string of fileName prefixed with "./" if it has no directory, so it
+	//is neither searched for on the library path nor taken for a compiler option
+	static char *sub_GetNewPathCString(const char *fileName)
+	{
+
+		char *path(new char[strlen(fileName) + 3]);
+
+		if (strchr(fileName, '/'))
+			strcpy(path, fileName);
+
+		else
+		{
+
+			strcpy(path, "./");
+			strcat(path, fileName);
+
+		}
+
+		return path;
+
+	}
+
+	//runs compiler on sourcePath to build the shared library libraryPath; returns true
+	//if the compiler ran and exited successfully
+	static bool sub_Compile(const char *compiler, char *sourcePath, char *libraryPath)
+	{
+
+		//floating point contraction would change results, so it is disabled
+		char *arguments[] = { const_cast<char*>(compiler), const_cast<char*>("-O2"),
+			const_cast<char*>("-ffp-contract=off"), const_cast<char*>("-fno-fast-math"),
+			const_cast<char*>("-fPIC"), const_cast<char*>("-shared"), const_cast<char*>("-o"),
+			libraryPath, sourcePath, NULL };
+		int compilerStatus;
+		pid_t compilerProcess(fork());
+
+		if (compilerProcess < 0)
+			return false;
+
+		if (!compilerProcess)
+		{
+
+			execvp(compiler, arguments);
+			_exit(127);
+
+		}
+
+		while (waitpid(compilerProcess, &compilerStatus, 0) < 0)
+		{
+
+			if (errno != EINTR)
+				return false;
+
+		}
+
+		return (WIFEXITED(compilerStatus) && !WEXITSTATUS(compilerStatus));
+
+	}
+
+#endif
+
+public:
+
+	//default constructor
+	NativeExpressionLibrary() : libraryHandle(NULL) {}
+
+	//copy constructor; copies do not share the loaded library
+	NativeExpressionLibrary(const NativeExpressionLibrary &) : libraryHandle(NULL) {}
+
+	//copy assignment operator; keeps this library's own loaded library
+	NativeExpressionLibrary &operator=(const NativeExpressionLibrary &)
+	{
+
+		return *this;
+
+	}
+
+	//destructor
+	~NativeExpressionLibrary()
+	{
+
+		unload();
+
+	}
+
+	//returns true if a library is loaded
+	bool test_Loaded() const
+	{
+
+		return (libraryHandle != NULL);
+
+	}
+
+	//writes the native function of each of expressions (numbered by its index) to
+	//<fileNamePrefix>.cpp, compiles it to <fileNamePrefix>.so and loads the library
+	//(unloading any library loaded before); returns a code: 0 means success, 1 native
+	//expressions are unavailable on this system, 2 the source could not be written,
+	//3 the compiler failed (or is missing), 4 the library could not be loaded
+	unsigned char build(ExtensibleArray<Expression_Double*> &expressions, Word &fileNamePrefix)
+	{
+
+		unload();
+
+#ifndef NATIVE_EXPRESSIONS_AVAILABLE
+
+		return 1;
+
+#else
+
+		char *sourceFileName(get_NewFileNameCString(fileNamePrefix, ".cpp"));
+		char *libraryFileName(get_NewFileNameCString(fileNamePrefix, ".so"));
+		const char *compiler(getenv("CXX"));
+		char *sourcePath;
+		char *libraryPath;
+		ofstream sourceFile;
+		bool built;
+
+		if (!sourceFileName || !libraryFileName)
+		{
+
+			delete[] sourceFileName;
+			delete[] libraryFileName;
+
+			return 2;
+
+		}
+
+		//generate the source
+		sourceFile.open(sourceFileName, std::ofstream::trunc);
+
+		if (!sourceFile.is_open())
+		{
+
+			delete[] sourceFileName;
+			delete[] libraryFileName;
+
+			return 2;
+
+		}
+
+		sourceFile << "//generated by NativeExpressionLibrary::build(); each function is the program of one expression\n";
+
+		for (unsigned long long count = 0; count < expressions.get_ArrayLength(); count++)
+			expressions.get_Element(count)->output_NativeFunction(sourceFile, count);
+
+		sourceFile.close();
+
+		if (sourceFile.fail())
+		{
+
+			delete[] sourceFileName;
+			delete[] libraryFileName;
+
+			return 2;
+
+		}
+
+		//compile
+		if (!compiler || !compiler[0])
+			compiler = "c++";
+
+		sourcePath = sub_GetNewPathCString(sourceFileName);
+		libraryPath = sub_GetNewPathCString(libraryFileName);
+
+		delete[] sourceFileName;
+		delete[] libraryFileName;
+
+		built = sub_Compile(compiler, sourcePath, libraryPath);
+
+		delete[] sourcePath;
+
+		if (!built)
+		{
+
+			delete[] libraryPath;
+
+			return 3;
+
+		}
+
+		//load
+		libraryHandle = dlopen(libraryPath, RTLD_NOW | RTLD_LOCAL);
+
+		delete[] libraryPath;
+
+		if (!libraryHandle)
+			return 4;
+
+		return 0;
+
+#endif
+
+	}
+
+	//returns the native function built from expression expressionIndex in build(),
+	//NULL if no library is loaded or the function is missing
+	NativeExpressionFunction get_Function(const unsigned long long expressionIndex)
+	{
+
+#ifdef NATIVE_EXPRESSIONS_AVAILABLE
+
+		char symbolName[48];
+
+		if (!libraryHandle)
+			return NULL;
+
+		snprintf(symbolName, sizeof(symbolName), "nn_expression_%llu", expressionIndex);
+
+		return reinterpret_cast<NativeExpressionFunction>(dlsym(libraryHandle, symbolName));
+
+#else
+
+		return NULL;
+
+#endif
+
+	}
+
+	//unloads the library; assumes no expression still calls its functions
+	void unload()
+	{
+
+#ifdef NATIVE_EXPRESSIONS_AVAILABLE
+
+		if (libraryHandle)
+			dlclose(libraryHandle);
+
+#endif
+
+		libraryHandle = NULL;
+
+	}
+
+};
+
+#endif // NATIVEEXPRESSIONS_H_INCLUDED
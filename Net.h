@@ -8,28 +8,43 @@ class Net
 
 private:
 	
-	//main cell storage array
-	ExtensibleArray<Cell> cells;
+	//main cell storage array; cells may be shared with other nets in the
+	//population (see Cell::share()) and are copied only when this net modifies them
+	ExtensibleArray<Cell*> cells;
 
 	//performance/fitness tracking property
 	double fitnessRating; //lower value means better performance
 
+	//incremental evaluation trace properties (see Population::set_IncrementalEvaluation())
+	ExtensibleArray<Cell*> tracedCells; //cells (shared) as they were when the trace was last completed, empty if no trace exists
+	ExtensibleArray<unsigned long long> touchedCellsFilters; //one filter per (data set row, data frame), bit (cellIndex % 64) set if the cell was touched in that frame, 0 if not recorded
+	ExtensibleArray<double> tracedOutputValues; //output values per (data set row, data frame, output) recorded with touchedCellsFilters
+
+	//content hash cache (see get_ContentHash())
+	unsigned long long contentHash; //hash of the cells, valid only if contentHashValid is true
+	bool contentHashValid; //false once the cells have changed (see mutate(), meiosis() and decode_Genome())
+
+	//row fitness record properties (see Population::set_RowFitnessRecording())
+	unsigned long long rowFitnessKey; //content hash (see get_ContentHash()) of the cells the record belongs to
+	ExtensibleArray<double> rowFitnessRatings; //fitness contribution of each data set row, empty if no record exists
+	ExtensibleArray<unsigned long long> recordedRowsFilters; //bit (rowIndex % 64) of word (rowIndex / 64) set if that row of rowFitnessRatings is recorded
+
 public:
 
 	//default constructor
-	Net() :cells(3)
+	Net() :cells(3), contentHash(0), contentHashValid(false), rowFitnessKey(0)
 	{
 
-		*(cells.get_ElementAddress(0)) = Cell(0, 1, 3);
-		*(cells.get_ElementAddress(1)) = Cell(1, 1, 3);
-		*(cells.get_ElementAddress(2)) = Cell(2, 1, 3);
+		*(cells.get_ElementAddress(0)) = new Cell(0, 1, 3);
+		*(cells.get_ElementAddress(1)) = new Cell(1, 1, 3);
+		*(cells.get_ElementAddress(2)) = new Cell(2, 1, 3);
 
 	}
 
 	//modified constructor; only safe in context of Population initialization
 	Net(UniformList<Cell> &cellsList, ExtensibleArray<unsigned short> &priorLinksCountsList,
 		const unsigned short aInputCellCount, const unsigned short aCellsPerNet)
-		: cells(aCellsPerNet)
+		: cells(aCellsPerNet), contentHash(0), contentHashValid(false), rowFitnessKey(0)
 	{
 
 		UniformNode<Cell> *cellNode(cellsList.get_FirstNode());
@@ -40,14 +55,14 @@ public:
 		do
 		{
 
-			*(cells.get_ElementAddress(count)) = cellNode->content;
+			*(cells.get_ElementAddress(count)) = new Cell(cellNode->content);
 
 			if (count < aInputCellCount)
-				cells.get_ElementAddress(count)->set_PriorLinksCount(
+				cells.get_Element(count)->set_PriorLinksCount(
 					priorLinksCountsList.get_Element(count) + 1);
 
 			else
-				cells.get_ElementAddress(count)->set_PriorLinksCount(
+				cells.get_Element(count)->set_PriorLinksCount(
 					priorLinksCountsList.get_Element(count));
 
 			cellNode = cellNode->get_NextNode();
@@ -57,10 +72,93 @@ public:
 
 	}
 
-	//default destructor
-	~Net() {}
+	//copy constructor; shares (does not copy) otherNet's cells
+	Net(const Net& otherNet) : cells(otherNet.cells.get_ArrayLength()),
+		fitnessRating(otherNet.fitnessRating), tracedCells(otherNet.tracedCells.get_ArrayLength()),
+		touchedCellsFilters(otherNet.touchedCellsFilters), tracedOutputValues(otherNet.tracedOutputValues),
+		contentHash(otherNet.contentHash), contentHashValid(otherNet.contentHashValid),
+		rowFitnessKey(otherNet.rowFitnessKey), rowFitnessRatings(otherNet.rowFitnessRatings),
+		recordedRowsFilters(otherNet.recordedRowsFilters)
+	{
+
+		unsigned short totalCellCount(cells.get_ArrayLength());
+		unsigned short count;
+
+		for (count = 0; count < totalCellCount; count++)
+			*(cells.get_ElementAddress(count)) = Cell::share(otherNet.cells.get_Element(count));
+
+		totalCellCount = tracedCells.get_ArrayLength();
+
+		for (count = 0; count < totalCellCount; count++)
+			*(tracedCells.get_ElementAddress(count)) = Cell::share(otherNet.tracedCells.get_Element(count));
+
+	}
+
+	//copy assignment constructor; releases this net's cells and shares
+	//(does not copy) otherNet's cells
+	Net& operator=(Net const& otherNet)
+	{
+
+		if (&otherNet != this)
+		{
+
+			unsigned short count;
+			unsigned short totalCellCount(cells.get_ArrayLength());
+
+			for (count = 0; count < totalCellCount; count++)
+				Cell::release(cells.get_Element(count));
+
+			totalCellCount = otherNet.cells.get_ArrayLength();
+
+			if (totalCellCount != cells.get_ArrayLength())
+				cells.resize_NoCopy(totalCellCount);
+
+			for (count = 0; count < totalCellCount; count++)
+				*(cells.get_ElementAddress(count)) = Cell::share(otherNet.cells.get_Element(count));
+
+			fitnessRating = otherNet.fitnessRating;
+
+			//trace
+			release_TracedCells();
+
+			tracedCells = otherNet.tracedCells;
+			totalCellCount = tracedCells.get_ArrayLength();
+
+			for (count = 0; count < totalCellCount; count++)
+				Cell::share(tracedCells.get_Element(count));
+
+			touchedCellsFilters = otherNet.touchedCellsFilters;
+			tracedOutputValues = otherNet.tracedOutputValues;
+
+			//content hash (the cells are shared, so unchanged)
+			contentHash = otherNet.contentHash;
+			contentHashValid = otherNet.contentHashValid;
+
+			//row fitness record
+			rowFitnessKey = otherNet.rowFitnessKey;
+			rowFitnessRatings = otherNet.rowFitnessRatings;
+			recordedRowsFilters = otherNet.recordedRowsFilters;
+
+		}
+
+		return *this;
 
-	//assumes rand() has been seeded, assumes mutationCount > 0; mutationAmplitude > 0.0
+	}
+
+	//destructor; releases this net's cells
+	~Net()
+	{
+
+		const unsigned short totalCellCount(cells.get_ArrayLength());
+
+		for (unsigned short count = 0; count < totalCellCount; count++)
+			Cell::release(cells.get_Element(count));
+
+		release_TracedCells();
+
+	}
+
+	//assumes the random generator has been seeded, assumes mutationCount > 0; mutationAmplitude > 0.0
 	void mutate(unsigned short mutationCount, const double mutationAmplitude)
 	{
 
@@ -70,14 +168,17 @@ public:
 		Cell *mutationCell;
 		unsigned short mutationType;
 
+		contentHashValid = false;
+
 		//main loop to effect multiple mutations
 		do 
 		{
 
-			//randomly select a mutation cell and type
-			mutationCellIndex = rand() % totalCellCount;
-			mutationCell = cells.get_ElementAddress(mutationCellIndex);
-			mutationType = rand() % 8;
+			//randomly select a mutation cell and type (the cell is
+			//copied first if it is still shared with another net)
+			mutationCellIndex = get_RandomInt() % totalCellCount;
+			mutationCell = Cell::get_WritableCell(cells, mutationCellIndex);
+			mutationType = get_RandomInt() % 8;
 
 			//mutate structure of postLinks by adding, deleting, or revising a link
 			if (mutationType < 3)
@@ -110,10 +211,11 @@ public:
 	}
 
 	//splices the contents of motherCells and fatherCells into this net
-	//overwriting the existing cells; assumes motherCells and fatherCells are from
+	//overwriting the existing cells; spliced cells are shared with (not copied
+	//from) the parent nets; assumes motherCells and fatherCells are from
 	//nets in the same population and are not NULL; assumes motherCells
 	//and fatherCells are not this net's cells
-	void meiosis(ExtensibleArray<Cell> &motherCells, ExtensibleArray<Cell> &fatherCells,
+	void meiosis(ExtensibleArray<Cell*> &motherCells, ExtensibleArray<Cell*> &fatherCells,
 		const unsigned short maxSpliceLength)
 	{
 
@@ -122,11 +224,13 @@ public:
 		unsigned short cellsCopied = 0;
 		unsigned short count = cellsCopied;
 
+		contentHashValid = false;
+
 		do
 		{
 			
 			//set currentSpliceLength
-			currentSpliceLength = (rand() % maxSpliceLength) + 1;
+			currentSpliceLength = (get_RandomInt() % maxSpliceLength) + 1;
 
 			if (currentSpliceLength > (totalCellCount - cellsCopied))
 				currentSpliceLength = (totalCellCount - cellsCopied);
@@ -135,13 +239,14 @@ public:
 			cellsCopied += currentSpliceLength;
 
 			//choose the parent and splice in cells
-			if (rand() % 2)
+			if (get_RandomInt() % 2)
 			{
 
 				do
 				{
 
-					*(cells.get_ElementAddress(count)) = *(motherCells.get_ElementAddress(count));
+					Cell::release(cells.get_Element(count));
+					*(cells.get_ElementAddress(count)) = Cell::share(motherCells.get_Element(count));
 					count++;
 
 				} while (count < cellsCopied);
@@ -154,7 +259,8 @@ public:
 				do
 				{
 
-					*(cells.get_ElementAddress(count)) = *(fatherCells.get_ElementAddress(count));
+					Cell::release(cells.get_Element(count));
+					*(cells.get_ElementAddress(count)) = Cell::share(fatherCells.get_Element(count));
 					count++;
 
 				} while (count < cellsCopied);
@@ -204,7 +310,7 @@ public:
 		{
 
 			outputFile << "\n\t\t\t\t<c_" << count << ">";
-			cells.get_ElementAddress(count)->output_ToOpenFile_XML(outputFile);
+			cells.get_Element(count)->output_ToOpenFile_XML(outputFile);
 			outputFile << "\n\t\t\t\t</c_" << count << ">";
 
 		}
@@ -225,24 +331,441 @@ public:
 		{
 
 			outputFile << "{";
-			cells.get_ElementAddress(count)->output_ToOpenFile_JSON(outputFile);
+			cells.get_Element(count)->output_ToOpenFile_JSON(outputFile);
 			outputFile << "},";
 
 		}
 		outputFile << "{";
-		cells.get_ElementAddress(count)->output_ToOpenFile_JSON(outputFile);
+		cells.get_Element(count)->output_ToOpenFile_JSON(outputFile);
 		outputFile << "}]";
 
 	}
 
+	//appends this net's cells to genome (see Genome and Cell::encode_ToGenome());
+	//fitnessRating is not part of the genome, so nets with equal cells have equal
+	//genomes and genome hashes; if quantized, cell coefficients are rounded to
+	//single precision, otherwise decode_Genome() restores the cells exactly
+	void encode_Genome(Genome &genome, const bool quantized = false) const
+	{
+
+		const unsigned short totalCellCount(cells.get_ArrayLength());
+
+		genome.append_Varint(quantized);
+		genome.append_Varint(totalCellCount);
+
+		for (unsigned short count = 0; count < totalCellCount; count++)
+			cells.get_Element(count)->encode_ToGenome(genome, (count ? cells.get_Element(count - 1) : NULL), quantized);
+
+	}
+
+	//replaces this net's cells with a net appended to genome by encode_Genome(),
+	//read from genome's read position; the decoded cells are not shared, any
+	//incremental evaluation trace is discarded and fitnessRating is reset; returns
+	//false if the read fails or the net does not have totalCellCount valid cells
+	//(this net is then left with valid but unspecified cells)
+	bool decode_Genome(Genome &genome, const unsigned short totalCellCount)
+	{
+
+		unsigned long long quantized;
+		unsigned long long decodedCellCount;
+		unsigned short count;
+
+		if (!genome.read_Varint(quantized, 1) || !genome.read_Varint(decodedCellCount, 65535)
+			|| decodedCellCount != totalCellCount)
+			return false;
+
+		for (count = 0; count < cells.get_ArrayLength(); count++)
+			Cell::release(cells.get_Element(count));
+
+		contentHashValid = false;
+
+		if (cells.get_ArrayLength() != totalCellCount)
+			cells.resize_NoCopy(totalCellCount);
+
+		for (count = 0; count < totalCellCount; count++)
+			*(cells.get_ElementAddress(count)) = new Cell(count, 1, totalCellCount);
+
+		release_TracedCells();
+		tracedCells = ExtensibleArray<Cell*>();
+		touchedCellsFilters = ExtensibleArray<unsigned long long>();
+		clear_RowFitnessRecord();
+		fitnessRating = 0.0;
+
+		for (count = 0; count < totalCellCount; count++)
+		{
+
+			if (!cells.get_Element(count)->decode_FromGenome(genome, (count ? cells.get_Element(count - 1) : NULL),
+				quantized, count, totalCellCount))
+				return false;
+
+		}
+
+		return true;
+
+	}
+
+	//writes fitnessRating and the exact genome of this net to outputFile (see
+	//encode_Genome()); assumes outputFile is open in binary mode
+	void output_ToOpenFile_Binary(ofstream &outputFile) const
+	{
+
+		Genome genome;
+
+		encode_Genome(genome);
+
+		outputValue_ToOpenFile_Binary(fitnessRating, outputFile);
+		genome.output_ToOpenFile_Binary(outputFile);
+
+	}
+
+	//replaces this net's cells and fitnessRating with a net written by
+	//output_ToOpenFile_Binary() (see decode_Genome()); returns false if the read
+	//fails or the net does not have totalCellCount valid cells; assumes inputFile
+	//is open in binary mode
+	bool load_FromOpenFile_Binary(ifstream &inputFile, const unsigned short totalCellCount)
+	{
+
+		Genome genome;
+		double loadedFitnessRating;
+
+		//a cell never needs more than 512 bytes plus 18 per link
+		if (!inputValue_FromOpenFile_Binary(loadedFitnessRating, inputFile)
+			|| !genome.load_FromOpenFile_Binary(inputFile, 64 + (static_cast<unsigned long long>(totalCellCount)
+			* (512 + 18 * static_cast<unsigned long long>(totalCellCount)))))
+			return false;
+
+		if (!decode_Genome(genome, totalCellCount) || !genome.test_ReadComplete())
+			return false;
+
+		fitnessRating = loadedFitnessRating;
+
+		return true;
+
+	}
+
+	//returns the hash of this net's exact genome (see encode_Genome()); nets
+	//with equal cells have equal content hashes; the hash is cached until the
+	//cells change through mutate(), meiosis() or decode_Genome(), so cells must
+	//not be modified through get_Cells()
+	unsigned long long get_ContentHash()
+	{
+
+		if (!contentHashValid)
+		{
+
+			Genome genome;
+
+			encode_Genome(genome);
+
+			contentHash = genome.get_Hash();
+			contentHashValid = true;
+
+		}
+
+		return contentHash;
+
+	}
+
 	//returns reference to cells for use by Population
-	ExtensibleArray<Cell> &get_Cells()
+	ExtensibleArray<Cell*> &get_Cells()
 	{
 
 		return cells;
 
 	}
 
+	//***incremental evaluation trace methods***
+
+	//returns a filter with bit (cellIndex % 64) set for every cell which is
+	//not the same cell recorded in tracedCells; since tracedCells holds a share
+	//of each traced cell, any modification since the trace was completed
+	//produces a new cell (see Cell::get_WritableCell()); all bits are set
+	//if there is no trace
+	unsigned long long get_ChangedCellsFilter() const
+	{
+
+		const unsigned short totalCellCount(cells.get_ArrayLength());
+
+		if (tracedCells.get_ArrayLength() != totalCellCount)
+			return ~0ULL;
+
+		unsigned long long changedCellsFilter(0);
+
+		for (unsigned short count = 0; count < totalCellCount; count++)
+		{
+
+			if (cells.get_Element(count) != tracedCells.get_Element(count))
+				changedCellsFilter |= (1ULL << (count % 64));
+
+		}
+
+		return changedCellsFilter;
+
+	}
+
+	//prepares the trace for a new evaluation of totalTraceLength (data set row,
+	//data frame) pairs; clears (sets to 0) every recorded frame in which a
+	//changed cell was touched, all other recorded frames remain valid
+	void begin_Trace(const unsigned long long totalTraceLength, const unsigned short outputCount)
+	{
+
+		unsigned long long count;
+
+		if (touchedCellsFilters.get_ArrayLength() != totalTraceLength)
+		{
+
+			touchedCellsFilters.resize_NoCopy(totalTraceLength);
+			tracedOutputValues.resize_NoCopy(totalTraceLength * outputCount);
+
+			for (count = 0; count < totalTraceLength; count++)
+				*(touchedCellsFilters.get_ElementAddress(count)) = 0;
+
+			return;
+
+		}
+
+		const unsigned long long changedCellsFilter(get_ChangedCellsFilter());
+
+		if (!changedCellsFilter)
+			return;
+
+		for (count = 0; count < totalTraceLength; count++)
+		{
+
+			if (touchedCellsFilters.get_Element(count) & changedCellsFilter)
+				*(touchedCellsFilters.get_ElementAddress(count)) = 0;
+
+		}
+
+	}
+
+	//records the current cells as tracedCells; called once all frames
+	//cleared by begin_Trace() have been recorded again
+	void complete_Trace()
+	{
+
+		const unsigned short totalCellCount(cells.get_ArrayLength());
+
+		release_TracedCells();
+
+		if (totalCellCount != tracedCells.get_ArrayLength())
+			tracedCells.resize_NoCopy(totalCellCount);
+
+		for (unsigned short count = 0; count < totalCellCount; count++)
+			*(tracedCells.get_ElementAddress(count)) = Cell::share(cells.get_Element(count));
+
+	}
+
+	//clears (sets to 0) the frameCount recorded frames starting at firstTraceIndex, so
+	//they are stimulated again (used when the data they were recorded from is replaced);
+	//does nothing if there is no trace
+	void clear_TracedFrames(const unsigned long long firstTraceIndex, const unsigned long long frameCount)
+	{
+
+		if (touchedCellsFilters.get_ArrayLength() < firstTraceIndex + frameCount)
+			return;
+
+		for (unsigned long long count = 0; count < frameCount; count++)
+			*(touchedCellsFilters.get_ElementAddress(firstTraceIndex + count)) = 0;
+
+	}
+
+	//assumes traceIndex < the totalTraceLength passed to begin_Trace()
+	unsigned long long *get_TouchedCellsFilterAddress(const unsigned long long traceIndex) const
+	{
+
+		return touchedCellsFilters.get_ElementAddress(traceIndex);
+
+	}
+
+	//assumes tracedOutputIndex < totalTraceLength * outputCount passed to begin_Trace()
+	double *get_TracedOutputValueAddress(const unsigned long long tracedOutputIndex) const
+	{
+
+		return tracedOutputValues.get_ElementAddress(tracedOutputIndex);
+
+	}
+
+	//***row fitness record methods***
+
+	//prepares the record for an evaluation over dataSetRowCount data set rows;
+	//the record is kept if it belongs to this net's current cells (by content
+	//hash) and has dataSetRowCount rows, otherwise every row is marked unrecorded
+	void begin_RowFitnessRecord(const unsigned long long dataSetRowCount)
+	{
+
+		const unsigned long long currentContentHash(get_ContentHash());
+
+		if (currentContentHash == rowFitnessKey && rowFitnessRatings.get_ArrayLength() == dataSetRowCount)
+			return;
+
+		const unsigned long long filtersLength((dataSetRowCount + 63) / 64);
+
+		rowFitnessKey = currentContentHash;
+
+		if (rowFitnessRatings.get_ArrayLength() != dataSetRowCount)
+		{
+
+			rowFitnessRatings.resize_NoCopy(dataSetRowCount);
+			recordedRowsFilters.resize_NoCopy(filtersLength);
+
+		}
+
+		for (unsigned long long count = 0; count < filtersLength; count++)
+			*(recordedRowsFilters.get_ElementAddress(count)) = 0;
+
+	}
+
+	//discards the record
+	void clear_RowFitnessRecord()
+	{
+
+		rowFitnessKey = 0;
+		rowFitnessRatings = ExtensibleArray<double>();
+		recordedRowsFilters = ExtensibleArray<unsigned long long>();
+
+	}
+
+	//getter; the content hash the record belongs to
+	unsigned long long get_RowFitnessKey() const
+	{
+
+		return rowFitnessKey;
+
+	}
+
+	//returns the number of rows the record has room for (0 if there is no record)
+	unsigned long long get_RowFitnessRecordLength() const
+	{
+
+		return rowFitnessRatings.get_ArrayLength();
+
+	}
+
+	//returns true and sets rowFitnessRating to the recorded fitness contribution of
+	//dataSetRowIndex if it is recorded; assumes dataSetRowIndex < the record length
+	bool get_RecordedRowFitness(const unsigned long long dataSetRowIndex, double &rowFitnessRating) const
+	{
+
+		if (!(recordedRowsFilters.get_Element(dataSetRowIndex / 64) & (1ULL << (dataSetRowIndex % 64))))
+			return false;
+
+		rowFitnessRating = rowFitnessRatings.get_Element(dataSetRowIndex);
+
+		return true;
+
+	}
+
+	//marks dataSetRowIndex unrecorded (used when the row is replaced); does nothing
+	//if there is no record
+	void clear_RecordedRowFitness(const unsigned long long dataSetRowIndex)
+	{
+
+		if (dataSetRowIndex < rowFitnessRatings.get_ArrayLength())
+			*(recordedRowsFilters.get_ElementAddress(dataSetRowIndex / 64)) &= ~(1ULL << (dataSetRowIndex % 64));
+
+	}
+
+	//records rowFitnessRating as the fitness contribution of dataSetRowIndex;
+	//assumes dataSetRowIndex < the record length
+	void record_RowFitness(const unsigned long long dataSetRowIndex, const double rowFitnessRating)
+	{
+
+		*(rowFitnessRatings.get_ElementAddress(dataSetRowIndex)) = rowFitnessRating;
+		*(recordedRowsFilters.get_ElementAddress(dataSetRowIndex / 64)) |= (1ULL << (dataSetRowIndex % 64));
+
+	}
+
+	//writes the record (its key, length, filters and recorded rows only) to outputFile;
+	//assumes outputFile is open in binary mode
+	void output_RowFitnessRecord_ToOpenFile_Binary(ofstream &outputFile) const
+	{
+
+		const unsigned long long recordLength(rowFitnessRatings.get_ArrayLength());
+		unsigned long long count;
+
+		outputValue_ToOpenFile_Binary(rowFitnessKey, outputFile);
+		outputValue_ToOpenFile_Binary(recordLength, outputFile);
+
+		for (count = 0; count < (recordLength + 63) / 64; count++)
+			outputValue_ToOpenFile_Binary(recordedRowsFilters.get_Element(count), outputFile);
+
+		for (count = 0; count < recordLength; count++)
+		{
+
+			if (recordedRowsFilters.get_Element(count / 64) & (1ULL << (count % 64)))
+				outputValue_ToOpenFile_Binary(rowFitnessRatings.get_Element(count), outputFile);
+
+		}
+
+	}
+
+	//replaces the record with one written by output_RowFitnessRecord_ToOpenFile_Binary()
+	//(load after the net itself, see decode_Genome()); returns false if the read fails or
+	//the record is neither empty nor of dataSetRowCount rows; assumes inputFile is open in
+	//binary mode
+	bool load_RowFitnessRecord_FromOpenFile_Binary(ifstream &inputFile, const unsigned long long dataSetRowCount)
+	{
+
+		unsigned long long recordLength;
+		unsigned long long count;
+
+		clear_RowFitnessRecord();
+
+		if (!inputValue_FromOpenFile_Binary(rowFitnessKey, inputFile)
+			|| !inputValue_FromOpenFile_Binary(recordLength, inputFile)
+			|| (recordLength && recordLength != dataSetRowCount))
+			return false;
+
+		if (!recordLength)
+			return true;
+
+		rowFitnessRatings.resize_NoCopy(recordLength);
+		recordedRowsFilters.resize_NoCopy((recordLength + 63) / 64);
+
+		for (count = 0; count < (recordLength + 63) / 64; count++)
+		{
+
+			if (!inputValue_FromOpenFile_Binary(*(recordedRowsFilters.get_ElementAddress(count)), inputFile))
+				return false;
+
+		}
+
+		//no row beyond the record may be marked recorded
+		if (recordLength % 64 && recordedRowsFilters.get_Element(count - 1) >> (recordLength % 64))
+			return false;
+
+		for (count = 0; count < recordLength; count++)
+		{
+
+			if (recordedRowsFilters.get_Element(count / 64) & (1ULL << (count % 64)))
+			{
+
+				if (!inputValue_FromOpenFile_Binary(*(rowFitnessRatings.get_ElementAddress(count)), inputFile))
+					return false;
+
+			}
+
+		}
+
+		return true;
+
+	}
+
+private:
+
+	//releases all cells in tracedCells; tracedCells elements are left dangling
+	//and must be reassigned or resized before use
+	void release_TracedCells()
+	{
+
+		const unsigned short totalCellCount(tracedCells.get_ArrayLength());
+
+		for (unsigned short count = 0; count < totalCellCount; count++)
+			Cell::release(tracedCells.get_Element(count));
+
+	}
+
 };
 
 #endif // NET_H_INCLUDED
\ No newline at end of file
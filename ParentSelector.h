@@ -0,0 +1,277 @@
+#ifndef PARENTSELECTOR_H_INCLUDED
+#define PARENTSELECTOR_H_INCLUDED
+
+#include "MemoryTools.h"
+#include "RandomTools.h"
+
+//selects parent nets by rank from the survivors of an evolution cycle; ranks
+//run from 0 (top performing net) to survivorCount - 1; every draw is O(1)
+//except tournament draws which are O(tournamentSize)
+class ParentSelector
+{
+
+private:
+
+	unsigned char selectionType; //0 means truncation, 1 tournament, 2 fitness proportional
+	unsigned short tournamentSize; //number of survivors competing in each tournament draw (>= 2)
+
+	unsigned short survivorCount; //number of ranks which may be selected, set by prepare()
+
+	//Walker alias table (fitness proportional selection only), arrays of size >= survivorCount
+	ExtensibleArray<double> aliasProbabilities; //probability of keeping a drawn rank rather than using its alias
+	ExtensibleArray<unsigned short> aliases; //rank used in place of a drawn rank which is not kept
+
+	//returns a random double in the range [0.0, 1.0) with the full 53 bit resolution
+	//of a double (31 bits from one draw and the top 22 bits of a second), so alias
+	//probabilities are honoured exactly and without modulo bias
+	static double get_RandomFraction()
+	{
+
+		const unsigned long long highBits(get_RandomInt());
+		const unsigned long long lowBits(get_RandomInt() >> 9);
+
+		return (static_cast<double>((highBits << 22) | lowBits) / 9007199254740992.0);
+
+	}
+
+	//builds the alias table from fitnessRatings (lower is better); each survivor's
+	//weight is its distance from the worst survivor's fitnessRating plus an even
+	//share of the fitnessRating spread, so the worst survivor keeps a small chance
+	//of selection; all survivors are weighted equally if their ratings are equal
+	void sub_Prepare_AliasTable(ExtensibleArray<double> &fitnessRatings)
+	{
+
+		unsigned short count;
+		double minFitnessRating(fitnessRatings.get_Element(0));
+		double maxFitnessRating(fitnessRatings.get_Element(0));
+		double weightTotal(0.0);
+
+		for (count = 1; count < survivorCount; count++)
+		{
+
+			if (fitnessRatings.get_Element(count) < minFitnessRating)
+				minFitnessRating = fitnessRatings.get_Element(count);
+
+			if (fitnessRatings.get_Element(count) > maxFitnessRating)
+				maxFitnessRating = fitnessRatings.get_Element(count);
+
+		}
+
+		const double weightFloor((maxFitnessRating - minFitnessRating) / static_cast<double>(survivorCount));
+
+		if (aliasProbabilities.get_ArrayLength() < survivorCount)
+		{
+
+			aliasProbabilities.resize_NoCopy(survivorCount);
+			aliases.resize_NoCopy(survivorCount);
+
+		}
+
+		//store each survivor's weight scaled so that the average weight is 1.0
+		for (count = 0; count < survivorCount; count++)
+		{
+
+			*(aliasProbabilities.get_ElementAddress(count)) = (maxFitnessRating
+				- fitnessRatings.get_Element(count)) + weightFloor;
+
+			weightTotal += aliasProbabilities.get_Element(count);
+
+		}
+
+		for (count = 0; count < survivorCount; count++)
+		{
+
+			if (weightTotal > 0.0)
+				*(aliasProbabilities.get_ElementAddress(count)) *= (static_cast<double>(survivorCount) / weightTotal);
+
+			else
+				*(aliasProbabilities.get_ElementAddress(count)) = 1.0;
+
+			*(aliases.get_ElementAddress(count)) = count;
+
+		}
+
+		//pair each underweight rank with an overweight rank (Vose's method); the
+		//underweight ranks are gathered from the front of indices, the overweight
+		//ranks from the back
+		ExtensibleArray<unsigned short> indices(survivorCount);
+		unsigned short underweightCount(0);
+		unsigned short overweightIndex(survivorCount);
+		unsigned short underweightRank;
+		unsigned short overweightRank;
+
+		for (count = 0; count < survivorCount; count++)
+		{
+
+			if (aliasProbabilities.get_Element(count) < 1.0)
+			{
+
+				*(indices.get_ElementAddress(underweightCount)) = count;
+				underweightCount++;
+
+			}
+
+			else
+			{
+
+				overweightIndex--;
+				*(indices.get_ElementAddress(overweightIndex)) = count;
+
+			}
+
+		}
+
+		while (underweightCount && overweightIndex < survivorCount)
+		{
+
+			underweightCount--;
+			underweightRank = indices.get_Element(underweightCount);
+			overweightRank = indices.get_Element(overweightIndex);
+
+			*(aliases.get_ElementAddress(underweightRank)) = overweightRank;
+			*(aliasProbabilities.get_ElementAddress(overweightRank)) -= (1.0 - aliasProbabilities.get_Element(underweightRank));
+
+			//the overweight rank becomes underweight once its excess is used up
+			if (aliasProbabilities.get_Element(overweightRank) < 1.0)
+			{
+
+				*(indices.get_ElementAddress(underweightCount)) = overweightRank;
+				underweightCount++;
+				overweightIndex++;
+
+			}
+
+		}
+
+		//any remaining ranks are (to within rounding) exactly weighted
+		while (underweightCount)
+		{
+
+			underweightCount--;
+			*(aliasProbabilities.get_ElementAddress(indices.get_Element(underweightCount))) = 1.0;
+
+		}
+
+		while (overweightIndex < survivorCount)
+		{
+
+			*(aliasProbabilities.get_ElementAddress(indices.get_Element(overweightIndex))) = 1.0;
+			overweightIndex++;
+
+		}
+
+	}
+
+	//returns a rank drawn according to the current selectionType
+	unsigned short sub_DrawRank() const
+	{
+
+		unsigned short rank(get_RandomInt() % survivorCount);
+
+		//truncation; every survivor is equally likely
+		if (!selectionType)
+			return rank;
+
+		//tournament; the best (lowest) of tournamentSize uniformly drawn ranks
+		if (selectionType == 1)
+		{
+
+			unsigned short contenderRank;
+
+			for (unsigned short count = 1; count < tournamentSize; count++)
+			{
+
+				contenderRank = get_RandomInt() % survivorCount;
+
+				if (contenderRank < rank)
+					rank = contenderRank;
+
+			}
+
+			return rank;
+
+		}
+
+		//fitness proportional; keep the drawn rank or use its alias
+		if (get_RandomFraction() < aliasProbabilities.get_Element(rank))
+			return rank;
+
+		return aliases.get_Element(rank);
+
+	}
+
+public:
+
+	//default constructor; truncation selection
+	ParentSelector() : selectionType(0), tournamentSize(2), survivorCount(1) {}
+
+	//modified constructor; assumes aSelectionType <= 2 and aTournamentSize >= 2
+	ParentSelector(const unsigned char aSelectionType, const unsigned short aTournamentSize)
+		: selectionType(aSelectionType), tournamentSize(aTournamentSize), survivorCount(1) {}
+
+	//destructor
+	~ParentSelector() {}
+
+	//getter
+	unsigned char get_SelectionType() const
+	{
+
+		return selectionType;
+
+	}
+
+	//getter
+	unsigned short get_TournamentSize() const
+	{
+
+		return tournamentSize;
+
+	}
+
+	//prepares selection among the top aSurvivorCount ranks for one evolution
+	//cycle; fitnessRatings holds the survivors' fitnessRatings by rank;
+	//assumes aSurvivorCount >= 1 and fitnessRatings has at least aSurvivorCount elements
+	void prepare(ExtensibleArray<double> &fitnessRatings, const unsigned short aSurvivorCount)
+	{
+
+		survivorCount = aSurvivorCount;
+
+		if (selectionType == 2)
+			sub_Prepare_AliasTable(fitnessRatings);
+
+	}
+
+	//returns the rank of the (only or mother) parent of the childOrdinal'th child
+	//of this cycle; truncation gives every survivor an equal share of children in
+	//rank order, other selection types draw the parent
+	unsigned short select_PrimaryParentRank(const unsigned short childOrdinal) const
+	{
+
+		if (!selectionType)
+			return (childOrdinal % survivorCount);
+
+		return sub_DrawRank();
+
+	}
+
+	//returns the rank of the father parent; truncation never returns
+	//primaryParentRank unless it is the only survivor, other selection types
+	//may select the same parent twice
+	unsigned short select_SecondaryParentRank(const unsigned short primaryParentRank) const
+	{
+
+		if (selectionType || survivorCount == 1)
+			return sub_DrawRank();
+
+		unsigned short rank(get_RandomInt() % (survivorCount - 1));
+
+		if (rank >= primaryParentRank)
+			rank++;
+
+		return rank;
+
+	}
+
+};
+
+#endif // PARENTSELECTOR_H_INCLUDED
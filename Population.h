@@ -1,13 +1,21 @@
 #ifndef POPULATION_H_INCLUDED
 #define POPULATION_H_INCLUDED
 
+#include <cfloat>
+#include <ctime>
 #include "MemoryTools.h"
 #include "CellControl.h"
 #include "Input.h"
 #include "Output.h"
+#include "LossAccumulator.h"
 #include "MathTools.h"
+#include "NativeExpressions.h"
 #include "Net.h"
 #include "EvolutionControl.h"
+#include "ParentSelector.h"
+#include "MutationControl.h"
+#include "RunControl.h"
+#include "EvolutionState.h"
 #include "StringTools.h"
 #include "StimulusTracker.h"
 #include "RecordingModule.h"
@@ -143,31 +151,291 @@ private:
 	DataSetCollection fixedInputs; //used to store/access loaded input data
 	ExtensibleArray<Input_Calculated> calculatedInputs; //array of of length calculatedInputsCount, used to store/access calculated input values
 	ExtensibleArray<Output> outputs; //array of output objects to manage cell output
+	ExtensibleArray<LossAccumulator> lossAccumulators; //array of built-in losses between outputs and fixed input columns, read by evaluation criteria expressions
+	unsigned short lossAccumulatorCount; //number of LossAccumulator members in lossAccumulators
 
 	//update expression properties
 	UniformList<Variable_Double> variablesList; //stores Variable_Double objects refering to doubles stored in fixedInputs, calculatedInputs, and outputs (for use in expressions)
-	UniformList<FixedInputReference> updatingFixedInputsVariables; //refers to only Variable_Double objects referring to fixedInputs data points which are used in expressions
+	UniformList<FixedInputReference> updatingFixedInputsVariables; //refers to only Variable_Double objects referring to fixedInputs data points which are used in expressions (bound once per data set row, see bind_UpdatingFixedInputsVariables())
 	ExtensibleArray<Expression_Double> calculatedInputUpdateExpressions; //array of expressions of size calculatedInputsCount used to update each respective calculatedInput after each data frame
 	ExtensibleArray<Expression_Double> evaluationCriteriaExpressions; //array of expressions of size dataSetRowCount to add to net fitnessRating after data set row iteration in evolve()
+	NativeExpressionLibrary nativeExpressions; //native code the expressions above call when set (see set_NativeExpressions())
 
 	//reproduction/evolution control properties
 	unsigned char reproductionType; //0 means asexual, 1 sexual, 2 sexual selected
 	unsigned char mutationsPerNet; //number of mutations each net will accumlate after each cycle of reproduction in evolve()
 	double mutationAmplitude; //amplitude of each net mutation
 	ExtensibleArray<EvolutionControl> evolutionControls; //array of controls to guide each cycle of reproduction in evolve()
+	ExtensibleArray<bool> fullCoverageControls; //true for each of evolutionControls which evaluates every data set row (see test_CoversAllRows())
+	ParentSelector parentSelector; //selects the surviving nets which parent each child in evolve()
 
 	//structural/functional properties
 	//ExtensibleArray<CellControl> cellControls; //array of cellControls (size == totalCellCount)					   
 	//ExtensibleArray<StimulusTracker> trackers; //cell-associated stimulus trackers (of size totalCellCount)
-	UniformList<Net> nets; //list of size totalNetCount
+	ExtensibleArray<Net> nets; //contiguous slot array of size totalNetCount; slot order never changes during evolution
+	ExtensibleArray<unsigned short> netRanks; //slot indices of nets in order of fitness (best first), array of size totalNetCount
+
+	//incremental evaluation properties
+	bool incrementalEvaluation; //if true, each net re-stimulates only the data frames its changed cells could affect (see set_IncrementalEvaluation())
+	bool calculatedInputsReadOutputs; //true if any calculatedInputUpdateExpression refers to an output, which rules out incremental evaluation
+
+	//net independent calculated input properties (see populate_DataOnlyCalculatedInputs())
+	ExtensibleArray<unsigned short> dataOnlyCalculatedInputIndices; //indices of the calculated inputs whose values depend only on fixed inputs (the same for every net)
+	unsigned short dataOnlyCalculatedInputCount; //number of elements of dataOnlyCalculatedInputIndices in use
+	ExtensibleArray<unsigned short> netCalculatedInputIndices; //indices of the other calculated inputs, which are updated for each net
+	unsigned short netCalculatedInputCount; //number of elements of netCalculatedInputIndices in use
+	ExtensibleArray<double> dataOnlyCalculatedInputValues; //value of data-only calculated input i after data frame f of data set row r at ((r * totalDataFrameCount) + f) * dataOnlyCalculatedInputCount + i
+	ExtensibleArray<bool> dataOnlyValuesComputed; //per data set row, true if its dataOnlyCalculatedInputValues are current (see compute_DataOnlyCalculatedInputs())
+
+	//offspring screening properties
+	bool screening; //if true, children are evaluated on the probe rows of screeningControl before full evaluation (see set_Screening())
+	EvolutionControl screeningControl; //holds the probe data set row indices used in screening (its other properties are unused)
+	double screeningTolerance; //children are predicted competitive if their probe fitnessRating is no more than the worst survivor's plus screeningTolerance (>= 0.0)
+	unsigned short screeningAuditInterval; //every screeningAuditInterval'th screened-out child is fully evaluated anyway to audit screening (0 means never)
+
+	//checkpoint file identification
+	static const unsigned int checkpointFileTag = 0x4B434E4E; //"NNCK" in little endian byte order
+	static const unsigned short checkpointFileVersion = 4;
+
+	//row fitness record property
+	bool rowFitnessRecording; //if true, each net records its fitness contribution per data set row and unchanged nets skip recorded rows (see set_RowFitnessRecording())
+
+	//row fitness records file identification
+	static const unsigned int rowFitnessFileTag = 0x46524E4E; //"NNRF" in little endian byte order
+	static const unsigned short rowFitnessFileVersion = 1;
+
+	//windowed evolution properties
+	istream *rowStream; //source of streamed data set rows (see set_RowStream()), NULL unless windowed evolution is set
+	unsigned short rowsPerCycle; //maximum number of streamed rows taken in before each evolution cycle (>= 1)
+	unsigned long long oldestRowIndex; //index of the data set row the next streamed row replaces
+	Word pendingStreamedRow; //characters of a streamed row whose terminating '\n' has not arrived yet
+
+	//early abort properties
+	bool earlyAbort; //if true, evaluation criteria are declared non-negative and nets which cannot survive are culled mid-evaluation (see set_EarlyAbort())
+	bool negativeCriteriaValue; //true once an evaluation criteria expression returned a negative value in the current evolution run, which suspends culling (see sub_Evolve())
+	unsigned long long negativeCriteriaRowIndex; //data set row whose evaluation criteria expression returned the negative value
+
+	//batched criteria property
+	bool batchedCriteria; //if true, each evolution cycle evaluates evaluation criteria expressions for all its nets together (see set_BatchedCriteria())
 
 	//recording properties
 	RecordedDataSetRowSequence recordingData;
 
 	//***private methods***//
 
+	//returns the address of the net holding position rank in fitness order
+	//(0 is the top performing net); assumes rank < totalNetCount
+	inline Net *get_RankedNet(const unsigned short rank) const
+	{
+
+		return nets.get_ElementAddress(netRanks.get_Element(rank));
+
+	}
+
+	//sets netRanks to slot order (used after nets is (re)initialized)
+	inline void reset_NetRanks()
+	{
+
+		const unsigned short length(nets.get_ArrayLength());
+
+		netRanks.resize_NoCopy(length);
+
+		for (unsigned short count = 0; count < length; count++)
+			*(netRanks.get_ElementAddress(count)) = count;
+
+	}
+
+	//sorts the first rankedNetCount elements of netRanks in order of fitness (lowest
+	//fitnessRating first) without moving any nets; insertion sort is used since rank
+	//order changes little from one evolution cycle to the next; assumes
+	//rankedNetCount <= totalNetCount
+	inline void sort_NetRanks(const unsigned short rankedNetCount)
+	{
+
+		const unsigned short length(rankedNetCount);
+		unsigned short rankIndex;
+		unsigned short priorRankIndex;
+		unsigned short slotIndex;
+		double fitnessRating;
+
+		for (rankIndex = 1; rankIndex < length; rankIndex++)
+		{
+
+			slotIndex = netRanks.get_Element(rankIndex);
+			fitnessRating = nets.get_ElementAddress(slotIndex)->get_FitnessRating();
+			priorRankIndex = rankIndex;
+
+			while (priorRankIndex && fitnessRating < nets.get_ElementAddress(
+				netRanks.get_Element(priorRankIndex - 1))->get_FitnessRating())
+			{
+
+				*(netRanks.get_ElementAddress(priorRankIndex)) = netRanks.get_Element(priorRankIndex - 1);
+				priorRankIndex--;
+
+			}
+
+			*(netRanks.get_ElementAddress(priorRankIndex)) = slotIndex;
+
+		}
+
+	}
+
+
+
+
+	//sets evolutionControls to a single control which evaluates every data set row
+	//with every net and allows the top half of the population to survive each cycle
+	//(used when no evolution schedule has been set)
+	inline void reset_EvolutionControls()
+	{
+
+		UniformList<unsigned long long> allDataSetRowIndices;
+
+		for (unsigned long long count = 0; count < dataSetRowCount; count++)
+			allDataSetRowIndices.add_NewNode(count);
+
+		evolutionControls.resize_NoCopy(1);
+		*(evolutionControls.get_ElementAddress(0)) = EvolutionControl(totalNetCount,
+			DBL_MAX, 1, allDataSetRowIndices);
+
+		fullCoverageControls.resize_NoCopy(1);
+		*(fullCoverageControls.get_ElementAddress(0)) = true;
+
+	}
+
+	//prepares parentSelector to select among the top survivorCount ranked nets;
+	//survivorFitnessRatings is used for storage and assumed to be of size totalNetCount
+	inline void prepare_ParentSelector(const unsigned short survivorCount,
+		ExtensibleArray<double> &survivorFitnessRatings)
+	{
+
+		for (unsigned short count = 0; count < survivorCount; count++)
+			*(survivorFitnessRatings.get_ElementAddress(count)) = get_RankedNet(count)->get_FitnessRating();
+
+		parentSelector.prepare(survivorFitnessRatings, survivorCount);
+
+	}
+
+	//returns the number of the childCount children (identified by slot index in
+	//childSlotIndices) whose fitnessRating is now lower than the fitnessRating
+	//recorded for their parent(s) in parentFitnessRatings; sets trialCount to the
+	//number of children which were fully evaluated, children culled or screened out
+	//(whose fitnessRating is DBL_MAX) being neither successes nor trials
+	inline unsigned short count_SuccessfulChildren(ExtensibleArray<unsigned short> &childSlotIndices,
+		ExtensibleArray<double> &parentFitnessRatings, const unsigned short childCount,
+		unsigned short &trialCount) const
+	{
+
+		unsigned short successCount(0);
+		double fitnessRating;
+
+		trialCount = 0;
+
+		for (unsigned short count = 0; count < childCount; count++)
+		{
+
+			fitnessRating = nets.get_ElementAddress(childSlotIndices.get_Element(count))->get_FitnessRating();
+
+			if (fitnessRating == DBL_MAX)
+				continue;
+
+			trialCount++;
+
+			if (fitnessRating < parentFitnessRatings.get_Element(count))
+				successCount++;
+
+		}
+
+		return successCount;
+
+	}
+
+	//advances evolutionControlIndex once the current control has been used for
+	//its totalRepetitions cycles; the schedule restarts after its final control
+	inline void iterate_EvolutionControl(unsigned long long &evolutionControlIndex,
+		unsigned short &repetitionCount) const
+	{
+
+		repetitionCount++;
+
+		if (repetitionCount < evolutionControls.get_ElementAddress(
+			evolutionControlIndex)->get_TotalRepetitions())
+			return;
 
+		repetitionCount = 0;
+		evolutionControlIndex++;
 
+		if (evolutionControlIndex == evolutionControls.get_ArrayLength())
+			evolutionControlIndex = 0;
+
+	}
+
+	//returns the number of nets which take part in evolution cycles under
+	//currentEvolutionControl (its maxPopulationSize capped at totalNetCount)
+	inline unsigned short get_ActiveNetCount(EvolutionControl *currentEvolutionControl) const
+	{
+
+		if (currentEvolutionControl->get_MaxPopulationSize() < totalNetCount)
+			return currentEvolutionControl->get_MaxPopulationSize();
+
+		return totalNetCount;
+
+	}
+
+	//returns true if currentEvolutionControl evaluates every data set row, the only
+	//evolution controls whose fitnessRatings are comparable across the whole schedule
+	bool test_CoversAllRows(EvolutionControl *currentEvolutionControl) const
+	{
+
+		const unsigned long long length(currentEvolutionControl->get_DataSetRowIndicesLength());
+		ExtensibleArray<bool> coveredRows(dataSetRowCount);
+		unsigned long long coveredRowCount(0);
+		unsigned long long dataSetRowIndex;
+
+		for (dataSetRowIndex = 0; dataSetRowIndex < dataSetRowCount; dataSetRowIndex++)
+			*(coveredRows.get_ElementAddress(dataSetRowIndex)) = false;
+
+		for (unsigned long long count = 0; count < length; count++)
+		{
+
+			dataSetRowIndex = currentEvolutionControl->get_DataSetRowIndicesElement(count);
+
+			if (!coveredRows.get_Element(dataSetRowIndex))
+			{
+
+				*(coveredRows.get_ElementAddress(dataSetRowIndex)) = true;
+				coveredRowCount++;
+
+			}
+
+		}
+
+		return (coveredRowCount == dataSetRowCount);
+
+	}
+
+	//returns the number of top ranked nets which survive to reproduce under
+	//currentEvolutionControl; nets survive if their fitnessRating is no more than
+	//the control's survivalThreshold, but at least the top net and at most the
+	//top half (rounded up) of the active nets survive; nets culled or screened out
+	//of evaluation (fitnessRating of DBL_MAX) only survive as the top net; assumes
+	//the first activeNetCount ranks have been sorted
+	inline unsigned short get_SurvivorCount(EvolutionControl *currentEvolutionControl,
+		const unsigned short activeNetCount) const
+	{
+
+		const unsigned short maxSurvivorCount(activeNetCount - (activeNetCount / 2));
+		const double survivalThreshold(currentEvolutionControl->get_SurvivalThreshold());
+		unsigned short survivorCount(1);
+
+		while (survivorCount < maxSurvivorCount
+			&& get_RankedNet(survivorCount)->get_FitnessRating() <= survivalThreshold
+			&& get_RankedNet(survivorCount)->get_FitnessRating() < DBL_MAX)
+			survivorCount++;
+
+		return survivorCount;
+
+	}
 
 	//***WORK FROM HERE TO CONTINUE IMPLEMENTING CHANGES, MAYBE BREAK UP SOME PORTIONS OF THE SUB_STIMULATE FUNCTIONS
 	//AND REDISTRIBUTE THEM TO NET CLASS, ALSO GO BACK TO CELL AND REMOVE ANY NOW UNUSED GETTER/SETTER FUNCTIONS***
@@ -180,7 +448,7 @@ private:
 	//assumes netCells contains more than inputCellCount + outputCellCount
 	//assumes dataFrameIndex < totalDataFrameCount
 	inline void stimulate_SingleFrame(const unsigned long long dataSetRowIndex,
-		const unsigned long long dataFrameIndex, ExtensibleArray<Cell> &netCells,
+		const unsigned long long dataFrameIndex, ExtensibleArray<Cell*> &netCells,
 		ExtensibleArray<int> &activationListRoundA, ExtensibleArray<int> &activationListRoundB)
 	{
 
@@ -189,7 +457,7 @@ private:
 		const unsigned short totalCellCount(netCells.get_ArrayLength());
 
 		for (cellIndex = 0; cellIndex < totalCellCount; cellIndex++)
-			netCells.get_ElementAddress(cellIndex)->reset();
+			netCells.get_Element(cellIndex)->reset();
 
 		//other initial setup
 		unsigned short currentRoundActivationListPositionIndex(0);
@@ -214,7 +482,7 @@ private:
 			do
 			{
 
-				cell = netCells.get_ElementAddress(cellIndex);
+				cell = netCells.get_Element(cellIndex);
 
 				//pass external input to the input cell
 				cell->addStimulus_FirstRound(fixedInputs.get_FrameAdjustedDataPoint(
@@ -247,7 +515,7 @@ private:
 
 			calculatedInput = calculatedInputs.get_ElementAddress(dataSetColumnIndex);
 
-			cell = netCells.get_ElementAddress(cellIndex);
+			cell = netCells.get_Element(cellIndex);
 			tracker = trackers.get_ElementAddress(cellIndex);
 
 			//pass external input to the input cell
@@ -297,7 +565,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_ElementAddress(
+					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_Element(
 						preCellIndex), netCells, roundCount);
 
 					currentRoundActivationListPositionIndex++;
@@ -313,7 +581,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_ElementAddress(
+					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_Element(
 						preCellIndex), netCells, roundCount, nextRound, nextRoundActivationListPositionIndex);
 
 					currentRoundActivationListPositionIndex++;
@@ -346,7 +614,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_ElementAddress(
+					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_Element(
 						preCellIndex), netCells, roundCount);
 
 					currentRoundActivationListPositionIndex++;
@@ -362,7 +630,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_ElementAddress(
+					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_Element(
 						preCellIndex), netCells, roundCount, nextRound, nextRoundActivationListPositionIndex);
 
 					currentRoundActivationListPositionIndex++;
@@ -421,7 +689,7 @@ private:
 	//assumes currentRow is not NULL and corresponds to the node in recordingData
 	//which is currently being populated 
 	inline void stimulate_SingleFrame_Recorded(const unsigned long long dataSetRowIndex,
-		const unsigned long long dataFrameIndex, ExtensibleArray<Cell> &netCells,
+		const unsigned long long dataFrameIndex, ExtensibleArray<Cell*> &netCells,
 		ExtensibleArray<int> &activationListRoundA, ExtensibleArray<int> &activationListRoundB,
 		UniformNode<RecordedDataSetRow> *currentRow)
 	{
@@ -456,7 +724,7 @@ private:
 			do
 			{
 
-				cell = netCells.get_ElementAddress(cellIndex);
+				cell = netCells.get_Element(cellIndex);
 				tracker = trackers.get_ElementAddress(cellIndex);
 
 				//pass external input to the input cell
@@ -490,7 +758,7 @@ private:
 
 			calculatedInput = calculatedInputs.get_ElementAddress(dataSetColumnIndex);
 
-			cell = netCells.get_ElementAddress(cellIndex);
+			cell = netCells.get_Element(cellIndex);
 			tracker = trackers.get_ElementAddress(cellIndex);
 
 			//pass external input to the input cell
@@ -544,7 +812,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_ElementAddress(
+					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_Element(
 						preCellIndex), netCells, roundCount);
 
 					currentRoundActivationListPositionIndex++;
@@ -560,7 +828,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_ElementAddress(
+					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_Element(
 						preCellIndex), netCells, roundCount, nextRound, nextRoundActivationListPositionIndex);
 
 					currentRoundActivationListPositionIndex++;
@@ -597,7 +865,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_ElementAddress(
+					sub_Stimulate_AddStimulus_LaterRounds(netCells.get_Element(
 						preCellIndex), netCells, roundCount);
 
 					currentRoundActivationListPositionIndex++;
@@ -613,7 +881,7 @@ private:
 				do
 				{
 
-					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_ElementAddress(
+					sub_Stimulate_PopulateNextActivationList_FromPostCells(netCells.get_Element(
 						preCellIndex), netCells, roundCount, nextRound, nextRoundActivationListPositionIndex);
 
 					currentRoundActivationListPositionIndex++;
@@ -664,673 +932,687 @@ private:
 
 	}
 
-	//iterates through all data frames in all data set rows referred to by currentEvolutionControl
-	//one time; updates nets' performance ratings in the process, but does not sort or reproduce them
-	//assumes currentEvolutionControl != NULL
-	inline void stimulate_AllFrames_SingleEvolutionCycle(ExtensibleArray<int> &activationListRoundA,
-		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues)
-		//EvolutionControl *currentEvolutionControl)
+	//stimulates net for a single data frame unless net's trace shows that none of its
+	//changed cells were touched in this frame, in which case the traced output values
+	//are restored to outputs instead; records the cells touched and the output values
+	//whenever net is stimulated; assumes net->begin_Trace() has been called
+	inline void stimulate_SingleFrame_Incremental(const unsigned long long dataSetRowIndex,
+		const unsigned long long dataFrameIndex, Net *net,
+		ExtensibleArray<int> &activationListRoundA, ExtensibleArray<int> &activationListRoundB)
 	{
 
-		//initial setup
-		UniformNode<Net> *netNode(nets.get_FirstNode());
-		unsigned long long dataSetRowIndex;
-		//unsigned long long evolutionControlInternalIndex;
-		//unsigned long long evolutionControlInternalLength(currentEvolutionControl->get_DataSetRowIndicesLength());
-		unsigned long long dataFrameIndex;
+		const unsigned long long traceIndex(dataSetRowIndex * totalDataFrameCount + dataFrameIndex);
+		const unsigned long long tracedOutputIndex(traceIndex * outputCellCount);
+		unsigned long long *touchedCellsFilter(net->get_TouchedCellsFilterAddress(traceIndex));
 		unsigned short count;
-		UniformNode<FixedInputReference> *fixedInputsVariableNode;
 
-		//net loop
-		do
+		//the recorded frame is still valid, reuse its output values
+		if (*touchedCellsFilter)
 		{
 
-			//reset the net's fitness rating
-			netNode->content.reset_FitnessRating();
+			for (count = 0; count < outputCellCount; count++)
+				outputs.get_ElementAddress(count)->set_Value(
+					*(net->get_TracedOutputValueAddress(tracedOutputIndex + count)));
 
-			dataSetRowIndex = 0;
-			//evolutionControlInternalIndex = 0;
+			return;
 
-			//data set row loop 
-			do
-			{
+		}
 
-				//set the correct data set row
-				//dataSetRowIndex = currentEvolutionControl->get_DataSetRowIndicesElement(
-					//evolutionControlInternalIndex);
+		ExtensibleArray<Cell*> &netCells(net->get_Cells());
+		const unsigned short totalCellCount(netCells.get_ArrayLength());
 
-				//reset calculated inputs to default values
-				for (count = 0; count < calculatedInputsCount; count++)
-					calculatedInputs.get_ElementAddress(count)->reset();
+		stimulate_SingleFrame(dataSetRowIndex, dataFrameIndex, netCells,
+			activationListRoundA, activationListRoundB);
 
-				dataFrameIndex = 0;
+		//record the cells touched by this frame's cascade and the resulting output values
+		for (count = 0; count < totalCellCount; count++)
+		{
 
-				//data frame loop
-				do
-				{
+			if (netCells.get_Element(count)->test_Touched())
+				*touchedCellsFilter |= (1ULL << (count % 64));
 
-					//stimulate the net
-					stimulate_SingleFrame(dataSetRowIndex, dataFrameIndex, netNode->content.get_Cells(),
-						activationListRoundA, activationListRoundB);
+		}
 
-					//iterate the data frame
-					dataFrameIndex++;
+		for (count = 0; count < outputCellCount; count++)
+			*(net->get_TracedOutputValueAddress(tracedOutputIndex + count)) =
+				outputs.get_ElementAddress(count)->get_Value();
 
-					//reassign any fixedInputs dataPoint variables used in
-					//calculatedInputUpdateExpressions to prep for the next dataFrame
-					fixedInputsVariableNode = updatingFixedInputsVariables.get_FirstNode();
+	}
 
-					while (fixedInputsVariableNode)
-					{
+	//iterates through all data frames in dataSetRowIndex one time for net, leaving the
+	//calculated inputs, outputs and losses the row's evaluation criteria expression reads
+	//(evaluated for data frame totalDataFrameCount); if traced is true the net's
+	//incremental evaluation trace is used and updated (see
+	//stimulate_SingleFrame_Incremental()); assumes dataSetRowIndex < dataSetRowCount
+	inline void stimulate_AllFrames_SingleRow_Unrated(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
+		const unsigned long long dataSetRowIndex, Net *net, const bool traced)
+	{
 
-						fixedInputsVariableNode->content.get_DataPointVariable()->reassign_Value(
-							fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
-								fixedInputsVariableNode->content.get_DataPointColumnIndex(),
-								dataFrameIndex, fixedInputsVariableNode->content.get_DataPointFrameSubIndex()));
+		unsigned long long dataFrameIndex(0);
+		unsigned long long dataOnlyValueIndex(dataSetRowIndex * totalDataFrameCount * dataOnlyCalculatedInputCount);
+		unsigned short count;
 
-						fixedInputsVariableNode = fixedInputsVariableNode->get_NextNode();
+		bind_UpdatingFixedInputsVariables(dataSetRowIndex);
+		compute_DataOnlyCalculatedInputs(dataSetRowIndex);
 
-					}
+		//reset calculated inputs to default values
+		for (count = 0; count < calculatedInputsCount; count++)
+			calculatedInputs.get_ElementAddress(count)->reset();
 
-					//update calculatedInputs values via calculatedInputUpdateExpressions
-					//(done here in two steps so that calculatedInputs members can effectively
-					//be updated in parallel, not in series to ensure that changes occuring within
-					//each member round do not impact calculations of members in later array position
-					//in context of the current dataFrame iteration)
-					for (count = 0; count < calculatedInputsCount; count++)
-						*(calculatedInputsPrepValues.get_ElementAddress(count)) =
-						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate();
+		//data frame loop
+		do
+		{
 
-					for (count = 0; count < calculatedInputsCount; count++)
-						calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
-							calculatedInputsPrepValues.get_Element(count));
+			//stimulate the net
+			if (traced)
+				stimulate_SingleFrame_Incremental(dataSetRowIndex, dataFrameIndex, net,
+					activationListRoundA, activationListRoundB);
 
-				} while (dataFrameIndex < totalDataFrameCount);
+			else
+				stimulate_SingleFrame(dataSetRowIndex, dataFrameIndex, net->get_Cells(),
+					activationListRoundA, activationListRoundB);
 
-				//update the net's fitness rating
-				netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
-					dataSetRowIndex)->evaluate());
+			//record the outputs compared by lossAccumulators
+			record_LossAccumulatorOutputs(dataFrameIndex);
 
-				dataSetRowIndex++;
-				//evolutionControlInternalIndex++;
+			//iterate the data frame
+			dataFrameIndex++;
 
-			} while (dataSetRowIndex < dataSetRowCount);
-			//} while (evolutionControlInternalIndex < evolutionControlInternalLength);
+			//update net dependent calculatedInputs values via calculatedInputUpdateExpressions
+			//(done here in two steps so that calculatedInputs members can effectively
+			//be updated in parallel, not in series to ensure that changes occuring within
+			//each member round do not impact calculations of members in later array position
+			//in context of the current dataFrame iteration)
+			for (count = 0; count < netCalculatedInputCount; count++)
+				*(calculatedInputsPrepValues.get_ElementAddress(count)) =
+				calculatedInputUpdateExpressions.get_ElementAddress(
+					netCalculatedInputIndices.get_Element(count))->evaluate(dataFrameIndex);
 
-			netNode = netNode->get_NextNode();
+			for (count = 0; count < netCalculatedInputCount; count++)
+				calculatedInputs.get_ElementAddress(netCalculatedInputIndices.get_Element(count))->set_CurrentValue(
+					calculatedInputsPrepValues.get_Element(count));
+
+			//data-only calculatedInputs take their precomputed values
+			for (count = 0; count < dataOnlyCalculatedInputCount; count++)
+				calculatedInputs.get_ElementAddress(dataOnlyCalculatedInputIndices.get_Element(count))->set_CurrentValue(
+					dataOnlyCalculatedInputValues.get_Element(dataOnlyValueIndex++));
 
-		} while (netNode);
+		} while (dataFrameIndex < totalDataFrameCount);
+
+		accumulate_Losses(dataSetRowIndex);
 
 	}
 
+	//iterates through all data frames in dataSetRowIndex one time for net and returns the
+	//row's evaluation criteria value (its contribution to net's fitnessRating); if traced
+	//is true the net's incremental evaluation trace is used and updated (see
+	//stimulate_SingleFrame_Incremental()); assumes dataSetRowIndex < dataSetRowCount
+	inline double stimulate_AllFrames_SingleRow(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
+		const unsigned long long dataSetRowIndex, Net *net, const bool traced)
+	{
 
+		stimulate_AllFrames_SingleRow_Unrated(activationListRoundA, activationListRoundB,
+			calculatedInputsPrepValues, dataSetRowIndex, net, traced);
 
-	//*** WORK FROM HERE TO CHANGE THE LOGIC OF THE FUNCTIONS BELOW TO MATCH THAT ABOVE
-	//ALSO RECONSIDER/REFACTOR THE RECORDING FUNCTIONS TO BE MORE MANAGEABLE AND SO THEY
-	//WILL FOLLOW THE NEW PARADIGM FOR RECORDING (USING SUB FUNCTIONS TO MAKE COMPOUNDING CHANGES MORE MANAGEABLE)***
+		return evaluationCriteriaExpressions.get_ElementAddress(dataSetRowIndex)->evaluate(totalDataFrameCount);
 
-/*
+	}
 
-	//uses all data sets/frames to stimulate only the top performing net; updates
-	//the net's performance rating in the process, but does not sort; outputs in CSV format
-	//assumes outputFile is already open
-	inline void stimulate_AllFramesAllParallels_CSVMinimalRecord(ExtensibleArray<int> &activationListRoundA,
+	//iterates through all data frames in all data set rows referred to by rowsControl one
+	//time for net; resets and updates net's fitness rating in the process; if traced is true
+	//the net's incremental evaluation trace is used and updated (see
+	//stimulate_SingleFrame_Incremental()), traced must be false unless rowsControl is an
+	//evolution control; if rowFitnessRecording is set, rows already recorded for net's
+	//current cells are not stimulated (their recorded contributions are used) and all
+	//other rows are recorded; if earlyAbort is set (and no negative criteria value has been
+	//found, see negativeCriteriaValue) and net's partial fitnessRating exceeds
+	//abortFitnessRating after any row, the net is culled (given a fitnessRating of DBL_MAX)
+	//and its remaining rows are skipped; returns the number of rows stimulated;
+	//assumes rowsControl != NULL
+	inline unsigned long long stimulate_AllFrames_SingleNet(ExtensibleArray<int> &activationListRoundA,
 		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
-		ofstream &outputFile)
+		EvolutionControl *rowsControl, Net *net, const bool traced, const double abortFitnessRating)
 	{
 
 		//initial setup
-		UniformNode<Net> *netNode(nets.get_FirstNode());
+		double fitnessRatingModifier;
 		unsigned long long dataSetRowIndex;
-		unsigned long long dataFrameIndex;
-		unsigned short count;
-		UniformNode<FixedInputReference> *fixedInputsVariableNode;
-
-		//***<RECORDING>***
-		unsigned short recordingCalculatedInputIndex;
-		unsigned short recordingOutputIndex;
-		ExtensibleArray<unsigned short> dataSetColumnFrameIndices(dataSetColumnCount);
-		unsigned short maxShiftLengthMinusOne(1);
-		unsigned short maxFrameLength(1);
-		unsigned short recordingSubFrameIndex;
-		
-		for (count = 0; count < dataSetColumnCount; count++)
-		{
-
-			if (fixedInputs.get_ColumnShiftLength(count) > maxShiftLengthMinusOne)
-				maxShiftLengthMinusOne = fixedInputs.get_ColumnShiftLength(count);
-
-			if (fixedInputs.get_ColumnFrameLength(count) > maxFrameLength)
-				maxFrameLength = fixedInputs.get_ColumnFrameLength(count);
-
-		}
-		
-		maxShiftLengthMinusOne--;
-		//***</RECORDING>***
+		unsigned long long rowsControlInternalIndex(0);
+		const unsigned long long rowsControlInternalLength(rowsControl->get_DataSetRowIndicesLength());
+		unsigned long long stimulatedRowCount(0);
 
 		//reset the net's fitness rating
-		netNode->content.reset_FitnessRating();
+		net->reset_FitnessRating();
 
-		dataSetRowIndex = 0;
+		//clear any traced frames which the net's changed cells may affect (rows
+		//served from the row fitness record leave their cleared frames unrecorded,
+		//which later evaluations of those rows re-stimulate)
+		if (traced)
+			net->begin_Trace(dataSetRowCount * totalDataFrameCount, outputCellCount);
 
-		//data set row loop
+		//keep the net's row fitness record only if its cells are unchanged
+		if (rowFitnessRecording)
+			net->begin_RowFitnessRecord(dataSetRowCount);
+
+		//data set row loop 
 		do
 		{
 
-			//reset calculated inputs to default values
-			for (count = 0; count < calculatedInputsCount; count++)
-				calculatedInputs.get_ElementAddress(count)->reset();
-
-			dataFrameIndex = 0;
-
-			//***<RECORDING>***
-			outputFile << "\n\n";
-			fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
+			//set the correct data set row
+			dataSetRowIndex = rowsControl->get_DataSetRowIndicesElement(
+				rowsControlInternalIndex);
 
-			for (count = 0; count < dataSetColumnCount; count++)
+			if (!rowFitnessRecording || !net->get_RecordedRowFitness(dataSetRowIndex, fitnessRatingModifier))
 			{
 
-				outputFile << ",";
-				fixedInputs.get_ColumnName(count).output_ToOpenFile(outputFile);
-
-			}
+				fitnessRatingModifier = stimulate_AllFrames_SingleRow(activationListRoundA,
+					activationListRoundB, calculatedInputsPrepValues, dataSetRowIndex, net, traced);
 
-			for (count = 0; count < calculatedInputsCount; count++)
-			{
+				stimulatedRowCount++;
 
-				outputFile << ",";
-				calculatedInputs.get_ElementAddress(count)->get_Name().output_ToOpenFile(outputFile);
+				if (rowFitnessRecording)
+					net->record_RowFitness(dataSetRowIndex, fitnessRatingModifier);
 
 			}
 
-			for (count = 0; count < outputCellCount; count++)
-			{
+			//update the net's fitness rating
+			net->modify_FitnessRating(fitnessRatingModifier);
 
-				outputFile << ",";
-				outputs.get_ElementAddress(count)->get_Name().output_ToOpenFile(outputFile);
+			rowsControlInternalIndex++;
 
-			}
+			if (earlyAbort && !negativeCriteriaValue)
+			{
 
-			//leading fixed set data
-			for (count = 0; count < dataSetColumnCount; count++)
-				*(dataSetColumnFrameIndices.get_ElementAddress(count)) = 0;
+				//the declared non-negativity does not hold, partial sums are not bounds
+				if (fitnessRatingModifier < 0.0)
+				{
 
-			outputFile << "\n";
+					negativeCriteriaValue = true;
+					negativeCriteriaRowIndex = dataSetRowIndex;
 
-			for (recordingSubFrameIndex = 0; recordingSubFrameIndex < maxFrameLength - (maxShiftLengthMinusOne + 1); recordingSubFrameIndex++)
-			{
+				}
 
-				for (count = 0; count < dataSetColumnCount; count++)
+				//the net cannot survive, cull it (any partially rebuilt trace is
+				//left incomplete so that its cleared frames are cleared again)
+				else if (net->get_FitnessRating() > abortFitnessRating
+					&& rowsControlInternalIndex < rowsControlInternalLength)
 				{
 
-					outputFile << ",";
+					net->reset_FitnessRating();
+					net->modify_FitnessRating(DBL_MAX);
 
-					if (dataSetColumnFrameIndices.get_Element(count) < fixedInputs.get_ColumnFrameLength(count))
-					{
+					return stimulatedRowCount;
 
-						outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex,
-							count, dataFrameIndex, dataSetColumnFrameIndices.get_Element(count));
+				}
 
-						*(dataSetColumnFrameIndices.get_ElementAddress(count)) += 1;
+			}
 
-					}
+		} while (rowsControlInternalIndex < rowsControlInternalLength);
 
-				}
+		//every cleared frame of a stimulated row has been recorded again
+		if (traced)
+			net->complete_Trace();
 
-				for (recordingCalculatedInputIndex = 0; recordingCalculatedInputIndex < calculatedInputsCount; recordingCalculatedInputIndex++)
-					outputFile << ",";
-
-				for (recordingOutputIndex = 0; recordingOutputIndex < outputCellCount; recordingOutputIndex++)
-					outputFile << ",";
-
-				outputFile << "\n";
-
-			}
-			//***</RECORDING>***
-
-			//data frame loop
-			do
-			{
-
-				//***<RECORDING>***
-				for (count = 0; count < dataSetColumnCount; count++)
-					*(dataSetColumnFrameIndices.get_ElementAddress(count)) = fixedInputs.get_ColumnFrameLength(count) - (maxShiftLengthMinusOne + 1);
+		return stimulatedRowCount;
 
-				//all but final iteration
-				for (recordingSubFrameIndex = 0; recordingSubFrameIndex < maxShiftLengthMinusOne; recordingSubFrameIndex++)
-				{
+	}
 
-					for (count = 0; count < dataSetColumnCount; count++)
-					{
+	//as stimulate_AllFrames_SingleEvolutionCycle() without early abort, but each row's
+	//evaluation criteria expression is evaluated once for every net evaluated (see
+	//Expression_Double::evaluate_Batch()) rather than once per net; rows are visited in
+	//the order of currentEvolutionControl, and within each row every net is stimulated
+	//in turn, the values it leaves in the variables the criteria read, other than fixed
+	//inputs (its calculated inputs, outputs and losses), being collected into one
+	//contiguous column per variable with one lane per net; the row's criteria are then
+	//evaluated for every lane and the nets' fitnessRatings updated before the next row,
+	//so each is the same as when evaluated net by net; rows served from a net's row
+	//fitness record take the recorded value instead; returns the number of net row
+	//evaluations made; assumes currentEvolutionControl != NULL, assumes
+	//2 <= activeNetCount <= totalNetCount
+	inline unsigned long long stimulate_AllFrames_SingleEvolutionCycle_Batched(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
+		EvolutionControl *currentEvolutionControl, const unsigned short activeNetCount,
+		ExtensibleArray<bool> *screenedOutNets)
+	{
 
-						outputFile << ",";
+		//initial setup
+		const unsigned long long rowsLength(currentEvolutionControl->get_DataSetRowIndicesLength());
+		const unsigned short netVariableCount(calculatedInputsCount + outputCellCount + lossAccumulatorCount);
+		ExtensibleArray<unsigned short> laneNetSlotIndices(activeNetCount);
+		ExtensibleArray<Variable_Double*> netVariables(netVariableCount);
+		ExtensibleArray<VariableColumn> variableColumns(netVariableCount);
+		ExtensibleArray<double> variableValues(netVariableCount * activeNetCount);
+		ExtensibleArray<double> recordedRowFitness(activeNetCount);
+		ExtensibleArray<bool> rowsRecorded(activeNetCount);
+		ExtensibleArray<double> batchResults(activeNetCount);
+		UniformNode<Variable_Double> *variableNode(variablesList.get_FirstNode());
+		Net *net;
+		unsigned long long rowPosition;
+		unsigned long long dataSetRowIndex;
+		unsigned long long netRowEvaluations(0);
+		unsigned short count;
+		unsigned short netSlotIndex;
+		unsigned short laneCount(0);
+		unsigned short lane;
+		unsigned short variableCount;
+		double fitnessRatingModifier;
+
+		//calculated input, output and loss variables lead variablesList; each reads its
+		//lanes from one column of variableValues
+		for (variableCount = 0; variableCount < netVariableCount; variableCount++)
+		{
 
-						if (dataSetColumnFrameIndices.get_Element(count) < fixedInputs.get_ColumnFrameLength(count))
-						{
+			*(netVariables.get_ElementAddress(variableCount)) = &(variableNode->content);
+			*(variableColumns.get_ElementAddress(variableCount)) = VariableColumn(&(variableNode->content),
+				variableValues.get_ElementAddress(variableCount * activeNetCount));
+			variableNode = variableNode->get_NextNode();
 
-							outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex,
-								count, dataFrameIndex, dataSetColumnFrameIndices.get_Element(count));
+		}
 
-							*(dataSetColumnFrameIndices.get_ElementAddress(count)) += 1;
+		//net setup (nets are visited as in stimulate_AllFrames_SingleEvolutionCycle(),
+		//each takes the next lane)
+		for (count = 0; count < activeNetCount; count++)
+		{
 
-						}
+			if (activeNetCount == totalNetCount)
+				netSlotIndex = count;
 
-					}
+			else
+				netSlotIndex = netRanks.get_Element(count);
 
-					for (recordingCalculatedInputIndex = 0; recordingCalculatedInputIndex < calculatedInputsCount; recordingCalculatedInputIndex++)
-						outputFile << ",";
+			if (screenedOutNets && screenedOutNets->get_Element(netSlotIndex))
+				continue;
 
-					for (recordingOutputIndex = 0; recordingOutputIndex < outputCellCount; recordingOutputIndex++)
-						outputFile << ",";
+			net = nets.get_ElementAddress(netSlotIndex);
+			*(laneNetSlotIndices.get_ElementAddress(laneCount)) = netSlotIndex;
 
-					outputFile << "\n";
+			net->reset_FitnessRating();
 
-				}
+			if (incrementalEvaluation)
+				net->begin_Trace(dataSetRowCount * totalDataFrameCount, outputCellCount);
 
-				if (!maxShiftLengthMinusOne && dataFrameIndex)
-					outputFile << "\n";
+			if (rowFitnessRecording)
+				net->begin_RowFitnessRecord(dataSetRowCount);
 
-				//final iteration
-				outputFile << "dataFrame_" << dataFrameIndex;
+			laneCount++;
 
-				for (count = 0; count < dataSetColumnCount; count++)
-				{
+		}
 
-					outputFile << ",";
+		//data set row loop
+		for (rowPosition = 0; rowPosition < rowsLength; rowPosition++)
+		{
 
-					if (dataSetColumnFrameIndices.get_Element(count) < fixedInputs.get_ColumnFrameLength(count))
-					{
+			dataSetRowIndex = currentEvolutionControl->get_DataSetRowIndicesElement(rowPosition);
 
-						outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex,
-							count, dataFrameIndex, dataSetColumnFrameIndices.get_Element(count));
+			//stimulate the row for every net, collecting the values the row's criteria
+			//read into the net's lane
+			for (lane = 0; lane < laneCount; lane++)
+			{
 
-						*(dataSetColumnFrameIndices.get_ElementAddress(count)) += 1;
+				net = nets.get_ElementAddress(laneNetSlotIndices.get_Element(lane));
 
-					}
+				*(rowsRecorded.get_ElementAddress(lane)) = (rowFitnessRecording
+					&& net->get_RecordedRowFitness(dataSetRowIndex, *(recordedRowFitness.get_ElementAddress(lane))));
 
-				}
+				if (rowsRecorded.get_Element(lane))
+					continue;
 
-				for (count = 0; count < calculatedInputsCount; count++)
-				{
+				stimulate_AllFrames_SingleRow_Unrated(activationListRoundA, activationListRoundB,
+					calculatedInputsPrepValues, dataSetRowIndex, net, incrementalEvaluation);
 
-					outputFile << "," << calculatedInputs.get_ElementAddress(
-						count)->get_CurrentValue();
+				netRowEvaluations++;
 
-				}
-				//***</RECORDING>***
+				for (variableCount = 0; variableCount < netVariableCount; variableCount++)
+					*(variableValues.get_ElementAddress(variableCount * activeNetCount + lane))
+						= netVariables.get_Element(variableCount)->get_Value();
 
-				//stimulate the net
-				stimulate_SingleFrame(dataSetRowIndex, dataFrameIndex, netNode->content.get_Cells(),
-					activationListRoundA, activationListRoundB);
+			}
 
-				//***<RECORDING>***
-				for (count = 0; count < outputCellCount; count++)
-				{
+			//evaluate the row's criteria for every lane and update the nets
+			bind_UpdatingFixedInputsVariables(dataSetRowIndex);
 
-					outputFile << "," << outputs.get_ElementAddress(
-						count)->get_Value();
+			evaluationCriteriaExpressions.get_ElementAddress(dataSetRowIndex)->evaluate_Batch(
+				variableColumns, laneCount, batchResults.get_ElementAddress(0), totalDataFrameCount);
 
-				}
-				//***</RECORDING>***
+			for (lane = 0; lane < laneCount; lane++)
+			{
 
-				//iterate the data frame
-				dataFrameIndex++;
+				net = nets.get_ElementAddress(laneNetSlotIndices.get_Element(lane));
 
-				//reassign any fixedInputs dataPoint variables used in
-				//calculatedInputUpdateExpressions to prep for the next dataFrame
-				fixedInputsVariableNode = updatingFixedInputsVariables.get_FirstNode();
+				if (rowsRecorded.get_Element(lane))
+					fitnessRatingModifier = recordedRowFitness.get_Element(lane);
 
-				while (fixedInputsVariableNode)
+				else
 				{
 
-					fixedInputsVariableNode->content.get_DataPointVariable()->reassign_Value(
-						fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
-							fixedInputsVariableNode->content.get_DataPointColumnIndex(),
-							dataFrameIndex, fixedInputsVariableNode->content.get_DataPointFrameSubIndex()));
+					fitnessRatingModifier = batchResults.get_Element(lane);
 
-					fixedInputsVariableNode = fixedInputsVariableNode->get_NextNode();
+					if (rowFitnessRecording)
+						net->record_RowFitness(dataSetRowIndex, fitnessRatingModifier);
 
 				}
 
-				//update calculatedInputs values via calculatedInputUpdateExpressions
-				//(done here in two steps so that calculatedInputs members can effectively
-				//be updated in parallel, not in series to ensure that changes occuring within
-				//each member round do not impact calculations of members in later array position
-				//in context of the current dataFrame iteration)
-				for (count = 0; count < calculatedInputsCount; count++)
-					*(calculatedInputsPrepValues.get_ElementAddress(count)) =
-					calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate();
+				net->modify_FitnessRating(fitnessRatingModifier);
 
-				for (count = 0; count < calculatedInputsCount; count++)
-					calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
-						calculatedInputsPrepValues.get_Element(count));
+			}
 
-			} while (dataFrameIndex < totalDataFrameCount);
+		}
 
+		//every cleared frame of a stimulated row has been recorded again
+		if (incrementalEvaluation)
+		{
 
-			//update the net's fitness rating
-			netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
-				dataSetRowIndex)->evaluate());
+			for (lane = 0; lane < laneCount; lane++)
+				nets.get_ElementAddress(laneNetSlotIndices.get_Element(lane))->complete_Trace();
 
-			dataSetRowIndex++;
+		}
 
-		} while (dataSetRowIndex < dataSetRowCount);
+		return netRowEvaluations;
 
 	}
 
-	*/
-
-	//uses all data sets/frames to stimulate the net in first position (later can revise
-	//to potentially record a list of nets; updates the net(s)'s performance rating(s)
-	//in the process, but does not sort; assumes outputFile is already open,
 	//iterates through all data frames in all data set rows referred to by currentEvolutionControl
-	//one time; updates nets' performance ratings in the process, but does not sort or reproduce them
-	//assumes currentEvolutionControl != NULL, assumes
-	inline void stimulate_AllFrames_SingleEvolutionCycle_Recorded(ExtensibleArray<int> &activationListRoundA,
-		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues)
-		//EvolutionControl *currentEvolutionControl)
+	//one time for the top activeNetCount ranked nets; updates those nets' performance ratings in
+	//the process, but does not sort or reproduce them; nets flagged (by slot index) in
+	//screenedOutNets are skipped unless screenedOutNets is NULL; if earlyAbort is set, nets
+	//other than the current top ranked net are culled once their partial fitnessRating
+	//exceeds abortFitnessRating or the maxSurvivorCount'th best complete fitnessRating of
+	//this cycle so far (at least that many nets would then rank above them, see
+	//get_SurvivorCount()); if a negative criteria value is found during the cycle, the
+	//bounds culling relied on did not hold, so every net culled in the cycle is evaluated
+	//again in full; returns the number of net row evaluations made;
+	//assumes currentEvolutionControl != NULL, assumes 2 <= activeNetCount <= totalNetCount
+	inline unsigned long long stimulate_AllFrames_SingleEvolutionCycle(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
+		EvolutionControl *currentEvolutionControl, const unsigned short activeNetCount,
+		ExtensibleArray<bool> *screenedOutNets, const double abortFitnessRating)
 	{
 
-		//initial setup
-		UniformNode<Net> *netNode(nets.get_FirstNode());
-		unsigned long long dataSetRowIndex;
-		//unsigned long long evolutionControlInternalIndex;
-		//unsigned long long evolutionControlInternalLength(currentEvolutionControl->get_DataSetRowIndicesLength());
-		unsigned long long dataFrameIndex;
-		unsigned short count;
-		UniformNode<FixedInputReference> *fixedInputsVariableNode;
+		//without culling, criteria may be evaluated for all nets together
+		const bool culling(earlyAbort && !negativeCriteriaValue);
 
-		//***RECORDING***
-		recordingData.reset();
-		UniformNode<RecordedDataSetRow> *currentRow;
-		//***RECORDING***
+		if (batchedCriteria && !culling)
+			return stimulate_AllFrames_SingleEvolutionCycle_Batched(activationListRoundA,
+				activationListRoundB, calculatedInputsPrepValues, currentEvolutionControl,
+				activeNetCount, screenedOutNets);
 
-		//net loop
-		//do
-		//{
+		//initial setup
+		unsigned short count(0);
+		unsigned short netSlotIndex;
+		const unsigned short topNetSlotIndex(netRanks.get_Element(0));
+		unsigned long long netRowEvaluations(0);
+
+		//early abort setup; the best complete fitnessRatings of this cycle in ascending order
+		const unsigned short maxSurvivorCount(activeNetCount - (activeNetCount / 2));
+		ExtensibleArray<double> bestFitnessRatings(maxSurvivorCount);
+		unsigned short bestFitnessRatingCount(0);
+		unsigned short insertIndex;
+		double cycleAbortFitnessRating(abortFitnessRating);
+		double fitnessRating;
+
+		//net loop (when every net is active, nets are visited in slot order so
+		//traversal runs front to back through contiguous memory, otherwise
+		//count is used as a rank)
+		do
+		{
 
-			//reset the net's fitness rating
-			netNode->content.reset_FitnessRating();
+			if (activeNetCount == totalNetCount)
+				netSlotIndex = count;
 
-			dataSetRowIndex = 0;
-			//evolutionControlInternalIndex = 0;
+			else
+				netSlotIndex = netRanks.get_Element(count);
 
-			//data set row loop 
-			do
+			if (!screenedOutNets || !screenedOutNets->get_Element(netSlotIndex))
 			{
 
-				//***RECORDING***
-				currentRow = recordingData.add_NewDataSetRow(totalDataFrameCount);
-				//***RECORDING***
-
-				//set the correct data set row
-				//dataSetRowIndex = currentEvolutionControl->get_DataSetRowIndicesElement(
-				//evolutionControlInternalIndex);
+				//the top net is never culled so at least one net is fully evaluated
+				if (netSlotIndex == topNetSlotIndex)
+					netRowEvaluations += stimulate_AllFrames_SingleNet(activationListRoundA,
+						activationListRoundB, calculatedInputsPrepValues, currentEvolutionControl,
+						nets.get_ElementAddress(netSlotIndex), incrementalEvaluation, DBL_MAX);
 
-				//reset calculated inputs to default values
-				for (count = 0; count < calculatedInputsCount; count++)
-					calculatedInputs.get_ElementAddress(count)->reset();
+				else
+					netRowEvaluations += stimulate_AllFrames_SingleNet(activationListRoundA,
+						activationListRoundB, calculatedInputsPrepValues, currentEvolutionControl,
+						nets.get_ElementAddress(netSlotIndex), incrementalEvaluation, cycleAbortFitnessRating);
 
-				dataFrameIndex = 0;
+				//tighten the cutoff with the net's complete fitnessRating (culled nets have DBL_MAX)
+				fitnessRating = nets.get_ElementAddress(netSlotIndex)->get_FitnessRating();
 
-				//data frame loop
-				do
+				if (culling && fitnessRating < DBL_MAX && (bestFitnessRatingCount < maxSurvivorCount
+					|| fitnessRating < bestFitnessRatings.get_Element(maxSurvivorCount - 1)))
 				{
 
-					//stimulate the net
-					stimulate_SingleFrame_Recorded(dataSetRowIndex, dataFrameIndex, netNode->content.get_Cells(),
-						activationListRoundA, activationListRoundB, currentRow);
+					if (bestFitnessRatingCount < maxSurvivorCount)
+						bestFitnessRatingCount++;
 
-					//iterate the data frame
-					dataFrameIndex++;
+					for (insertIndex = bestFitnessRatingCount - 1; insertIndex
+						&& bestFitnessRatings.get_Element(insertIndex - 1) > fitnessRating; insertIndex--)
+						*(bestFitnessRatings.get_ElementAddress(insertIndex)) = bestFitnessRatings.get_Element(insertIndex - 1);
 
-					//reassign any fixedInputs dataPoint variables used in
-					//calculatedInputUpdateExpressions to prep for the next dataFrame
-					fixedInputsVariableNode = updatingFixedInputsVariables.get_FirstNode();
+					*(bestFitnessRatings.get_ElementAddress(insertIndex)) = fitnessRating;
 
-					while (fixedInputsVariableNode)
-					{
+					if (bestFitnessRatingCount == maxSurvivorCount
+						&& bestFitnessRatings.get_Element(maxSurvivorCount - 1) < cycleAbortFitnessRating)
+						cycleAbortFitnessRating = bestFitnessRatings.get_Element(maxSurvivorCount - 1);
+
+				}
 
-						fixedInputsVariableNode->content.get_DataPointVariable()->reassign_Value(
-							fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
-								fixedInputsVariableNode->content.get_DataPointColumnIndex(),
-								dataFrameIndex, fixedInputsVariableNode->content.get_DataPointFrameSubIndex()));
+			}
 
-						fixedInputsVariableNode = fixedInputsVariableNode->get_NextNode();
+			count++;
 
-					}
+		} while (count < activeNetCount);
 
-					//update calculatedInputs values via calculatedInputUpdateExpressions
-					//(done here in two steps so that calculatedInputs members can effectively
-					//be updated in parallel, not in series to ensure that changes occuring within
-					//each member round do not impact calculations of members in later array position
-					//in context of the current dataFrame iteration)
-					for (count = 0; count < calculatedInputsCount; count++)
-						*(calculatedInputsPrepValues.get_ElementAddress(count)) =
-						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate();
+		//a negative criteria value was found, re-evaluate the nets culled against bounds
+		//which did not hold (with culling now suspended)
+		if (culling && negativeCriteriaValue)
+		{
 
-					for (count = 0; count < calculatedInputsCount; count++)
-						calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
-							calculatedInputsPrepValues.get_Element(count));
+			for (count = 0; count < activeNetCount; count++)
+			{
 
-				} while (dataFrameIndex < totalDataFrameCount);
+				netSlotIndex = netRanks.get_Element(count);
 
-				//update the net's fitness rating
-				netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
-					dataSetRowIndex)->evaluate());
+				if ((screenedOutNets && screenedOutNets->get_Element(netSlotIndex))
+					|| nets.get_ElementAddress(netSlotIndex)->get_FitnessRating() < DBL_MAX)
+					continue;
 
-				dataSetRowIndex++;
-				//evolutionControlInternalIndex++;
+				netRowEvaluations += stimulate_AllFrames_SingleNet(activationListRoundA,
+					activationListRoundB, calculatedInputsPrepValues, currentEvolutionControl,
+					nets.get_ElementAddress(netSlotIndex), incrementalEvaluation, DBL_MAX);
 
-			} while (dataSetRowIndex < dataSetRowCount);
-			//} while (evolutionControlInternalIndex < evolutionControlInternalLength);
+			}
 
-			//netNode = netNode->get_NextNode();
+		}
 
-		//} while (netNode);
+		return netRowEvaluations;
 
 	}
 
-	/*
-
-	//uses all data sets/frames to stimulate the net in first position (later can revise
-	//to potentially record a list of nets; updates the net(s)'s performance rating(s)
-	//in the process, but does not sort; assumes outputFile is already open,
-	inline void stimulate_AllFramesAllParallels_XMLMinimalRecord(ExtensibleArray<int> &activationListRoundA,
+	//sets probeFitnessRating to the fitnessRating of the net in slot netSlotIndex over the
+	//probe rows of screeningControl, taken from probeFitnessRatings if the net is unchanged
+	//since it was last probed (see screen_Children()), otherwise found and kept there;
+	//returns the number of net row evaluations made (rows served from the net's row fitness
+	//record are not counted)
+	inline unsigned long long sub_Probe(ExtensibleArray<int> &activationListRoundA,
 		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
-		ofstream &outputFile)
+		const unsigned short netSlotIndex, ExtensibleArray<unsigned long long> &probeFitnessKeys,
+		ExtensibleArray<double> &probeFitnessRatings, double &probeFitnessRating)
 	{
 
-		//initial setup
-		UniformNode<Net> *netNode(nets.get_FirstNode());
-		unsigned long long dataSetRowIndex;
-		unsigned long long dataFrameIndex;
-		unsigned short count;
-		UniformNode<FixedInputReference> *fixedInputsVariableNode;
-
-		//***RECORDING***
-		unsigned short netIndex(0);
-		unsigned short recordingDataFrameSubIndex;
-		unsigned short recordingDataSetFrameLength;
-		//***RECORDING***
+		Net *net(nets.get_ElementAddress(netSlotIndex));
+		const unsigned long long contentHash(net->get_ContentHash());
+		unsigned long long netRowEvaluations;
 
-		//net loop
-		do
+		if (probeFitnessKeys.get_Element(netSlotIndex) == contentHash)
 		{
 
-			//***RECORDING***
-			outputFile << "\n<net_" << netIndex << ">";
-			//***RECORDING***
+			probeFitnessRating = probeFitnessRatings.get_Element(netSlotIndex);
+			return 0;
 
-			//reset the net's fitness rating
-			netNode->content.reset_FitnessRating();
+		}
 
-			dataSetRowIndex = 0;
+		netRowEvaluations = stimulate_AllFrames_SingleNet(activationListRoundA, activationListRoundB,
+			calculatedInputsPrepValues, &screeningControl, net, false, DBL_MAX);
 
-			//data set row loop
-			do
-			{
+		probeFitnessRating = net->get_FitnessRating();
 
-				//***RECORDING***
-				outputFile << "\n\t<dataSetRow_" << dataSetRowIndex << ">";
-				outputFile << "\n\t\t<name>";
-				fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
-				outputFile << "</name>";
-				//***RECORDING***
+		*(probeFitnessKeys.get_ElementAddress(netSlotIndex)) = contentHash;
+		*(probeFitnessRatings.get_ElementAddress(netSlotIndex)) = probeFitnessRating;
 
-				//reset calculated inputs to default values
-				for (count = 0; count < calculatedInputsCount; count++)
-					calculatedInputs.get_ElementAddress(count)->reset();
+		return netRowEvaluations;
 
-				dataFrameIndex = 0;
+	}
 
-				//data frame loop
-				do
-				{
+	//evaluates the top survivorCount ranked nets and the childCount children (identified by
+	//slot index in childSlotIndices) on the probe rows of screeningControl, storing each
+	//child's probe fitnessRating in childProbeFitnessRatings and the worst survivor's probe
+	//fitnessRating plus screeningTolerance in screeningThreshold; each child above
+	//screeningThreshold is predicted uncompetitive, flagged (by slot index) in screenedOutNets
+	//and given a fitnessRating of DBL_MAX so it ranks last, except that every
+	//screeningAuditInterval'th such child (counted in screenedOutChildTotal) is left unflagged
+	//so it is fully evaluated; probe fitnessRatings are kept (by slot index) in
+	//probeFitnessRatings, keyed by the net's content hash in probeFitnessKeys, so nets
+	//unchanged since they were last probed (generally the survivors) are not probed again;
+	//returns the number of net row evaluations made
+	inline unsigned long long screen_Children(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
+		ExtensibleArray<unsigned short> &childSlotIndices, const unsigned short childCount,
+		const unsigned short survivorCount, ExtensibleArray<double> &childProbeFitnessRatings,
+		double &screeningThreshold, unsigned long long &screenedOutChildTotal,
+		ExtensibleArray<bool> &screenedOutNets, ExtensibleArray<unsigned long long> &probeFitnessKeys,
+		ExtensibleArray<double> &probeFitnessRatings)
+	{
 
-					//***RECORDING***
-					count = 0;
+		unsigned short count;
+		Net *net;
+		double probeFitnessRating;
+		unsigned long long netRowEvaluations(0);
 
-					outputFile << "\n\t\t<dataFrame_" << dataFrameIndex << ">";
-					outputFile << "\n\t\t\t<inputs>";
-					outputFile << "\n\t\t\t\t<fixedInputs>";
+		//the worst survivor's probe fitnessRating sets the screening threshold
+		screeningThreshold = -DBL_MAX;
 
-					//count as dataSetColumnIndex
-					do
-					{
+		for (count = 0; count < survivorCount; count++)
+		{
 
-						recordingDataFrameSubIndex = 0;
+			netRowEvaluations += sub_Probe(activationListRoundA, activationListRoundB,
+				calculatedInputsPrepValues, netRanks.get_Element(count), probeFitnessKeys,
+				probeFitnessRatings, probeFitnessRating);
 
-						recordingDataSetFrameLength = fixedInputs.get_ColumnFrameLength(count);
+			if (probeFitnessRating > screeningThreshold)
+				screeningThreshold = probeFitnessRating;
 
-						outputFile << "\n\t\t\t\t\t<dataSetColumn_" << count << ">";
-						outputFile << "\n\t\t\t\t\t\t<name>";
-						fixedInputs.get_ColumnName(count).output_ToOpenFile(outputFile);
-						outputFile << "</name>";
+		}
 
-						do
-						{
+		screeningThreshold += screeningTolerance;
 
-							outputFile << "\n\t\t\t\t\t\t<value_" << recordingDataFrameSubIndex << ">";
-							outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex, count,
-								dataFrameIndex, recordingDataFrameSubIndex);
-							outputFile << "</value_" << recordingDataFrameSubIndex << ">";
+		for (count = 0; count < childCount; count++)
+		{
 
-							recordingDataFrameSubIndex++;
+			net = nets.get_ElementAddress(childSlotIndices.get_Element(count));
 
-						} while (recordingDataFrameSubIndex < recordingDataSetFrameLength);
+			netRowEvaluations += sub_Probe(activationListRoundA, activationListRoundB,
+				calculatedInputsPrepValues, childSlotIndices.get_Element(count), probeFitnessKeys,
+				probeFitnessRatings, probeFitnessRating);
 
-						outputFile << "\n\t\t\t\t\t</dataSetColumn_" << count << ">";
-
-						count++;
+			*(childProbeFitnessRatings.get_ElementAddress(count)) = probeFitnessRating;
 
-					} while (count < dataSetColumnCount);
-					outputFile << "\n\t\t\t\t</fixedInputs>";
+			if (probeFitnessRating > screeningThreshold)
+			{
 
-					outputFile << "\n\t\t\t\t<calculatedInputs>";
-					for (count = 0; count < calculatedInputsCount; count++)
-					{
+				screenedOutChildTotal++;
 
-						outputFile << "\n\t\t\t\t\t<ci_" << count << ">";
-						outputFile << "\n\t\t\t\t\t\t<name>";
-						calculatedInputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
-						outputFile << "</name>";
-						outputFile << "\n\t\t\t\t\t\t<value>" << calculatedInputs.get_ElementAddress(count)->get_CurrentValue() << "</value>";
-						outputFile << "\n\t\t\t\t\t</ci_" << count << ">";
+				if (!screeningAuditInterval || screenedOutChildTotal % screeningAuditInterval)
+				{
 
-					}
-					outputFile << "\n\t\t\t\t</calculatedInputs>";
-					outputFile << "\n\t\t\t</inputs>";
-					//***RECORDING***
+					*(screenedOutNets.get_ElementAddress(childSlotIndices.get_Element(count))) = true;
 
-					//stimulate the net
-					stimulate_SingleFrame(dataSetRowIndex, dataFrameIndex,
-						netNode->content.get_Cells(), activationListRoundA,
-						activationListRoundB);
+					net->reset_FitnessRating();
+					net->modify_FitnessRating(DBL_MAX);
 
-					//***RECORDING***
-					outputFile << "\n\t\t\t<outputs>";
-					for (count = 0; count < outputCellCount; count++)
-					{
+				}
 
-						outputFile << "\n\t\t\t\t<o_" << count << ">";
-						outputFile << "\n\t\t\t\t\t<name>";
-						outputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
-						outputFile << "</name>";
-						outputFile << "\n\t\t\t\t\t<value>" << outputs.get_ElementAddress(count)->get_Value() << "</value>";
-						outputFile << "\n\t\t\t\t</o_" << count << ">";
+			}
 
-					}
-					outputFile << "\n\t\t\t</outputs>";
-					outputFile << "\n\t\t</dataFrame_" << dataFrameIndex << ">";
-					//***RECORDING***
+		}
 
-					//iterate the data frame
-					dataFrameIndex++;
+		return netRowEvaluations;
 
-					//reassign any fixedInputs dataPoint variables used in
-					//calculatedInputUpdateExpressions to prep for the next dataFrame
-					fixedInputsVariableNode = updatingFixedInputsVariables.get_FirstNode();
+	}
 
-					while (fixedInputsVariableNode)
-					{
+	//outputs one JSON object per line to progressOutput for each of the childCount children
+	//(identified by slot index in childSlotIndices) whose probe fitnessRating in
+	//childProbeFitnessRatings exceeded screeningThreshold; children which were fully evaluated
+	//anyway are marked audited and include their full fitnessRating; clears the children's
+	//flags in screenedOutNets; returns the number of children skipped in full evaluation
+	inline unsigned short output_ScreenedChildren(ExtensibleArray<unsigned short> &childSlotIndices,
+		const unsigned short childCount, ExtensibleArray<double> &childProbeFitnessRatings,
+		const double screeningThreshold, ExtensibleArray<bool> &screenedOutNets,
+		const unsigned int cycleCount, ostream &progressOutput)
+	{
 
-						fixedInputsVariableNode->content.get_DataPointVariable()->reassign_Value(
-							fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
-								fixedInputsVariableNode->content.get_DataPointColumnIndex(),
-								dataFrameIndex, fixedInputsVariableNode->content.get_DataPointFrameSubIndex()));
+		unsigned short count;
+		unsigned short netSlotIndex;
+		unsigned short screenedOutCount(0);
 
-						fixedInputsVariableNode = fixedInputsVariableNode->get_NextNode();
+		for (count = 0; count < childCount; count++)
+		{
 
-					}
+			if (childProbeFitnessRatings.get_Element(count) <= screeningThreshold)
+				continue;
 
-					//update calculatedInputs values via calculatedInputUpdateExpressions
-					//(done here in two steps so that calculatedInputs members can effectively
-					//be updated in parallel, not in series to ensure that changes occuring within
-					//each member round do not impact calculations of members in later array position
-					//in context of the current dataFrame iteration)
-					for (count = 0; count < calculatedInputsCount; count++)
-						*(calculatedInputsPrepValues.get_ElementAddress(count)) =
-						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate();
+			netSlotIndex = childSlotIndices.get_Element(count);
 
-					for (count = 0; count < calculatedInputsCount; count++)
-						calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
-							calculatedInputsPrepValues.get_Element(count));
+			progressOutput << "{\"cycle\":" << cycleCount;
+			progressOutput << ",\"screenedChild\":" << netSlotIndex;
+			progressOutput << ",\"probeFitnessRating\":";
+			outputDouble_JSON(childProbeFitnessRatings.get_Element(count), progressOutput);
+			progressOutput << ",\"screeningThreshold\":";
+			outputDouble_JSON(screeningThreshold, progressOutput);
 
-				} while (dataFrameIndex < totalDataFrameCount);
+			if (screenedOutNets.get_Element(netSlotIndex))
+			{
 
+				progressOutput << ",\"audited\":false}\n";
 
-				//update the net's fitness rating
-				netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
-					dataSetRowIndex)->evaluate());
+				*(screenedOutNets.get_ElementAddress(netSlotIndex)) = false;
+				screenedOutCount++;
 
-				//***RECORDING***
-				outputFile << "\n\t</dataSetRow_" << dataSetRowIndex << ">";
-				//***RECORDING***
+			}
 
-				dataSetRowIndex++;
+			else
+			{
 
-			} while (dataSetRowIndex < dataSetRowCount);
+				progressOutput << ",\"audited\":true";
+				progressOutput << ",\"fitnessRating\":";
+				outputDouble_JSON(nets.get_ElementAddress(netSlotIndex)->get_FitnessRating(), progressOutput);
+				progressOutput << "}\n";
 
-			//***RECORDING***
-			outputFile << "\n\t<fitnessRating>" << netNode->content.get_FitnessRating() << "</fitnessRating>";
-			outputFile << "\n</net_" << netIndex << ">";
-			//***RECORDING***
+			}
 
-			netIndex++;
-			netNode = netNode->get_NextNode();
+		}
 
-		} while (netIndex < netsIncluded);
+		return screenedOutCount;
 
 	}
 
-	//uses all data sets/frames to stimulate netsIncluded number of nets
-	//starting from net in first position; updates nets' performance ratings
-	//in the process, but does not sort them; assumes outputFile is already open,
-	//assumes netsIncluded >= 1
-	inline void stimulate_AllFramesAllParallels_XMLFullRecord(ExtensibleArray<int> &activationListRoundA,
+
+
+	//*** WORK FROM HERE TO CHANGE THE LOGIC OF THE FUNCTIONS BELOW TO MATCH THAT ABOVE
+	//ALSO RECONSIDER/REFACTOR THE RECORDING FUNCTIONS TO BE MORE MANAGEABLE AND SO THEY
+	//WILL FOLLOW THE NEW PARADIGM FOR RECORDING (USING SUB FUNCTIONS TO MAKE COMPOUNDING CHANGES MORE MANAGEABLE)***
+
+/*
+
+	//uses all data sets/frames to stimulate only the top performing net; updates
+	//the net's performance rating in the process, but does not sort; outputs in CSV format
+	//assumes outputFile is already open
+	inline void stimulate_AllFramesAllParallels_CSVMinimalRecord(ExtensibleArray<int> &activationListRoundA,
 		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
-		ofstream &outputFile, const unsigned short netsIncluded)
+		ofstream &outputFile)
 	{
 
 		//initial setup
@@ -1338,143 +1620,298 @@ private:
 		unsigned long long dataSetRowIndex;
 		unsigned long long dataFrameIndex;
 		unsigned short count;
-		UniformNode<FixedInputReference> *fixedInputsVariableNode;
-
-		//***RECORDING***
-		unsigned short netIndex(0);
-		unsigned short recordingDataFrameSubIndex;
-		unsigned short recordingDataSetFrameLength;
-		//***RECORDING***
 
-		//net loop
-		do
+		//***<RECORDING>***
+		unsigned short recordingCalculatedInputIndex;
+		unsigned short recordingOutputIndex;
+		ExtensibleArray<unsigned short> dataSetColumnFrameIndices(dataSetColumnCount);
+		unsigned short maxShiftLengthMinusOne(1);
+		unsigned short maxFrameLength(1);
+		unsigned short recordingSubFrameIndex;
+		
+		for (count = 0; count < dataSetColumnCount; count++)
 		{
 
-			//***RECORDING***
-			outputFile << "\n<net_" << netIndex << ">";
-			//***RECORDING***
-
-			//reset the net's fitness rating
-			netNode->content.reset_FitnessRating();
+			if (fixedInputs.get_ColumnShiftLength(count) > maxShiftLengthMinusOne)
+				maxShiftLengthMinusOne = fixedInputs.get_ColumnShiftLength(count);
 
-			dataSetRowIndex = 0;
+			if (fixedInputs.get_ColumnFrameLength(count) > maxFrameLength)
+				maxFrameLength = fixedInputs.get_ColumnFrameLength(count);
 
-			//data set row loop
-			do
-			{
+		}
+		
+		maxShiftLengthMinusOne--;
+		//***</RECORDING>***
 
-				//***RECORDING***
-				outputFile << "\n\t<dataSetRow_" << dataSetRowIndex << ">";
-				outputFile << "\n\t\t<name>";
-				fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
-				outputFile << "</name>";
-				//***RECORDING***
+		//reset the net's fitness rating
+		netNode->content.reset_FitnessRating();
 
-				//reset calculated inputs to default values
-				for (count = 0; count < calculatedInputsCount; count++)
-					calculatedInputs.get_ElementAddress(count)->reset();
+		dataSetRowIndex = 0;
 
-				dataFrameIndex = 0;
+		//data set row loop
+		do
+		{
 
-				//data frame loop
-				do
-				{
+			//reset calculated inputs to default values
+			for (count = 0; count < calculatedInputsCount; count++)
+				calculatedInputs.get_ElementAddress(count)->reset();
 
-					//***RECORDING***
-					count = 0;
+			dataFrameIndex = 0;
 
-					outputFile << "\n\t\t<dataFrame_" << dataFrameIndex << ">";
-					outputFile << "\n\t\t\t<inputs>";
-					outputFile << "\n\t\t\t\t<fixedInputs>";
+			bind_UpdatingFixedInputsVariables(dataSetRowIndex);
 
-					//count as dataSetColumnIndex
-					do
-					{
+			//***<RECORDING>***
+			outputFile << "\n\n";
+			fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
 
-						recordingDataFrameSubIndex = 0;
+			for (count = 0; count < dataSetColumnCount; count++)
+			{
 
-						recordingDataSetFrameLength = fixedInputs.get_ColumnFrameLength(count);
+				outputFile << ",";
+				fixedInputs.get_ColumnName(count).output_ToOpenFile(outputFile);
 
-						outputFile << "\n\t\t\t\t\t<dataSetColumn_" << count << ">";
-						outputFile << "\n\t\t\t\t\t\t<name>";
-						fixedInputs.get_ColumnName(count).output_ToOpenFile(outputFile);
-						outputFile << "</name>";
+			}
 
-						do
-						{
+			for (count = 0; count < calculatedInputsCount; count++)
+			{
 
-							outputFile << "\n\t\t\t\t\t\t<value_" << recordingDataFrameSubIndex << ">";
-							outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex, count,
-								dataFrameIndex, recordingDataFrameSubIndex);
-							outputFile << "</value_" << recordingDataFrameSubIndex << ">";
+				outputFile << ",";
+				calculatedInputs.get_ElementAddress(count)->get_Name().output_ToOpenFile(outputFile);
 
-							recordingDataFrameSubIndex++;
+			}
 
-						} while (recordingDataFrameSubIndex < recordingDataSetFrameLength);
+			for (count = 0; count < outputCellCount; count++)
+			{
 
-						outputFile << "\n\t\t\t\t\t</dataSetColumn_" << count << ">";
+				outputFile << ",";
+				outputs.get_ElementAddress(count)->get_Name().output_ToOpenFile(outputFile);
 
-						count++;
+			}
 
-					} while (count < dataSetColumnCount);
-					outputFile << "\n\t\t\t\t</fixedInputs>";
+			//leading fixed set data
+			for (count = 0; count < dataSetColumnCount; count++)
+				*(dataSetColumnFrameIndices.get_ElementAddress(count)) = 0;
 
-					outputFile << "\n\t\t\t\t<calculatedInputs>";
-					for (count = 0; count < calculatedInputsCount; count++)
-					{
+			outputFile << "\n";
 
-						outputFile << "\n\t\t\t\t\t<ci_" << count << ">";
-						outputFile << "\n\t\t\t\t\t\t<name>";
-						calculatedInputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
-						outputFile << "</name>";
-						outputFile << "\n\t\t\t\t\t\t<value>" << calculatedInputs.get_ElementAddress(count)->get_CurrentValue() << "</value>";
-						outputFile << "\n\t\t\t\t\t</ci_" << count << ">";
+			for (recordingSubFrameIndex = 0; recordingSubFrameIndex < maxFrameLength - (maxShiftLengthMinusOne + 1); recordingSubFrameIndex++)
+			{
 
-					}
-					outputFile << "\n\t\t\t\t</calculatedInputs>";
-					outputFile << "\n\t\t\t</inputs>";
-					//***RECORDING***
+				for (count = 0; count < dataSetColumnCount; count++)
+				{
 
-					//stimulate the net
-					stimulate_SingleFrame_Recorded(dataSetRowIndex, dataFrameIndex,
-						netNode->content.get_Cells(), activationListRoundA,
-						activationListRoundB, outputFile, true);
+					outputFile << ",";
 
-					//***RECORDING***
-					outputFile << "\n\t\t\t<outputs>";
-					for (count = 0; count < outputCellCount; count++)
+					if (dataSetColumnFrameIndices.get_Element(count) < fixedInputs.get_ColumnFrameLength(count))
 					{
 
-						outputFile << "\n\t\t\t\t<o_" << count << ">";
-						outputFile << "\n\t\t\t\t\t<name>";
-						outputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
-						outputFile << "</name>";
-						outputFile << "\n\t\t\t\t\t<value>" << outputs.get_ElementAddress(count)->get_Value() << "</value>";
-						outputFile << "\n\t\t\t\t</o_" << count << ">";
+						outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex,
+							count, dataFrameIndex, dataSetColumnFrameIndices.get_Element(count));
+
+						*(dataSetColumnFrameIndices.get_ElementAddress(count)) += 1;
 
 					}
-					outputFile << "\n\t\t\t</outputs>";
-					outputFile << "\n\t\t</dataFrame_" << dataFrameIndex << ">";
-					//***RECORDING***
 
-					//iterate the data frame
-					dataFrameIndex++;
+				}
 
-					//reassign any fixedInputs dataPoint variables used in
-					//calculatedInputUpdateExpressions to prep for the next dataFrame
-					fixedInputsVariableNode = updatingFixedInputsVariables.get_FirstNode();
+				for (recordingCalculatedInputIndex = 0; recordingCalculatedInputIndex < calculatedInputsCount; recordingCalculatedInputIndex++)
+					outputFile << ",";
 
-					while (fixedInputsVariableNode)
-					{
+				for (recordingOutputIndex = 0; recordingOutputIndex < outputCellCount; recordingOutputIndex++)
+					outputFile << ",";
 
-						fixedInputsVariableNode->content.get_DataPointVariable()->reassign_Value(
-							fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
-								fixedInputsVariableNode->content.get_DataPointColumnIndex(),
-								dataFrameIndex, fixedInputsVariableNode->content.get_DataPointFrameSubIndex()));
+				outputFile << "\n";
 
-						fixedInputsVariableNode = fixedInputsVariableNode->get_NextNode();
+			}
+			//***</RECORDING>***
 
-					}
+			//data frame loop
+			do
+			{
+
+				//***<RECORDING>***
+				for (count = 0; count < dataSetColumnCount; count++)
+					*(dataSetColumnFrameIndices.get_ElementAddress(count)) = fixedInputs.get_ColumnFrameLength(count) - (maxShiftLengthMinusOne + 1);
+
+				//all but final iteration
+				for (recordingSubFrameIndex = 0; recordingSubFrameIndex < maxShiftLengthMinusOne; recordingSubFrameIndex++)
+				{
+
+					for (count = 0; count < dataSetColumnCount; count++)
+					{
+
+						outputFile << ",";
+
+						if (dataSetColumnFrameIndices.get_Element(count) < fixedInputs.get_ColumnFrameLength(count))
+						{
+
+							outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex,
+								count, dataFrameIndex, dataSetColumnFrameIndices.get_Element(count));
+
+							*(dataSetColumnFrameIndices.get_ElementAddress(count)) += 1;
+
+						}
+
+					}
+
+					for (recordingCalculatedInputIndex = 0; recordingCalculatedInputIndex < calculatedInputsCount; recordingCalculatedInputIndex++)
+						outputFile << ",";
+
+					for (recordingOutputIndex = 0; recordingOutputIndex < outputCellCount; recordingOutputIndex++)
+						outputFile << ",";
+
+					outputFile << "\n";
+
+				}
+
+				if (!maxShiftLengthMinusOne && dataFrameIndex)
+					outputFile << "\n";
+
+				//final iteration
+				outputFile << "dataFrame_" << dataFrameIndex;
+
+				for (count = 0; count < dataSetColumnCount; count++)
+				{
+
+					outputFile << ",";
+
+					if (dataSetColumnFrameIndices.get_Element(count) < fixedInputs.get_ColumnFrameLength(count))
+					{
+
+						outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex,
+							count, dataFrameIndex, dataSetColumnFrameIndices.get_Element(count));
+
+						*(dataSetColumnFrameIndices.get_ElementAddress(count)) += 1;
+
+					}
+
+				}
+
+				for (count = 0; count < calculatedInputsCount; count++)
+				{
+
+					outputFile << "," << calculatedInputs.get_ElementAddress(
+						count)->get_CurrentValue();
+
+				}
+				//***</RECORDING>***
+
+				//stimulate the net
+				stimulate_SingleFrame(dataSetRowIndex, dataFrameIndex, netNode->content.get_Cells(),
+					activationListRoundA, activationListRoundB);
+
+				//***<RECORDING>***
+				for (count = 0; count < outputCellCount; count++)
+				{
+
+					outputFile << "," << outputs.get_ElementAddress(
+						count)->get_Value();
+
+				}
+				//***</RECORDING>***
+
+				//record the outputs compared by lossAccumulators
+				record_LossAccumulatorOutputs(dataFrameIndex);
+
+				//iterate the data frame
+				dataFrameIndex++;
+
+				//update calculatedInputs values via calculatedInputUpdateExpressions
+				//(done here in two steps so that calculatedInputs members can effectively
+				//be updated in parallel, not in series to ensure that changes occuring within
+				//each member round do not impact calculations of members in later array position
+				//in context of the current dataFrame iteration)
+				for (count = 0; count < calculatedInputsCount; count++)
+					*(calculatedInputsPrepValues.get_ElementAddress(count)) =
+					calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate(dataFrameIndex);
+
+				for (count = 0; count < calculatedInputsCount; count++)
+					calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
+						calculatedInputsPrepValues.get_Element(count));
+
+			} while (dataFrameIndex < totalDataFrameCount);
+
+
+			//update the net's fitness rating
+			accumulate_Losses(dataSetRowIndex);
+			netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
+				dataSetRowIndex)->evaluate(dataFrameIndex));
+
+			dataSetRowIndex++;
+
+		} while (dataSetRowIndex < dataSetRowCount);
+
+	}
+
+	*/
+
+	//uses all data sets/frames to stimulate the net in first position (later can revise
+	//to potentially record a list of nets; updates the net(s)'s performance rating(s)
+	//in the process, but does not sort; assumes outputFile is already open,
+	//iterates through all data frames in all data set rows referred to by currentEvolutionControl
+	//one time; updates nets' performance ratings in the process, but does not sort or reproduce them
+	//assumes currentEvolutionControl != NULL, assumes
+	inline void stimulate_AllFrames_SingleEvolutionCycle_Recorded(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues)
+		//EvolutionControl *currentEvolutionControl)
+	{
+
+		//initial setup
+		Net *net(get_RankedNet(0));
+		unsigned long long dataSetRowIndex;
+		//unsigned long long evolutionControlInternalIndex;
+		//unsigned long long evolutionControlInternalLength(currentEvolutionControl->get_DataSetRowIndicesLength());
+		unsigned long long dataFrameIndex;
+		unsigned short count;
+
+		//***RECORDING***
+		recordingData.reset();
+		UniformNode<RecordedDataSetRow> *currentRow;
+		//***RECORDING***
+
+		//net loop
+		//do
+		//{
+
+			//reset the net's fitness rating
+			net->reset_FitnessRating();
+
+			dataSetRowIndex = 0;
+			//evolutionControlInternalIndex = 0;
+
+			//data set row loop 
+			do
+			{
+
+				//***RECORDING***
+				currentRow = recordingData.add_NewDataSetRow(totalDataFrameCount);
+				//***RECORDING***
+
+				//set the correct data set row
+				//dataSetRowIndex = currentEvolutionControl->get_DataSetRowIndicesElement(
+				//evolutionControlInternalIndex);
+
+				//reset calculated inputs to default values
+				for (count = 0; count < calculatedInputsCount; count++)
+					calculatedInputs.get_ElementAddress(count)->reset();
+
+				dataFrameIndex = 0;
+
+				bind_UpdatingFixedInputsVariables(dataSetRowIndex);
+
+				//data frame loop
+				do
+				{
+
+					//stimulate the net
+					stimulate_SingleFrame_Recorded(dataSetRowIndex, dataFrameIndex, net->get_Cells(),
+						activationListRoundA, activationListRoundB, currentRow);
+
+					//record the outputs compared by lossAccumulators
+					record_LossAccumulatorOutputs(dataFrameIndex);
+
+					//iterate the data frame
+					dataFrameIndex++;
 
 					//update calculatedInputs values via calculatedInputUpdateExpressions
 					//(done here in two steps so that calculatedInputs members can effectively
@@ -1483,7 +1920,7 @@ private:
 					//in context of the current dataFrame iteration)
 					for (count = 0; count < calculatedInputsCount; count++)
 						*(calculatedInputsPrepValues.get_ElementAddress(count)) =
-						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate();
+						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate(dataFrameIndex);
 
 					for (count = 0; count < calculatedInputsCount; count++)
 						calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
@@ -1491,38 +1928,31 @@ private:
 
 				} while (dataFrameIndex < totalDataFrameCount);
 
-
 				//update the net's fitness rating
-				netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
-					dataSetRowIndex)->evaluate());
-
-				//***RECORDING***
-				outputFile << "\n\t</dataSetRow_" << dataSetRowIndex << ">";
-				//***RECORDING***
+				accumulate_Losses(dataSetRowIndex);
+				net->modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
+					dataSetRowIndex)->evaluate(dataFrameIndex));
 
 				dataSetRowIndex++;
+				//evolutionControlInternalIndex++;
 
 			} while (dataSetRowIndex < dataSetRowCount);
+			//} while (evolutionControlInternalIndex < evolutionControlInternalLength);
 
-			//***RECORDING***
-			outputFile << "\n\t<fitnessRating>" << netNode->content.get_FitnessRating() << "</fitnessRating>";
-			outputFile << "\n</net_" << netIndex << ">";
-			//***RECORDING***
-
-			netIndex++;
-			netNode = netNode->get_NextNode();
+			//net = get_RankedNet(++netRankIndex);
 
-		} while (netIndex < netsIncluded);
+		//} while (netRankIndex < totalNetCount);
 
 	}
 
-	//uses all data sets/frames to stimulate netsIncluded number of nets
-	//starting from net in first position; updates nets' performance ratings
-	//in the process, but does not sort them; assumes outputFile is already open,
-	//assumes netsIncluded >= 1
-	inline void stimulate_AllFramesAllParallels_JSONFullRecord(ExtensibleArray<int> &activationListRoundA,
+	/*
+
+	//uses all data sets/frames to stimulate the net in first position (later can revise
+	//to potentially record a list of nets; updates the net(s)'s performance rating(s)
+	//in the process, but does not sort; assumes outputFile is already open,
+	inline void stimulate_AllFramesAllParallels_XMLMinimalRecord(ExtensibleArray<int> &activationListRoundA,
 		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
-		ofstream &outputFile, const unsigned short netsIncluded)
+		ofstream &outputFile)
 	{
 
 		//initial setup
@@ -1530,7 +1960,6 @@ private:
 		unsigned long long dataSetRowIndex;
 		unsigned long long dataFrameIndex;
 		unsigned short count;
-		UniformNode<FixedInputReference> *fixedInputsVariableNode;
 
 		//***RECORDING***
 		unsigned short netIndex(0);
@@ -1538,16 +1967,12 @@ private:
 		unsigned short recordingDataSetFrameLength;
 		//***RECORDING***
 
-		//***RECORDING***
-		outputFile << "\"nets\":{";
-		//***RECORDING***
-
 		//net loop
 		do
 		{
 
 			//***RECORDING***
-			outputFile << "{";
+			outputFile << "\n<net_" << netIndex << ">";
 			//***RECORDING***
 
 			//reset the net's fitness rating
@@ -1555,19 +1980,15 @@ private:
 
 			dataSetRowIndex = 0;
 
-			//***RECORDING***
-			outputFile << "\"dataSetRows\":{";
-			//***RECORDING***
-
 			//data set row loop
 			do
 			{
 
 				//***RECORDING***
-				outputFile << "{";
-				outputFile << "\"name\":";
+				outputFile << "\n\t<dataSetRow_" << dataSetRowIndex << ">";
+				outputFile << "\n\t\t<name>";
 				fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
-				outputFile << ",";
+				outputFile << "</name>";
 				//***RECORDING***
 
 				//reset calculated inputs to default values
@@ -1576,9 +1997,7 @@ private:
 
 				dataFrameIndex = 0;
 
-				//***RECORDING***
-				outputFile << "\"dataFrames\":{";
-				//***RECORDING***
+				bind_UpdatingFixedInputsVariables(dataSetRowIndex);
 
 				//data frame loop
 				do
@@ -1587,10 +2006,9 @@ private:
 					//***RECORDING***
 					count = 0;
 
-					outputFile << "{";
-					outputFile << "\"inputs\":{";
-					outputFile << "\"fixedInputs\":{";
-					outputFile << "\"dataSets\":{";
+					outputFile << "\n\t\t<dataFrame_" << dataFrameIndex << ">";
+					outputFile << "\n\t\t\t<inputs>";
+					outputFile << "\n\t\t\t\t<fixedInputs>";
 
 					//count as dataSetColumnIndex
 					do
@@ -1600,90 +2018,74 @@ private:
 
 						recordingDataSetFrameLength = fixedInputs.get_ColumnFrameLength(count);
 
-						outputFile << "{";
-						outputFile << "\"name\":";
+						outputFile << "\n\t\t\t\t\t<dataSetColumn_" << count << ">";
+						outputFile << "\n\t\t\t\t\t\t<name>";
 						fixedInputs.get_ColumnName(count).output_ToOpenFile(outputFile);
-						outputFile << ",\"values\":{";
+						outputFile << "</name>";
 
 						do
 						{
 
+							outputFile << "\n\t\t\t\t\t\t<value_" << recordingDataFrameSubIndex << ">";
 							outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex, count,
 								dataFrameIndex, recordingDataFrameSubIndex);
-
-							if (recordingDataFrameSubIndex < recordingDataSetFrameLength - 1)
-								outputFile << ",";
+							outputFile << "</value_" << recordingDataFrameSubIndex << ">";
 
 							recordingDataFrameSubIndex++;
 
 						} while (recordingDataFrameSubIndex < recordingDataSetFrameLength);
 
-						outputFile << "}";
-
-						if (count < dataSetColumnCount - 1)
-							outputFile << ",";
+						outputFile << "\n\t\t\t\t\t</dataSetColumn_" << count << ">";
 
 						count++;
 
 					} while (count < dataSetColumnCount);
+					outputFile << "\n\t\t\t\t</fixedInputs>";
 
-					outputFile << "}}\"calculatedInputs\":{";
+					outputFile << "\n\t\t\t\t<calculatedInputs>";
 					for (count = 0; count < calculatedInputsCount; count++)
 					{
 
-						outputFile << "{";
-						outputFile << "\"name\":";
+						outputFile << "\n\t\t\t\t\t<ci_" << count << ">";
+						outputFile << "\n\t\t\t\t\t\t<name>";
 						calculatedInputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
-						outputFile << ",\"value\":" << calculatedInputs.get_ElementAddress(count)->get_CurrentValue() << "}";
-
-						if (count < calculatedInputsCount - 1)
-							outputFile << ",";
+						outputFile << "</name>";
+						outputFile << "\n\t\t\t\t\t\t<value>" << calculatedInputs.get_ElementAddress(count)->get_CurrentValue() << "</value>";
+						outputFile << "\n\t\t\t\t\t</ci_" << count << ">";
 
 					}
-					outputFile << "}},";
+					outputFile << "\n\t\t\t\t</calculatedInputs>";
+					outputFile << "\n\t\t\t</inputs>";
 					//***RECORDING***
 
 					//stimulate the net
-					stimulate_SingleFrame_Recorded(dataSetRowIndex, dataFrameIndex,
+					stimulate_SingleFrame(dataSetRowIndex, dataFrameIndex,
 						netNode->content.get_Cells(), activationListRoundA,
-						activationListRoundB, outputFile, false);
+						activationListRoundB);
 
 					//***RECORDING***
-					outputFile << "\"outputs\":{";
+					outputFile << "\n\t\t\t<outputs>";
 					for (count = 0; count < outputCellCount; count++)
 					{
 
-						outputFile << "{";
-						outputFile << "\"name\":";
+						outputFile << "\n\t\t\t\t<o_" << count << ">";
+						outputFile << "\n\t\t\t\t\t<name>";
 						outputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
-						outputFile << ",\"value\":" << outputs.get_ElementAddress(count)->get_Value() << "}";
-
-						if (count < outputCellCount - 1)
-							outputFile << ",";
+						outputFile << "</name>";
+						outputFile << "\n\t\t\t\t\t<value>" << outputs.get_ElementAddress(count)->get_Value() << "</value>";
+						outputFile << "\n\t\t\t\t</o_" << count << ">";
 
 					}
-					outputFile << "}}";
+					outputFile << "\n\t\t\t</outputs>";
+					outputFile << "\n\t\t</dataFrame_" << dataFrameIndex << ">";
 					//***RECORDING***
 
+					//record the outputs compared by lossAccumulators
+					record_LossAccumulatorOutputs(dataFrameIndex);
+
 					//iterate the data frame
 					dataFrameIndex++;
 
-					//reassign any fixedInputs dataPoint variables used in
-					//calculatedInputUpdateExpressions to prep for the next dataFrame
-					fixedInputsVariableNode = updatingFixedInputsVariables.get_FirstNode();
-
-					while (fixedInputsVariableNode)
-					{
-
-						fixedInputsVariableNode->content.get_DataPointVariable()->reassign_Value(
-							fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
-								fixedInputsVariableNode->content.get_DataPointColumnIndex(),
-								dataFrameIndex, fixedInputsVariableNode->content.get_DataPointFrameSubIndex()));
-
-						fixedInputsVariableNode = fixedInputsVariableNode->get_NextNode();
-
-					}
-
 					//update calculatedInputs values via calculatedInputUpdateExpressions
 					//(done here in two steps so that calculatedInputs members can effectively
 					//be updated in parallel, not in series to ensure that changes occuring within
@@ -1691,7 +2093,7 @@ private:
 					//in context of the current dataFrame iteration)
 					for (count = 0; count < calculatedInputsCount; count++)
 						*(calculatedInputsPrepValues.get_ElementAddress(count)) =
-						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate();
+						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate(dataFrameIndex);
 
 					for (count = 0; count < calculatedInputsCount; count++)
 						calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
@@ -1701,14 +2103,12 @@ private:
 
 
 				//update the net's fitness rating
+				accumulate_Losses(dataSetRowIndex);
 				netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
-					dataSetRowIndex)->evaluate());
+					dataSetRowIndex)->evaluate(dataFrameIndex));
 
 				//***RECORDING***
-				outputFile << "}";
-
-				if (dataSetRowIndex < dataSetRowCount - 1)
-					outputFile << ",";
+				outputFile << "\n\t</dataSetRow_" << dataSetRowIndex << ">";
 				//***RECORDING***
 
 				dataSetRowIndex++;
@@ -1716,7 +2116,8 @@ private:
 			} while (dataSetRowIndex < dataSetRowCount);
 
 			//***RECORDING***
-			outputFile << "},\"fitnessRating\":" << netNode->content.get_FitnessRating() << "}";
+			outputFile << "\n\t<fitnessRating>" << netNode->content.get_FitnessRating() << "</fitnessRating>";
+			outputFile << "\n</net_" << netIndex << ">";
 			//***RECORDING***
 
 			netIndex++;
@@ -1726,179 +2127,3077 @@ private:
 
 	}
 
-	*/
-
-	/*
-	checks the leading and numerical properties section of loadedContent to ensure it
-	matches the xml format described below (w/out whitespace); initializes totalNetCount,
-	inputCellCount, outputCellCount, totalCellCount, maxRoundsPerStimulate,
-	dataSetColumnCount, dataSetRowCount, totalDataFrameCount, and calculatedInputsCount;
-	returns 0 if the file section is valid, otherwise returns an error code for console reporting;
-	"<?xmlversion=\"1.0\"?>"										//required
-	<Population>													//required
-		<totalNetCount>...</totalNetCount>							//required (unsigned short >= 2)
-		<inputCellCount>...</inputCellCount>						//required (unsigned short >= 1)
-		<outputCellCount>...</outputCellCount>						//required (unsigned short >= 1)
-		<totalCellCount>...</totalCellCount>						//required (unsigned short >= 3 and >= (inputCellCount + outputCellCount))
-		<maxRoundsPerStimulate>...</maxRoundsPerStimulate>			//required (unsigned short >= 1)
-		<dataSetColumnCount>...</dataSetColumnCount>				//required (unsigned short >= 1)
-		<dataSetRowCount>...</dataSetRowCount>						//required (unsigned long long >= 1)
-		<totalDataFrameCount>...</totalDataFrameCount>				//required (unsigned long long >= 1)
-		<calculatedInputsCount>...</calculatedInputsCount>			//required (unsigned short any value)	
-	*/
-	inline unsigned char sub_Initialize_Validate_NumericalProperties(
-		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	//uses all data sets/frames to stimulate netsIncluded number of nets
+	//starting from net in first position; updates nets' performance ratings
+	//in the process, but does not sort them; assumes outputFile is already open,
+	//assumes netsIncluded >= 1
+	inline void stimulate_AllFramesAllParallels_XMLFullRecord(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
+		ofstream &outputFile, const unsigned short netsIncluded)
 	{
 
-		//variables for leading section and fixedInputs sections validation
-		Word headerTag("<?xmlversion=\"1.0\"?>");
-		Word populationInTag("<Population>");
-		Word totalNetCountInTag("<totalNetCount>");
-		Word totalNetCountOutTag("</totalNetCount>");
-		Word inputCellCountInTag("<inputCellCount>");
-		Word inputCellCountOutTag("</inputCellCount>");
-		Word outputCellCountInTag("<outputCellCount>");
-		Word outputCellCountOutTag("</outputCellCount>");
-		Word totalCellCountInTag("<totalCellCount>");
-		Word totalCellCountOutTag("</totalCellCount>");
-		Word maxRoundsPerStimulateInTag("<maxRoundsPerStimulate>");
-		Word maxRoundsPerStimulateOutTag("</maxRoundsPerStimulate>");
-		Word dataSetColumnCountInTag("<dataSetColumnCount>");
-		Word dataSetColumnCountOutTag("</dataSetColumnCount>");
-		Word dataSetRowCountInTag("<dataSetRowCount>");
-		Word dataSetRowCountOutTag("</dataSetRowCount>");
-		Word totalDataFrameCountInTag("<totalDataFrameCount>");
-		Word totalDataFrameCountOutTag("</totalDataFrameCount>");
-		Word calculatedInputsCountInTag("<calculatedInputsCount>");
-		Word calculatedInputsCountOutTag("</calculatedInputsCount>");
+		//initial setup
+		UniformNode<Net> *netNode(nets.get_FirstNode());
+		unsigned long long dataSetRowIndex;
+		unsigned long long dataFrameIndex;
+		unsigned short count;
 
-		//main body of validation logic
+		//***RECORDING***
+		unsigned short netIndex(0);
+		unsigned short recordingDataFrameSubIndex;
+		unsigned short recordingDataSetFrameLength;
+		//***RECORDING***
 
-		//check for required header
-		if (!loadedContent.validateWordNode_MatchesWord(headerTag, wordIterationNode))
-			return 1;
+		//net loop
+		do
+		{
 
-		//check for required <Population> tag
-		if (!loadedContent.validateWordNode_MatchesWord(populationInTag, wordIterationNode))
-			return 2;
+			//***RECORDING***
+			outputFile << "\n<net_" << netIndex << ">";
+			//***RECORDING***
 
-		//check for required <totalNetCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(totalNetCountInTag, wordIterationNode))
-			return 3;
+			//reset the net's fitness rating
+			netNode->content.reset_FitnessRating();
 
-		//check for required <totalNetCount> value (>= 2)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, totalNetCount, 2))
-			return 4;
+			dataSetRowIndex = 0;
 
-		//check for required </totalNetCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(totalNetCountOutTag, wordIterationNode))
-			return 5;
+			//data set row loop
+			do
+			{
 
-		//check for required <inputCellCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(inputCellCountInTag, wordIterationNode))
-			return 6;
+				//***RECORDING***
+				outputFile << "\n\t<dataSetRow_" << dataSetRowIndex << ">";
+				outputFile << "\n\t\t<name>";
+				fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
+				outputFile << "</name>";
+				//***RECORDING***
 
-		//check for required <inputCellCount> value (>= 1)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, inputCellCount, 1))
-			return 7;
+				//reset calculated inputs to default values
+				for (count = 0; count < calculatedInputsCount; count++)
+					calculatedInputs.get_ElementAddress(count)->reset();
 
-		//check for required </inputCellCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(inputCellCountOutTag, wordIterationNode))
-			return 8;
+				dataFrameIndex = 0;
 
-		//check for required <outputCellCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(outputCellCountInTag, wordIterationNode))
-			return 9;
+				bind_UpdatingFixedInputsVariables(dataSetRowIndex);
 
-		//check for required <outputCellCount> value (>= 1)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, outputCellCount, 1))
-			return 10;
+				//data frame loop
+				do
+				{
 
-		//check for required </outputCellCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(outputCellCountOutTag, wordIterationNode))
-			return 11;
+					//***RECORDING***
+					count = 0;
 
-		//check for required <totalCellCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(totalCellCountInTag, wordIterationNode))
-			return 12;
+					outputFile << "\n\t\t<dataFrame_" << dataFrameIndex << ">";
+					outputFile << "\n\t\t\t<inputs>";
+					outputFile << "\n\t\t\t\t<fixedInputs>";
 
-		//check for required <totalCellCount> value (>= 3 and >= inputCellCount + OutputCellCount)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, totalCellCount, 3)
-			|| totalCellCount < (inputCellCount + outputCellCount))
-			return 13;
+					//count as dataSetColumnIndex
+					do
+					{
 
-		//check for required </totalCellCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(totalCellCountOutTag, wordIterationNode))
-			return 14;
+						recordingDataFrameSubIndex = 0;
 
-		//check for required <maxRoundsPerStimulate> tag
-		if (!loadedContent.validateWordNode_MatchesWord(maxRoundsPerStimulateInTag, wordIterationNode))
-			return 15;
+						recordingDataSetFrameLength = fixedInputs.get_ColumnFrameLength(count);
 
-		//check for required <maxRoundsPerStimulate> value (>= 1)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, maxRoundsPerStimulate, 1))
-			return 16;
+						outputFile << "\n\t\t\t\t\t<dataSetColumn_" << count << ">";
+						outputFile << "\n\t\t\t\t\t\t<name>";
+						fixedInputs.get_ColumnName(count).output_ToOpenFile(outputFile);
+						outputFile << "</name>";
 
-		//check for required </maxRoundsPerStimulate> tag
-		if (!loadedContent.validateWordNode_MatchesWord(maxRoundsPerStimulateOutTag, wordIterationNode))
-			return 17;
+						do
+						{
 
-		//check for required <dataSetColumnCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(dataSetColumnCountInTag, wordIterationNode))
-			return 18;
+							outputFile << "\n\t\t\t\t\t\t<value_" << recordingDataFrameSubIndex << ">";
+							outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex, count,
+								dataFrameIndex, recordingDataFrameSubIndex);
+							outputFile << "</value_" << recordingDataFrameSubIndex << ">";
 
-		//check for required <dataSetColumnCount> value (>= 1)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, dataSetColumnCount, 1))
-			return 19;
+							recordingDataFrameSubIndex++;
 
-		//check for required </dataSetColumnCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(dataSetColumnCountOutTag, wordIterationNode))
-			return 20;
+						} while (recordingDataFrameSubIndex < recordingDataSetFrameLength);
 
-		//check for required <dataSetRowCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(dataSetRowCountInTag, wordIterationNode))
-			return 21;
+						outputFile << "\n\t\t\t\t\t</dataSetColumn_" << count << ">";
 
-		//check for required <dataSetRowCount> value (>= 1)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, dataSetRowCount, 1))
-			return 22;
+						count++;
 
-		//check for required </dataSetRowCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(dataSetRowCountOutTag, wordIterationNode))
-			return 23;
+					} while (count < dataSetColumnCount);
+					outputFile << "\n\t\t\t\t</fixedInputs>";
 
-		//check for required <totalDataFrameCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(totalDataFrameCountInTag, wordIterationNode))
-			return 24;
+					outputFile << "\n\t\t\t\t<calculatedInputs>";
+					for (count = 0; count < calculatedInputsCount; count++)
+					{
 
-		//check for required <totalDataFrameCount> value (>= 1)
-		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, totalDataFrameCount, 1))
-			return 25;
+						outputFile << "\n\t\t\t\t\t<ci_" << count << ">";
+						outputFile << "\n\t\t\t\t\t\t<name>";
+						calculatedInputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
+						outputFile << "</name>";
+						outputFile << "\n\t\t\t\t\t\t<value>" << calculatedInputs.get_ElementAddress(count)->get_CurrentValue() << "</value>";
+						outputFile << "\n\t\t\t\t\t</ci_" << count << ">";
 
-		//check for required </totalDataFrameCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(totalDataFrameCountOutTag, wordIterationNode))
-			return 26;
+					}
+					outputFile << "\n\t\t\t\t</calculatedInputs>";
+					outputFile << "\n\t\t\t</inputs>";
+					//***RECORDING***
 
-		//check for required <calculatedInputsCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsCountInTag, wordIterationNode))
-			return 27;
+					//stimulate the net
+					stimulate_SingleFrame_Recorded(dataSetRowIndex, dataFrameIndex,
+						netNode->content.get_Cells(), activationListRoundA,
+						activationListRoundB, outputFile, true);
 
-		//check for required <calculatedInputsCount> value (unsigned short any value)
+					//***RECORDING***
+					outputFile << "\n\t\t\t<outputs>";
+					for (count = 0; count < outputCellCount; count++)
+					{
+
+						outputFile << "\n\t\t\t\t<o_" << count << ">";
+						outputFile << "\n\t\t\t\t\t<name>";
+						outputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
+						outputFile << "</name>";
+						outputFile << "\n\t\t\t\t\t<value>" << outputs.get_ElementAddress(count)->get_Value() << "</value>";
+						outputFile << "\n\t\t\t\t</o_" << count << ">";
+
+					}
+					outputFile << "\n\t\t\t</outputs>";
+					outputFile << "\n\t\t</dataFrame_" << dataFrameIndex << ">";
+					//***RECORDING***
+
+					//record the outputs compared by lossAccumulators
+					record_LossAccumulatorOutputs(dataFrameIndex);
+
+					//iterate the data frame
+					dataFrameIndex++;
+
+					//update calculatedInputs values via calculatedInputUpdateExpressions
+					//(done here in two steps so that calculatedInputs members can effectively
+					//be updated in parallel, not in series to ensure that changes occuring within
+					//each member round do not impact calculations of members in later array position
+					//in context of the current dataFrame iteration)
+					for (count = 0; count < calculatedInputsCount; count++)
+						*(calculatedInputsPrepValues.get_ElementAddress(count)) =
+						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate(dataFrameIndex);
+
+					for (count = 0; count < calculatedInputsCount; count++)
+						calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
+							calculatedInputsPrepValues.get_Element(count));
+
+				} while (dataFrameIndex < totalDataFrameCount);
+
+
+				//update the net's fitness rating
+				accumulate_Losses(dataSetRowIndex);
+				netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
+					dataSetRowIndex)->evaluate(dataFrameIndex));
+
+				//***RECORDING***
+				outputFile << "\n\t</dataSetRow_" << dataSetRowIndex << ">";
+				//***RECORDING***
+
+				dataSetRowIndex++;
+
+			} while (dataSetRowIndex < dataSetRowCount);
+
+			//***RECORDING***
+			outputFile << "\n\t<fitnessRating>" << netNode->content.get_FitnessRating() << "</fitnessRating>";
+			outputFile << "\n</net_" << netIndex << ">";
+			//***RECORDING***
+
+			netIndex++;
+			netNode = netNode->get_NextNode();
+
+		} while (netIndex < netsIncluded);
+
+	}
+
+	//uses all data sets/frames to stimulate netsIncluded number of nets
+	//starting from net in first position; updates nets' performance ratings
+	//in the process, but does not sort them; assumes outputFile is already open,
+	//assumes netsIncluded >= 1
+	inline void stimulate_AllFramesAllParallels_JSONFullRecord(ExtensibleArray<int> &activationListRoundA,
+		ExtensibleArray<int> &activationListRoundB, ExtensibleArray<double> &calculatedInputsPrepValues,
+		ofstream &outputFile, const unsigned short netsIncluded)
+	{
+
+		//initial setup
+		UniformNode<Net> *netNode(nets.get_FirstNode());
+		unsigned long long dataSetRowIndex;
+		unsigned long long dataFrameIndex;
+		unsigned short count;
+
+		//***RECORDING***
+		unsigned short netIndex(0);
+		unsigned short recordingDataFrameSubIndex;
+		unsigned short recordingDataSetFrameLength;
+		//***RECORDING***
+
+		//***RECORDING***
+		outputFile << "\"nets\":{";
+		//***RECORDING***
+
+		//net loop
+		do
+		{
+
+			//***RECORDING***
+			outputFile << "{";
+			//***RECORDING***
+
+			//reset the net's fitness rating
+			netNode->content.reset_FitnessRating();
+
+			dataSetRowIndex = 0;
+
+			//***RECORDING***
+			outputFile << "\"dataSetRows\":{";
+			//***RECORDING***
+
+			//data set row loop
+			do
+			{
+
+				//***RECORDING***
+				outputFile << "{";
+				outputFile << "\"name\":";
+				fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
+				outputFile << ",";
+				//***RECORDING***
+
+				//reset calculated inputs to default values
+				for (count = 0; count < calculatedInputsCount; count++)
+					calculatedInputs.get_ElementAddress(count)->reset();
+
+				dataFrameIndex = 0;
+
+				bind_UpdatingFixedInputsVariables(dataSetRowIndex);
+
+				//***RECORDING***
+				outputFile << "\"dataFrames\":{";
+				//***RECORDING***
+
+				//data frame loop
+				do
+				{
+
+					//***RECORDING***
+					count = 0;
+
+					outputFile << "{";
+					outputFile << "\"inputs\":{";
+					outputFile << "\"fixedInputs\":{";
+					outputFile << "\"dataSets\":{";
+
+					//count as dataSetColumnIndex
+					do
+					{
+
+						recordingDataFrameSubIndex = 0;
+
+						recordingDataSetFrameLength = fixedInputs.get_ColumnFrameLength(count);
+
+						outputFile << "{";
+						outputFile << "\"name\":";
+						fixedInputs.get_ColumnName(count).output_ToOpenFile(outputFile);
+						outputFile << ",\"values\":{";
+
+						do
+						{
+
+							outputFile << fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex, count,
+								dataFrameIndex, recordingDataFrameSubIndex);
+
+							if (recordingDataFrameSubIndex < recordingDataSetFrameLength - 1)
+								outputFile << ",";
+
+							recordingDataFrameSubIndex++;
+
+						} while (recordingDataFrameSubIndex < recordingDataSetFrameLength);
+
+						outputFile << "}";
+
+						if (count < dataSetColumnCount - 1)
+							outputFile << ",";
+
+						count++;
+
+					} while (count < dataSetColumnCount);
+
+					outputFile << "}}\"calculatedInputs\":{";
+					for (count = 0; count < calculatedInputsCount; count++)
+					{
+
+						outputFile << "{";
+						outputFile << "\"name\":";
+						calculatedInputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
+						outputFile << ",\"value\":" << calculatedInputs.get_ElementAddress(count)->get_CurrentValue() << "}";
+
+						if (count < calculatedInputsCount - 1)
+							outputFile << ",";
+
+					}
+					outputFile << "}},";
+					//***RECORDING***
+
+					//stimulate the net
+					stimulate_SingleFrame_Recorded(dataSetRowIndex, dataFrameIndex,
+						netNode->content.get_Cells(), activationListRoundA,
+						activationListRoundB, outputFile, false);
+
+					//***RECORDING***
+					outputFile << "\"outputs\":{";
+					for (count = 0; count < outputCellCount; count++)
+					{
+
+						outputFile << "{";
+						outputFile << "\"name\":";
+						outputs.get_ElementAddress(count)->outputName_ToOpenFile(outputFile);
+						outputFile << ",\"value\":" << outputs.get_ElementAddress(count)->get_Value() << "}";
+
+						if (count < outputCellCount - 1)
+							outputFile << ",";
+
+					}
+					outputFile << "}}";
+					//***RECORDING***
+
+					//record the outputs compared by lossAccumulators
+					record_LossAccumulatorOutputs(dataFrameIndex);
+
+					//iterate the data frame
+					dataFrameIndex++;
+
+					//update calculatedInputs values via calculatedInputUpdateExpressions
+					//(done here in two steps so that calculatedInputs members can effectively
+					//be updated in parallel, not in series to ensure that changes occuring within
+					//each member round do not impact calculations of members in later array position
+					//in context of the current dataFrame iteration)
+					for (count = 0; count < calculatedInputsCount; count++)
+						*(calculatedInputsPrepValues.get_ElementAddress(count)) =
+						calculatedInputUpdateExpressions.get_ElementAddress(count)->evaluate(dataFrameIndex);
+
+					for (count = 0; count < calculatedInputsCount; count++)
+						calculatedInputs.get_ElementAddress(count)->set_CurrentValue(
+							calculatedInputsPrepValues.get_Element(count));
+
+				} while (dataFrameIndex < totalDataFrameCount);
+
+
+				//update the net's fitness rating
+				accumulate_Losses(dataSetRowIndex);
+				netNode->content.modify_FitnessRating(evaluationCriteriaExpressions.get_ElementAddress(
+					dataSetRowIndex)->evaluate(dataFrameIndex));
+
+				//***RECORDING***
+				outputFile << "}";
+
+				if (dataSetRowIndex < dataSetRowCount - 1)
+					outputFile << ",";
+				//***RECORDING***
+
+				dataSetRowIndex++;
+
+			} while (dataSetRowIndex < dataSetRowCount);
+
+			//***RECORDING***
+			outputFile << "},\"fitnessRating\":" << netNode->content.get_FitnessRating() << "}";
+			//***RECORDING***
+
+			netIndex++;
+			netNode = netNode->get_NextNode();
+
+		} while (netIndex < netsIncluded);
+
+	}
+
+	*/
+
+	/*
+	checks the leading and numerical properties section of loadedContent to ensure it
+	matches the xml format described below (w/out whitespace); initializes totalNetCount,
+	inputCellCount, outputCellCount, totalCellCount, maxRoundsPerStimulate,
+	dataSetColumnCount, dataSetRowCount, totalDataFrameCount, and calculatedInputsCount;
+	returns 0 if the file section is valid, otherwise returns an error code for console reporting;
+	"<?xmlversion=\"1.0\"?>"										//required
+	<Population>													//required
+		<totalNetCount>...</totalNetCount>							//required (unsigned short >= 2)
+		<inputCellCount>...</inputCellCount>						//required (unsigned short >= 1)
+		<outputCellCount>...</outputCellCount>						//required (unsigned short >= 1)
+		<totalCellCount>...</totalCellCount>						//required (unsigned short >= 3 and >= (inputCellCount + outputCellCount))
+		<maxRoundsPerStimulate>...</maxRoundsPerStimulate>			//required (unsigned short >= 1)
+		<dataSetColumnCount>...</dataSetColumnCount>				//required (unsigned short >= 1)
+		<dataSetRowCount>...</dataSetRowCount>						//required (unsigned long long >= 1)
+		<totalDataFrameCount>...</totalDataFrameCount>				//required (unsigned long long >= 1)
+		<calculatedInputsCount>...</calculatedInputsCount>			//required (unsigned short any value)	
+	*/
+	inline unsigned char sub_Initialize_Validate_NumericalProperties(
+		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	{
+
+		//variables for leading section and fixedInputs sections validation
+		Word headerTag("<?xmlversion=\"1.0\"?>");
+		Word populationInTag("<Population>");
+		Word totalNetCountInTag("<totalNetCount>");
+		Word totalNetCountOutTag("</totalNetCount>");
+		Word inputCellCountInTag("<inputCellCount>");
+		Word inputCellCountOutTag("</inputCellCount>");
+		Word outputCellCountInTag("<outputCellCount>");
+		Word outputCellCountOutTag("</outputCellCount>");
+		Word totalCellCountInTag("<totalCellCount>");
+		Word totalCellCountOutTag("</totalCellCount>");
+		Word maxRoundsPerStimulateInTag("<maxRoundsPerStimulate>");
+		Word maxRoundsPerStimulateOutTag("</maxRoundsPerStimulate>");
+		Word dataSetColumnCountInTag("<dataSetColumnCount>");
+		Word dataSetColumnCountOutTag("</dataSetColumnCount>");
+		Word dataSetRowCountInTag("<dataSetRowCount>");
+		Word dataSetRowCountOutTag("</dataSetRowCount>");
+		Word totalDataFrameCountInTag("<totalDataFrameCount>");
+		Word totalDataFrameCountOutTag("</totalDataFrameCount>");
+		Word calculatedInputsCountInTag("<calculatedInputsCount>");
+		Word calculatedInputsCountOutTag("</calculatedInputsCount>");
+
+		//main body of validation logic
+
+		//check for required header
+		if (!loadedContent.validateWordNode_MatchesWord(headerTag, wordIterationNode))
+			return 1;
+
+		//check for required <Population> tag
+		if (!loadedContent.validateWordNode_MatchesWord(populationInTag, wordIterationNode))
+			return 2;
+
+		//check for required <totalNetCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(totalNetCountInTag, wordIterationNode))
+			return 3;
+
+		//check for required <totalNetCount> value (>= 2)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, totalNetCount, 2))
+			return 4;
+
+		//check for required </totalNetCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(totalNetCountOutTag, wordIterationNode))
+			return 5;
+
+		//check for required <inputCellCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(inputCellCountInTag, wordIterationNode))
+			return 6;
+
+		//check for required <inputCellCount> value (>= 1)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, inputCellCount, 1))
+			return 7;
+
+		//check for required </inputCellCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(inputCellCountOutTag, wordIterationNode))
+			return 8;
+
+		//check for required <outputCellCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(outputCellCountInTag, wordIterationNode))
+			return 9;
+
+		//check for required <outputCellCount> value (>= 1)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, outputCellCount, 1))
+			return 10;
+
+		//check for required </outputCellCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(outputCellCountOutTag, wordIterationNode))
+			return 11;
+
+		//check for required <totalCellCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(totalCellCountInTag, wordIterationNode))
+			return 12;
+
+		//check for required <totalCellCount> value (>= 3 and >= inputCellCount + OutputCellCount)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, totalCellCount, 3)
+			|| totalCellCount < (inputCellCount + outputCellCount))
+			return 13;
+
+		//check for required </totalCellCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(totalCellCountOutTag, wordIterationNode))
+			return 14;
+
+		//check for required <maxRoundsPerStimulate> tag
+		if (!loadedContent.validateWordNode_MatchesWord(maxRoundsPerStimulateInTag, wordIterationNode))
+			return 15;
+
+		//check for required <maxRoundsPerStimulate> value (>= 1)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, maxRoundsPerStimulate, 1))
+			return 16;
+
+		//check for required </maxRoundsPerStimulate> tag
+		if (!loadedContent.validateWordNode_MatchesWord(maxRoundsPerStimulateOutTag, wordIterationNode))
+			return 17;
+
+		//check for required <dataSetColumnCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(dataSetColumnCountInTag, wordIterationNode))
+			return 18;
+
+		//check for required <dataSetColumnCount> value (>= 1)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, dataSetColumnCount, 1))
+			return 19;
+
+		//check for required </dataSetColumnCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(dataSetColumnCountOutTag, wordIterationNode))
+			return 20;
+
+		//check for required <dataSetRowCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(dataSetRowCountInTag, wordIterationNode))
+			return 21;
+
+		//check for required <dataSetRowCount> value (>= 1)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, dataSetRowCount, 1))
+			return 22;
+
+		//check for required </dataSetRowCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(dataSetRowCountOutTag, wordIterationNode))
+			return 23;
+
+		//check for required <totalDataFrameCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(totalDataFrameCountInTag, wordIterationNode))
+			return 24;
+
+		//check for required <totalDataFrameCount> value (>= 1)
+		if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, totalDataFrameCount, 1))
+			return 25;
+
+		//check for required </totalDataFrameCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(totalDataFrameCountOutTag, wordIterationNode))
+			return 26;
+
+		//check for required <calculatedInputsCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsCountInTag, wordIterationNode))
+			return 27;
+
+		//check for required <calculatedInputsCount> value (unsigned short any value)
 		if (!loadedContent.validateWordNode_UnsignedInt_Unlimited(wordIterationNode, calculatedInputsCount))
 			return 28;
 
-		//check for required </calculatedInputsCount> tag
-		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsCountOutTag, wordIterationNode))
-			return 29;
+		//check for required </calculatedInputsCount> tag
+		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsCountOutTag, wordIterationNode))
+			return 29;
+
+		//this section of the file is valid; totalNetCount, inputCellCount, outputCellCount,
+		//totalCellCount, maxRoundsPerStimulate, dataSetColumnCount, dataSetRowCount,
+		//totalDataFrameCount, and calculatedInputsCount have been initialized
+		return 0;
+
+	}
+
+	inline bool sub_Initialize_InterpretReturn_NumericalPropertiesValidation(
+		const unsigned char fileValidationReturnCode)
+	{
+
+		cout << "\n";
+
+		if (fileValidationReturnCode == 0)
+		{
+
+			cout << "leading and numerical properties file sections are valid";
+			return true;
+
+		}
+			
+		else
+		{
+
+			if (fileValidationReturnCode == 1)
+				cout << "missing XML header or incomplete file";
+			else if (fileValidationReturnCode == 2)
+				cout << "missing <Population> tag or incomplete file";
+			else if (fileValidationReturnCode == 3)
+				cout << "missing <totalNetCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 4)
+				cout << "invalid <totalNetCount> value or incomplete file";
+			else if (fileValidationReturnCode == 5)
+				cout << "missing </totalNetCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 6)
+				cout << "missing <inputCellCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 7)
+				cout << "invalid <inputCellCount> value or incomplete file";
+			else if (fileValidationReturnCode == 8)
+				cout << "missing </inputCellCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 9)
+				cout << "missing <outputCellCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 10)
+				cout << "invalid <outputCellCount> value or incomplete file";
+			else if (fileValidationReturnCode == 11)
+				cout << "missing </outputCellCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 12)
+				cout << "missing <totalCellCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 13)
+				cout << "invalid <totalCellCount> value or incomplete file";
+			else if (fileValidationReturnCode == 14)
+				cout << "missing </totalCellCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 15)
+				cout << "missing <maxRoundsPerStimulate> tag or incomplete file";
+			else if (fileValidationReturnCode == 16)
+				cout << "invalid <maxRoundsPerStimulate> value or incomplete file";
+			else if (fileValidationReturnCode == 17)
+				cout << "missing </maxRoundsPerStimulate> tag or incomplete file";
+			else if (fileValidationReturnCode == 18)
+				cout << "missing <dataSetColumnCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 19)
+				cout << "invalid <dataSetColumnCount> value or incomplete file";
+			else if (fileValidationReturnCode == 20)
+				cout << "missing </dataSetColumnCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 21)
+				cout << "missing <dataSetRowCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 22)
+				cout << "invalid <dataSetRowCount> value or incomplete file";
+			else if (fileValidationReturnCode == 23)
+				cout << "missing </dataSetRowCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 24)
+				cout << "missing <totalDataFrameCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 25)
+				cout << "invalid <totalDataFrameCount> value or incomplete file";
+			else if (fileValidationReturnCode == 26)
+				cout << "missing </totalDataFrameCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 27)
+				cout << "missing <calculatedInputsCount> tag or incomplete file";
+			else if (fileValidationReturnCode == 28)
+				cout << "invalid <calculatedInputsCount> value or incomplete file";
+			else if (fileValidationReturnCode == 29)
+				cout << "missing </calculatedInputsCount> tag or incomplete file";
+
+			//reverse any possible partial initialization
+
+			//numerical properties null states
+			totalNetCount = 2;
+			inputCellCount = 1;
+			outputCellCount = 1;
+			totalCellCount = 3;
+			maxRoundsPerStimulate = 1;
+			dataSetColumnCount = 1;
+			dataSetRowCount = 1;
+			totalDataFrameCount = 1;
+			calculatedInputsCount = 0;
+
+			return false;
+
+		}
+
+	}
+
+	/*
+	checks the fixedInputs and calculatedInputs sections of loadedContent to
+	ensure they match the xml format described below (w/out whitespace);
+	initializes fixedInputs, calculatedInputs, and calculatedInputsPrepValues;
+	returns 0 if the file section is valid, otherwise returns an error code for console reporting;
+	<fixedInputs>												//required
+		<name>...</name>										//required (alphanumeric Word)
+		<columns>												//required
+			<c_0>												//required (tag matches any <c_#>)
+				<name>...</name>								//required (alphanumeric Word)
+				<frameLength>...</frameLength>					//required (unsigned short >= 1)
+				<shiftLength>...</shiftLength>					//required (any unsigned short)
+			</c_0>												//required (tag matches any </c_#>)
+			<c_1>												//optional
+				...
+			</c_1>
+			...
+		</columns>												//required
+		<rows>													//required
+			<r_0>												//required
+				<name>...</name>								//required (alphanumeric Word)
+				<dataSets>										//required
+					<ds_0>										//required (tag matches any <ds_#>)
+						<dataPoints>							//required
+							<dp_0>...</dp_0>					//required (any double)
+							<dp_1>...</dp_1>					//optional
+							...
+						</dataPoints>							//required
+					</ds_0>										//required (tag matches any </ds_#>)
+					<ds_1>										//optional
+						...
+					</ds_1>
+					...
+				</dataSets>										//required
+			</r_0>
+			<r_1>												//optional
+				...
+			</r_1>
+			...
+		</rows>
+	</fixedInputs>
+	<calculatedInputs>											//required
+		<ci_0>													//optional (tag matches any <ci_#>)
+			<name>...</name>									//required (alphanumeric Word)
+			<defaultValue>...</defaultValue>					//required (any double)
+		</ci_0>													//required (tag matches any </ci_#>)
+		<ci_1>													//optional
+			...
+		</ci_0>
+		...
+	</calculatedInputs>											//required
+	*/
+	inline unsigned char sub_Initialize_Validate_Inputs(
+		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	{
+
+		//variables for fixedInputs section validation
+		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+
+		Word fixedInputsInTag("<fixedInputs>");
+		Word fixedInputsOutTag("</fixedInputs>");
+		Word nameInTag("<name>");
+		Word nameOutTag("</name>");
+		Word columnsInTag("<columns>");
+		Word columnsOutTag("</columns>");
+
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord columnInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord columnOutTag(tempConstructCodes);
+
+		Word frameLengthInTag("<frameLength>");
+		Word frameLengthOutTag("</frameLength>");
+		Word shiftLengthInTag("<shiftLength>");
+		Word shiftLengthOutTag("</shiftLength>");
+		Word rowsInTag("<rows>");
+		Word rowsOutTag("</rows>");
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('r'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord rowInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('r'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord rowOutTag(tempConstructCodes);
+
+		Word dataSetsInTag("<dataSets>");
+		Word dataSetsOutTag("</dataSets>");
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('s'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord dataSetInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('s'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord dataSetOutTag(tempConstructCodes);
+
+		Word dataPointsInTag("<dataPoints>");
+		Word dataPointsOutTag("</dataPoints>");
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord dataPointInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord dataPointOutTag(tempConstructCodes);
+
+		//temp storage variables
+		Word fixedInputsName;
+		Word tempName;
+		unsigned short tempFrameLength;
+		unsigned short tempShiftLength;
+		UniformList<DataSetColumn> tempDataSetColumns;
+		UniformNode<DataSetColumn> *tempColumnNode;
+		
+		UniformList<double> tempDataPointsList;
+		UniformNode<double> *tempDataPointNode;
+		unsigned long long tempDataPointsListLength;
+
+		UniformList<DataSet> tempDataSets;
+		UniformList<DataSetRow> tempDataSetRows;
+
+		unsigned short tempInputCellCount = 0;
+
+		//main body of validation logic
+
+		//check for required <fixedInputs> tag
+		if (!loadedContent.validateWordNode_MatchesWord(fixedInputsInTag, wordIterationNode))
+			return 1;
+
+		//check for required <name> tag
+		if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
+			return 49;
+
+		//capture required name alphanumeric word
+		if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, fixedInputsName))
+			return 50;
+
+		//check for required </name> tag
+		if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
+			return 51;
+
+		//check for required <columns> tag
+		if (!loadedContent.validateWordNode_MatchesWord(columnsInTag, wordIterationNode))
+			return 2;
+
+		//columns validation loop
+		do
+		{
+
+			//check for required <c_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(columnInTag, wordIterationNode))
+				return 3;
+
+			//check for required <name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
+				return 4;
+
+			//capture required name alphanumeric word
+			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
+				return 5;
+
+			//check for required </name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
+				return 6;
+
+			//check for required <frameLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(frameLengthInTag, wordIterationNode))
+				return 7;
+
+			//capture required frameLength unsigned short (>= 1)
+			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempFrameLength, 1))
+				return 8;
+
+			//check for required </frameLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(frameLengthOutTag, wordIterationNode))
+				return 9;
+
+			//update the value of tempInputCellCount for later validation against inputCellCount
+			tempInputCellCount += tempFrameLength;
+
+			//check for required <shiftLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(shiftLengthInTag, wordIterationNode))
+				return 10;
+
+			//capture required shiftLength unsigned short
+			if (!loadedContent.validateWordNode_UnsignedInt_Unlimited(wordIterationNode, tempShiftLength))
+				return 11;
+
+			//check for required </shiftLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(shiftLengthOutTag, wordIterationNode))
+				return 12;
+
+			//check for required associated </c_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(columnOutTag, wordIterationNode))
+				return 13;
+
+			tempDataSetColumns.add_NewNode(DataSetColumn(tempName,
+				tempFrameLength, tempShiftLength));
+
+		} while (columnInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+		//check for required </columns> tag
+		if (!loadedContent.validateWordNode_MatchesWord(columnsOutTag, wordIterationNode))
+			return 52;
+
+		if (tempDataSetColumns.get_ListLength() != dataSetColumnCount)
+			return 14;
+
+		//check for required <rows> tag
+		if (!loadedContent.validateWordNode_MatchesWord(rowsInTag, wordIterationNode))
+			return 15;
+
+		//row validation loop
+		do
+		{
+
+			//check for required <r_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(rowInTag, wordIterationNode))
+				return 16;
+
+			//check for required <name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
+				return 17;
+
+			//capture required name alphanumeric Word
+			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
+				return 18;
+
+			//check for required </name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
+				return 19;
+
+			//check for required <dataSets> tag
+			if (!loadedContent.validateWordNode_MatchesWord(dataSetsInTag, wordIterationNode))
+				return 20;
+
+			tempColumnNode = tempDataSetColumns.get_FirstNode();
+
+			//data set validation loop
+			do
+			{
+
+				//test whether there are more data sets in this row
+				//than there should be based on the number of columns
+				if (!tempColumnNode)
+					return 30;
+
+				//check for required <ds_#> tag
+				if (!loadedContent.validateWordNode_MatchesTerm(dataSetInTag, wordIterationNode))
+					return 21;
+
+				//check for required <dataPoints> tag
+				if (!loadedContent.validateWordNode_MatchesWord(dataPointsInTag, wordIterationNode))
+					return 22;
+
+				//tempDataPoints population loop
+				do
+				{
+
+					//check for required <dp_#> tag
+					if (!loadedContent.validateWordNode_MatchesTerm(dataPointInTag, wordIterationNode))
+						return 23;
+
+					//capture required dp_# value
+					tempDataPointNode = tempDataPointsList.add_NewNode();
+					if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(
+						wordIterationNode, tempDataPointNode->content))
+						return 24;
+
+					//check for required </dp_#> tag
+					if (!loadedContent.validateWordNode_MatchesTerm(dataPointOutTag, wordIterationNode))
+						return 25;
+
+				} while (dataPointInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+				//check for required </dataPoints> tag
+				if (!loadedContent.validateWordNode_MatchesWord(dataPointsOutTag, wordIterationNode))
+					return 26;
+
+				//check for required associated </ds_#> tag
+				if (!loadedContent.validateWordNode_MatchesTerm(dataSetOutTag, wordIterationNode))
+					return 27;
+
+				//verify that the structure of data set is valid in context of it's corresponding row
+				tempFrameLength = tempColumnNode->content.get_FrameLength();
+				tempShiftLength = tempColumnNode->content.get_ShiftLength();
+				tempDataPointsListLength = tempDataPointsList.get_ListLength();
+
+				if (tempDataPointsListLength < (totalDataFrameCount * tempShiftLength) + tempFrameLength)
+					return 28;
+
+				else if (tempDataPointsListLength == tempFrameLength && totalDataFrameCount != 1)
+					return 29;
+
+				//add the current data set to tempDataSets and reset
+				//tempDataPointsList to prep for the next possible data set
+				tempDataSets.add_NewNode(DataSet(tempDataPointsList));
+				tempDataPointsList.delete_WholeList();
+
+				//iterate to the next column
+				tempColumnNode = tempColumnNode->get_NextNode();
+
+			} while (dataSetInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+			//ensure there are not fewer data sets in this row than there are columns
+			if (tempDataSets.get_ListLength() != dataSetColumnCount)
+				return 31;
+
+			//check for required </dataSets> tag
+			if (!loadedContent.validateWordNode_MatchesWord(dataSetsOutTag, wordIterationNode))
+				return 32;
+
+			//check for required associated </r_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(rowOutTag, wordIterationNode))
+				return 33;
+
+			//add the current row to tempDataSetRows and reset
+			//tempDataSets to prep for the next possible row
+			tempDataSetRows.add_NewNode(DataSetRow(tempName, tempDataSets));
+			tempDataSets.delete_WholeList();
+
+		} while (rowInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+		//check for required </rows> tag
+		if (!loadedContent.validateWordNode_MatchesWord(rowsOutTag, wordIterationNode))
+			return 34;
+
+		//ensure there are the correct number of rows
+		if (tempDataSetRows.get_ListLength() != dataSetRowCount)
+			return 35;
+
+		//check for required </fixedInputs> tag
+		if (!loadedContent.validateWordNode_MatchesWord(fixedInputsOutTag, wordIterationNode))
+			return 36;
+
+		//the fixedInputs section of the file is valid
+		fixedInputs = DataSetCollection(fixedInputsName, tempDataSetRows, tempDataSetColumns);
+
+		//calculated input validation section
+
+		//novel variables for calculated input validation
+		Word calculatedInputsInTag("<calculatedInputs>");
+		Word calculatedInputsOutTag("</calculatedInputs>");
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord calculatedInputInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord calculatedInputOutTag(tempConstructCodes);
+
+		Word defaultValueInTag("<defaultValue>");
+		Word defaultValueOutTag("</defaultValue>");
+
+		//novel temp storage variables for calculated input validation
+		double tempDefaultValue;
+		UniformList<Input_Calculated> tempCalculatedInputsList;
+
+		//check for required <calculatedInputs> tag
+		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsInTag, wordIterationNode))
+			return 37;
+
+		//calculated input object construction loop
+		while (calculatedInputInTag.testWord_MatchesTerm(wordIterationNode->content))
+		{
+
+			//check for required <ci_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputInTag, wordIterationNode))
+				return 38;
+
+			//check for required <name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
+				return 39;
+
+			//capture required name alphanumeric Word
+			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
+				return 40;
+
+			//check for required </name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
+				return 41;
+
+			//check for required <defaultValue> tag
+			if (!loadedContent.validateWordNode_MatchesWord(defaultValueInTag, wordIterationNode))
+				return 42;
+
+			//capture required <defaultValue> value
+			if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, tempDefaultValue))
+				return 43;
+
+			//check for required </defaultValue> tag
+			if (!loadedContent.validateWordNode_MatchesWord(defaultValueOutTag, wordIterationNode))
+				return 44;
+
+			//check for required </ci_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputOutTag, wordIterationNode))
+				return 45;
+
+			tempCalculatedInputsList.add_NewNode(Input_Calculated(tempDefaultValue, tempName));
+
+		}
+
+		//check for required </calculatedInputs> tag
+		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsOutTag, wordIterationNode))
+			return 46;
+
+		if (tempCalculatedInputsList.get_ListLength() != calculatedInputsCount)
+			return 47;
+
+		tempInputCellCount += calculatedInputsCount;
+
+		if (tempInputCellCount != inputCellCount)
+			return 48;
+
+		//the calculated inputs section of the file is valid
+		calculatedInputs = tempCalculatedInputsList;
+
+		//fixedInputs and calculatedInputs have been initialized
+		return 0;
+
+	}
+
+	inline bool sub_Initialize_InterpretReturn_InputsValidation(
+		const unsigned char fileValidationReturnCode)
+	{
+
+		cout << "\n";
+
+		if (fileValidationReturnCode == 0)
+		{
+
+			cout << "fixedInputs and calculatedInputs file sections are valid";
+			return true;
+
+		}
+			
+		else
+		{
+
+			if (fileValidationReturnCode == 1)
+				cout << "missing <fixedInputs> tag or incomplete file";
+			else if (fileValidationReturnCode == 49)
+				cout << "missing fixedInputs <name> tag or incomplete file";
+			else if (fileValidationReturnCode == 50)
+				cout << "missing fixedInputs <name> value or incomplete file";
+			else if (fileValidationReturnCode == 51)
+				cout << "missing fixedInputs </name> tag or incomplete file";
+			else if (fileValidationReturnCode == 2)
+				cout << "missing <columns> tag or incomplete file";
+			else if (fileValidationReturnCode == 3)
+				cout << "missing <c_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 4)
+				cout << "missing column <name> tag or incomplete file";
+			else if (fileValidationReturnCode == 5)
+				cout << "missing column <name> value or incomplete file";
+			else if (fileValidationReturnCode == 6)
+				cout << "missing column </name> tag or incomplete file";
+			else if (fileValidationReturnCode == 7)
+				cout << "missing <frameLength> tag or incomplete file";
+			else if (fileValidationReturnCode == 8)
+				cout << "invalid <frameLength> value or incomplete file";
+			else if (fileValidationReturnCode == 9)
+				cout << "missing </frameLength> tag or incomplete file";
+			else if (fileValidationReturnCode == 10)
+				cout << "missing <shiftLength> tag or incomplete file";
+			else if (fileValidationReturnCode == 11)
+				cout << "invalid <shiftLength> value or incomplete file";
+			else if (fileValidationReturnCode == 12)
+				cout << "missing </shiftLength> tag or incomplete file";
+			else if (fileValidationReturnCode == 13)
+				cout << "missing </c_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 14)
+				cout << "discrepant dataSetColumnCount and counted data set columns";
+			else if (fileValidationReturnCode == 52)
+				cout << "missing </columns> tag or incomplete file";
+			else if (fileValidationReturnCode == 15)
+				cout << "missing <rows> tag or incomplete file";
+			else if (fileValidationReturnCode == 16)
+				cout << "missing <r_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 17)
+				cout << "missing row <name> tag or incomplete file";
+			else if (fileValidationReturnCode == 18)
+				cout << "missing row <name> value or incomplete file";
+			else if (fileValidationReturnCode == 19)
+				cout << "missing row </name> tag or incomplete file";
+			else if (fileValidationReturnCode == 20)
+				cout << "missing <dataSets> tag or incomplete file";
+			else if (fileValidationReturnCode == 21)
+				cout << "missing <ds_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 22)
+				cout << "missing <dataPoints> tag or incomplete file";
+			else if (fileValidationReturnCode == 23)
+				cout << "missing <dp_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 24)
+				cout << "invalid <dp_#> value or incomplete file";
+			else if (fileValidationReturnCode == 25)
+				cout << "missing </dp_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 26)
+				cout << "missing </dataPoints> tag or incomplete file";
+			else if (fileValidationReturnCode == 27)
+				cout << "missing </ds_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 28)
+				cout << "illegal structure: dataPoints listLength < (totalDataFrameCount * shiftLength) + frameLength";
+			else if (fileValidationReturnCode == 29)
+				cout << "illegal structure: totalDataFrameCount must = 1 when dataPoints listLength == frameLength ";
+			else if (fileValidationReturnCode == 30)
+				cout << "illegal structure: more DataSet objects contained in a row than there are columns";
+			else if (fileValidationReturnCode == 31)
+				cout << "illegal structure: fewer DataSet objects contained in a row than there are columns";
+			else if (fileValidationReturnCode == 32)
+				cout << "missing </dataSets> tag or incomplete file";
+			else if (fileValidationReturnCode == 33)
+				cout << "missing </r_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 34)
+				cout << "missing </rows> tag or incomplete file";
+			else if (fileValidationReturnCode == 35)
+				cout << "discrepant dataSetRowCount and counted rows";
+			else if (fileValidationReturnCode == 36)
+				cout << "missing </fixedInputs> tag or incomplete file";
+			else if (fileValidationReturnCode == 37)
+				cout << "missing <calculatedInputs> tag or incomplete file";
+			else if (fileValidationReturnCode == 38)
+				cout << "missing <ci_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 39)
+				cout << "missing calculated input <name> tag or incomplete file";
+			else if (fileValidationReturnCode == 40)
+				cout << "missing calculated input <name> value or incomplete file";
+			else if (fileValidationReturnCode == 41)
+				cout << "missing calculated input </name> tag or incomplete file";
+			else if (fileValidationReturnCode == 42)
+				cout << "missing <defaultValue> tag or incomplete file";
+			else if (fileValidationReturnCode == 43)
+				cout << "invalid <defaultValue> value or incomplete file";
+			else if (fileValidationReturnCode == 44)
+				cout << "missing </defaultValue> tag or incomplete file";
+			else if (fileValidationReturnCode == 45)
+				cout << "missing </ci_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 46)
+				cout << "missing </calculatedInputs> tag or incomplete file";
+			else if (fileValidationReturnCode == 47)
+				cout << "discrepant calculatedInputsCount and counted calculated inputs";
+			else if (fileValidationReturnCode == 48)
+				cout << "discrepant inputCellCount and calculated number of required input cells";
+
+			//reverse any possible partial initialization
+
+			//numerical properties null states
+			totalNetCount = 2;
+			inputCellCount = 1;
+			outputCellCount = 1;
+			totalCellCount = 3;
+			maxRoundsPerStimulate = 1;
+			dataSetColumnCount = 1;
+			dataSetRowCount = 1;
+			totalDataFrameCount = 1;
+			calculatedInputsCount = 0;
+
+			//fixedInputs and calculatedInputs null states
+			fixedInputs = DataSetCollection();
+			calculatedInputs.resize_NoCopy(0);
+
+			return false;
+
+		}
+
+	}
+
+	/*
+	checks the outputs section of loadedContent to ensure it matches
+	the xml format described below (w/out whitespace);
+	initializes outputs and returns 0 if the file section is valid,
+	otherwise returns an error code for console reporting;
+	<outputs>											//required
+		<o_0>											//required (tag matches any <o_#>)
+			<name>...</name>							//required (alphanumeric Word)
+			<maxActivations>...</maxActivations>		//required (unsigned short >= 1)
+		</o_0>											//required (tag matches any </o_#>)
+		<o_1>											//optional
+			...
+		</o_1>
+		...
+	</outputs>											//required
+	*/
+	inline unsigned char sub_Initialize_Validate_Outputs(
+		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	{
+
+		//novel variables for output validation
+		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+		
+		Word outputsInTag("<outputs>");
+		Word outputsOutTag("</outputs>");
+
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('o'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord outputInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('o'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord outputOutTag(tempConstructCodes);
+
+		Word nameInTag("<name>");
+		Word nameOutTag("</name>");
+		Word maxActivationsInTag("<maxActivations>");
+		Word maxActivationsOutTag("</maxActivations>");
+
+		//storage variables
+		Word tempName;
+		unsigned short tempMaxActivations;
+		UniformList<Output> tempOutputsList;
+
+		//check for required <outputs> tag
+		if (!loadedContent.validateWordNode_MatchesWord(outputsInTag, wordIterationNode))
+			return 2;
+
+		//output object construction loop
+		do
+		{
+
+			//check for required <o_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(outputInTag, wordIterationNode))
+				return 3;
+
+			//check for required <name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
+				return 4;
+
+			//capture required name alphanumeric Word
+			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
+				return 5;
+
+			//check for required </name> tag
+			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
+				return 6;
+
+			//check for required <maxActivations> tag
+			if (!loadedContent.validateWordNode_MatchesWord(maxActivationsInTag, wordIterationNode))
+				return 7;
+
+			//capture required maxActivations unsigned short (must be >= 1)
+			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempMaxActivations, 1))
+				return 8;
+
+			//check for required </maxActivations> tag
+			if (!loadedContent.validateWordNode_MatchesWord(maxActivationsOutTag, wordIterationNode))
+				return 9;
+
+			//check for required </o_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(outputOutTag, wordIterationNode))
+				return 10;
+
+			//add a node to tempOutputs
+			tempOutputsList.add_NewNode(Output(tempName, tempMaxActivations));
+
+		} while (outputInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+		//check for required </outputs> tag
+		if (!loadedContent.validateWordNode_MatchesWord(outputsOutTag, wordIterationNode))
+			return 11;
+
+		//check for required length
+		if (tempOutputsList.get_ListLength() != outputCellCount)
+			return 12;
+
+		//this section of the file is valid
+		outputs = tempOutputsList;
+
+		//outputs has been initialized
+		return 0;
+
+	}
+
+	inline bool sub_Initialize_InterpretReturn_OutputsValidation(
+		const unsigned char fileValidationReturnCode)
+	{
+
+		cout << "\n";
+
+		if (fileValidationReturnCode == 0)
+		{
+
+			cout << "outputs file section is valid";
+			return true;
+
+		}
+
+		else
+		{
+
+			if (fileValidationReturnCode == 2)
+				cout << "missing <outputs> tag or incomplete file";
+			else if (fileValidationReturnCode == 3)
+				cout << "missing <o_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 4)
+				cout << "missing <name> tag or incomplete file";
+			else if (fileValidationReturnCode == 5)
+				cout << "missing <name> value or incomplete file";
+			else if (fileValidationReturnCode == 6)
+				cout << "missing </name> tag or incomplete file";
+			else if (fileValidationReturnCode == 7)
+				cout << "missing <maxActivations> tag or incomplete file";
+			else if (fileValidationReturnCode == 8)
+				cout << "invalid <maxActivations> value or incomplete file";
+			else if (fileValidationReturnCode == 9)
+				cout << "missing </maxActivations> tag or incomplete file";
+			else if (fileValidationReturnCode == 10)
+				cout << "missing </o_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 11)
+				cout << "missing </outputs> tag or incomplete file";
+			else if (fileValidationReturnCode == 12)
+				cout << "discrepant outputCellCount and counted outputs";
+
+			//reverse any possible partial initialization
+
+			//numerical properties null states
+			totalNetCount = 2;
+			inputCellCount = 1;
+			outputCellCount = 1;
+			totalCellCount = 3;
+			maxRoundsPerStimulate = 1;
+			dataSetColumnCount = 1;
+			dataSetRowCount = 1;
+			totalDataFrameCount = 1;
+			calculatedInputsCount = 0;
+
+			//fixedInputs and calculatedInputs null states
+			fixedInputs = DataSetCollection();
+			calculatedInputs.resize_NoCopy(0);
+
+			//outputs null state
+			outputs.resize_NoCopy(1);
+
+			return false;
+
+		}
+
+	}
+
+	//records the output value each of lossAccumulators compares after data frame
+	//dataFrameIndex (see LossAccumulator::record_Output())
+	inline void record_LossAccumulatorOutputs(const unsigned long long dataFrameIndex)
+	{
+
+		LossAccumulator *lossAccumulator;
+
+		for (unsigned short count = 0; count < lossAccumulatorCount; count++)
+		{
+
+			lossAccumulator = lossAccumulators.get_ElementAddress(count);
+			lossAccumulator->record_Output(dataFrameIndex,
+				outputs.get_ElementAddress(lossAccumulator->get_OutputIndex())->get_Value());
+
+		}
+
+	}
+
+	//computes the loss of each of lossAccumulators over every data frame of
+	//dataSetRowIndex from its recorded output values, so the row's evaluation criteria
+	//expression reads the losses through their variables; assumes the output values of
+	//every data frame of dataSetRowIndex have been recorded
+	inline void accumulate_Losses(const unsigned long long dataSetRowIndex)
+	{
+
+		LossAccumulator *lossAccumulator;
+		unsigned short columnIndex;
+
+		for (unsigned short count = 0; count < lossAccumulatorCount; count++)
+		{
+
+			lossAccumulator = lossAccumulators.get_ElementAddress(count);
+			columnIndex = lossAccumulator->get_ColumnIndex();
+
+			lossAccumulator->accumulate(fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
+				columnIndex, 0, lossAccumulator->get_ColumnSubIndex()),
+				fixedInputs.get_ColumnShiftLength(columnIndex), totalDataFrameCount);
+
+		}
+
+	}
+
+	//binds each of updatingFixedInputsVariables to its data points in dataSetRowIndex as
+	//a strided sequence (see Variable_Double::set_FrameStride()), so expressions
+	//evaluated for a data frame read that frame's data point without any rebinding
+	inline void bind_UpdatingFixedInputsVariables(const unsigned long long dataSetRowIndex)
+	{
+
+		UniformNode<FixedInputReference> *fixedInputsVariableNode(updatingFixedInputsVariables.get_FirstNode());
+		Variable_Double *dataPointVariable;
+		unsigned short columnIndex;
+
+		while (fixedInputsVariableNode)
+		{
+
+			dataPointVariable = fixedInputsVariableNode->content.get_DataPointVariable();
+			columnIndex = fixedInputsVariableNode->content.get_DataPointColumnIndex();
+
+			dataPointVariable->reassign_Value(fixedInputs.get_FrameAdjustedDataPointAddress(dataSetRowIndex,
+				columnIndex, 0, fixedInputsVariableNode->content.get_DataPointFrameSubIndex()));
+			dataPointVariable->set_FrameStride(fixedInputs.get_ColumnShiftLength(columnIndex));
+
+			fixedInputsVariableNode = fixedInputsVariableNode->get_NextNode();
+
+		}
+
+	}
+
+	//classifies each calculated input as data-only, if its update expression refers to
+	//no output and to no calculated input other than data-only ones (so its values in
+	//each data frame of a data set row are the same for every net), or net dependent;
+	//data-only calculated inputs are computed once per data set row (see
+	//compute_DataOnlyCalculatedInputs()) rather than once per net; assumes
+	//variablesList and calculatedInputUpdateExpressions are initialized
+	inline void populate_DataOnlyCalculatedInputs()
+	{
+
+		ExtensibleArray<bool> dataOnly(calculatedInputsCount + 1);
+		ExtensibleArray<Variable_Double*> calculatedInputVariables(calculatedInputsCount + 1);
+		UniformNode<Variable_Double> *variableNode(variablesList.get_FirstNode());
+		Expression_Double *expression;
+		unsigned long long rowIndex;
+		unsigned short count;
+		unsigned short otherCount;
+		bool changed;
+
+		//calculated input variables lead variablesList, output variables directly follow
+		for (count = 0; count < calculatedInputsCount; count++)
+		{
+
+			*(calculatedInputVariables.get_ElementAddress(count)) = &(variableNode->content);
+			*(dataOnly.get_ElementAddress(count)) = true;
+
+			variableNode = variableNode->get_NextNode();
+
+		}
+
+		for (otherCount = 0; otherCount < outputCellCount; otherCount++)
+		{
+
+			for (count = 0; count < calculatedInputsCount; count++)
+			{
+
+				if (calculatedInputUpdateExpressions.get_ElementAddress(count)->test_RefersToComponent(
+					&(variableNode->content)))
+					*(dataOnly.get_ElementAddress(count)) = false;
+
+			}
+
+			variableNode = variableNode->get_NextNode();
+
+		}
+
+		//a calculated input reading a net dependent calculated input is net dependent
+		do
+		{
+
+			changed = false;
+
+			for (count = 0; count < calculatedInputsCount; count++)
+			{
+
+				if (!dataOnly.get_Element(count))
+					continue;
+
+				expression = calculatedInputUpdateExpressions.get_ElementAddress(count);
+
+				for (otherCount = 0; otherCount < calculatedInputsCount; otherCount++)
+				{
+
+					if (!dataOnly.get_Element(otherCount)
+						&& expression->test_RefersToComponent(calculatedInputVariables.get_Element(otherCount)))
+					{
+
+						*(dataOnly.get_ElementAddress(count)) = false;
+						changed = true;
+						break;
+
+					}
+
+				}
+
+			}
+
+		} while (changed);
+
+		dataOnlyCalculatedInputIndices.resize_NoCopy(calculatedInputsCount + 1);
+		netCalculatedInputIndices.resize_NoCopy(calculatedInputsCount + 1);
+		dataOnlyCalculatedInputCount = 0;
+		netCalculatedInputCount = 0;
+
+		for (count = 0; count < calculatedInputsCount; count++)
+		{
+
+			if (dataOnly.get_Element(count))
+				*(dataOnlyCalculatedInputIndices.get_ElementAddress(dataOnlyCalculatedInputCount++)) = count;
+
+			else
+				*(netCalculatedInputIndices.get_ElementAddress(netCalculatedInputCount++)) = count;
+
+		}
+
+		dataOnlyCalculatedInputValues.resize_NoCopy(dataSetRowCount * totalDataFrameCount
+			* dataOnlyCalculatedInputCount);
+		dataOnlyValuesComputed.resize_NoCopy(dataSetRowCount);
+
+		for (rowIndex = 0; rowIndex < dataSetRowCount; rowIndex++)
+			*(dataOnlyValuesComputed.get_ElementAddress(rowIndex)) = false;
+
+	}
+
+	//computes the dataOnlyCalculatedInputValues of dataSetRowIndex unless they are
+	//current, updating the data-only calculated inputs over every data frame of the row
+	//as stimulate_AllFrames_SingleRow() would; leaves the data-only calculated inputs
+	//with their values after the last data frame; assumes
+	//updatingFixedInputsVariables are bound to dataSetRowIndex
+	inline void compute_DataOnlyCalculatedInputs(const unsigned long long dataSetRowIndex)
+	{
+
+		unsigned long long dataOnlyValueIndex(dataSetRowIndex * totalDataFrameCount * dataOnlyCalculatedInputCount);
+		unsigned long long dataFrameIndex;
+		unsigned short count;
+
+		if (!dataOnlyCalculatedInputCount || dataOnlyValuesComputed.get_Element(dataSetRowIndex))
+			return;
+
+		for (count = 0; count < dataOnlyCalculatedInputCount; count++)
+			calculatedInputs.get_ElementAddress(dataOnlyCalculatedInputIndices.get_Element(count))->reset();
+
+		//data-only update expressions read only data-only calculated inputs, so every
+		//value of a data frame is computed before any is set (as in a net's update)
+		for (dataFrameIndex = 1; dataFrameIndex <= totalDataFrameCount; dataFrameIndex++)
+		{
+
+			for (count = 0; count < dataOnlyCalculatedInputCount; count++)
+				*(dataOnlyCalculatedInputValues.get_ElementAddress(dataOnlyValueIndex + count)) =
+				calculatedInputUpdateExpressions.get_ElementAddress(
+					dataOnlyCalculatedInputIndices.get_Element(count))->evaluate(dataFrameIndex);
+
+			for (count = 0; count < dataOnlyCalculatedInputCount; count++)
+				calculatedInputs.get_ElementAddress(dataOnlyCalculatedInputIndices.get_Element(count))->set_CurrentValue(
+					dataOnlyCalculatedInputValues.get_Element(dataOnlyValueIndex++));
+
+		}
+
+		*(dataOnlyValuesComputed.get_ElementAddress(dataSetRowIndex)) = true;
+
+	}
+
+	//populates updatingFixedInputsVariables with every fixed input data point variable
+	//(the final entries of variablesList, in column then frame sub index order) which is
+	//utilized by an expression
+	inline void populate_UpdatingFixedInputsVariables()
+	{
+
+		UniformNode<Variable_Double> *variableNode(variablesList.get_LastNode());
+		unsigned short count;
+		unsigned short frameLength;
+		unsigned short frameSubIndex;
+
+		updatingFixedInputsVariables.delete_WholeList();
+
+		for (count = (dataSetColumnCount - 1); count > 0; count--)
+		{
+
+			frameLength = fixedInputs.get_ColumnFrameLength(count);
+
+			for (frameSubIndex = (frameLength - 1); frameSubIndex > 0; frameSubIndex--)
+			{
+
+				if (variableNode->content.get_Utilized())
+					updatingFixedInputsVariables.add_NewNode(FixedInputReference(
+						&(variableNode->content), frameSubIndex, count), NULL, false);
+
+				variableNode = variableNode->get_PriorNode();
+
+			}
+
+			if (variableNode->content.get_Utilized())
+				updatingFixedInputsVariables.add_NewNode(FixedInputReference(
+					&(variableNode->content), frameSubIndex, count), NULL, false);
+
+			variableNode = variableNode->get_PriorNode();
+
+		}
+
+		frameLength = fixedInputs.get_ColumnFrameLength(count);
+
+		for (frameSubIndex = (frameLength - 1); frameSubIndex > 0; frameSubIndex--)
+		{
+
+			if (variableNode->content.get_Utilized())
+				updatingFixedInputsVariables.add_NewNode(FixedInputReference(
+					&(variableNode->content), frameSubIndex, count), NULL, false);
+
+			variableNode = variableNode->get_PriorNode();
+
+		}
+
+		if (variableNode->content.get_Utilized())
+			updatingFixedInputsVariables.add_NewNode(FixedInputReference(
+				&(variableNode->content), frameSubIndex, count), NULL, false);
+
+	}
+
+	/*
+	checks the calculatedInputUpdateExpressions and evaluationCriteriaExpressions
+	sections of loadedContent to ensure they match the xml format described below
+	(w/out whitespace); first initializes variablesList with Variable_Doubles
+	corresponding to each fixed input column (first data frame of the first row initially),
+	calculated input, and output; next initializes lossAccumulators (whose variables
+	follow the output variables in variablesList), evaluationCriteriaExpressions and
+	calculatedInputUpdateExpressions; returns 0 if the file section is valid,
+	otherwise returns an error code for console reporting;
+	<lossAccumulators>								//optional
+		<la_0>										//optional (tag matches any <la_#>)
+			<name>...</name>						//required (alphanumeric, unique among calculated input, output and loss accumulator names)
+			<lossType>...</lossType>				//required (unsigned char; 0 means sum of squared error, 1 sum of absolute error, 2 thresholded accuracy)
+			<outputIndex>...</outputIndex>			//required (unsigned short < outputCellCount)
+			<columnIndex>...</columnIndex>			//required (unsigned short < dataSetColumnCount, the fixed input column holding the targets)
+			<columnSubIndex>...</columnSubIndex>	//required (unsigned short < the column's frame length)
+			<threshold>...</threshold>				//required (double, used by thresholded accuracy only)
+		</la_0>										//optional (tag matches any </la_#>)
+		...
+	</lossAccumulators>								//required if <lossAccumulators> is present
+	<evaluationCriteriaExpressions>
+		<ece_0>...</ece_0>							//required (tags match any <ece_#> and </ece_#>, content is an alphanumeric matching the name of any calculated input, output or loss accumulator represented in variablesList
+		...
+	</evaluationCriteriaExpressions>				//required
+	<calculatedInputUpdateExpressions>				//required
+		<ciue_0>...</ciue_0>						//optional (tags match any <ciue_#> and </ciue_#>, content is an alphanumeric or alphanumeric indexed matching the name of any fixed input, calculated input, or output represented in variablesList
+		...
+	</calculatedInputUpdateExpressions>				//required
+	*/
+	inline unsigned char sub_Initialize_Validate_Expressions(
+		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	{
+
+		//partially initialize variablesList;
+		variablesList.delete_WholeList();
+
+		unsigned short count;
+		unsigned short frameLength;
+		unsigned short frameSubIndex;
+		Word columnName;
+		Word subFrameIndexWord;
+		UniformNode<char> *charNode;
+		Output *currentOutput;
+		Input_Calculated *currentCalculatedInput;
+
+		for (count = 0; count < calculatedInputsCount; count++)
+		{
+
+			currentCalculatedInput = calculatedInputs.get_ElementAddress(count);
+
+			variablesList.add_NewNode(Variable_Double(currentCalculatedInput->get_Name(),
+				currentCalculatedInput->get_WorkingValueAddress()));
+
+		}
+
+		for (count = 0; count < outputCellCount; count++)
+		{
+
+			currentOutput = outputs.get_ElementAddress(count);
+
+			variablesList.add_NewNode(Variable_Double(currentOutput->get_Name(),
+				currentOutput->get_ValueAddress()));
+
+		}
+
+		//novel variables for lossAccumulators population
+		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+
+		Word lossAccumulatorsInTag("<lossAccumulators>");
+		Word lossAccumulatorsOutTag("</lossAccumulators>");
+
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('l'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('a'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord lossAccumulatorInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('l'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('a'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord lossAccumulatorOutTag(tempConstructCodes);
+
+		Word nameInTag("<name>");
+		Word nameOutTag("</name>");
+		Word lossTypeInTag("<lossType>");
+		Word lossTypeOutTag("</lossType>");
+		Word outputIndexInTag("<outputIndex>");
+		Word outputIndexOutTag("</outputIndex>");
+		Word columnIndexInTag("<columnIndex>");
+		Word columnIndexOutTag("</columnIndex>");
+		Word columnSubIndexInTag("<columnSubIndex>");
+		Word columnSubIndexOutTag("</columnSubIndex>");
+		Word thresholdInTag("<threshold>");
+		Word thresholdOutTag("</threshold>");
+
+		//novel variables for evaluationCriteriaExpressions and calculatedInputUpdateExpressions population
+		tempConstructCodes.delete_WholeList();
+
+		Word evaluationCriteriaExpressionsInTag("<evaluationCriteriaExpressions>");
+		Word evaluationCriteriaExpressionsOutTag("</evaluationCriteriaExpressions>");
+
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord evaluationCriteriaExpressionInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord evaluationCriteriaExpressionOutTag(tempConstructCodes);
+
+		Word calculatedInputUpdateExpressionsInTag("<calculatedInputUpdateExpressions>");
+		Word calculatedInputUpdateExpressionsOutTag("</calculatedInputUpdateExpressions>");
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('u'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord calculatedInputUpdateExpressionInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('u'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord calculatedInputUpdateExpressionOutTag(tempConstructCodes);
+
+		//storage variables
+		UniformList<Expression_Double> tempExpressions;
+		UniformNode<Expression_Double> *tempExpressionNode;
+		UniformList<LossAccumulator> tempLossAccumulators;
+		UniformNode<LossAccumulator> *lossAccumulatorNode;
+		UniformNode<Variable_Double> *variableNode;
+		UniformNode<Variable_Double> *firstLossVariableNode;
+		Word tempName;
+		unsigned char tempLossType;
+		unsigned short tempOutputIndex;
+		unsigned short tempColumnIndex;
+		unsigned short tempColumnSubIndex;
+		double tempThreshold;
+
+		//main body of validation logic
+
+		//optional <lossAccumulators> section
+		if (wordIterationNode->content == lossAccumulatorsInTag)
+		{
+
+			wordIterationNode = wordIterationNode->get_NextNode();
+
+			if (!wordIterationNode)
+				return 4;
+
+			//lossAccumulators initialization loop
+			while (lossAccumulatorInTag.testWord_MatchesTerm(wordIterationNode->content))
+			{
+
+				//check for required <la_#> tag
+				if (!loadedContent.validateWordNode_MatchesTerm(lossAccumulatorInTag, wordIterationNode))
+					return 15;
+
+				//check for required <name> tag
+				if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
+					return 16;
+
+				//capture required name alphanumeric Word
+				if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
+					return 17;
+
+				//check the name is not taken by another variable
+				for (variableNode = variablesList.get_FirstNode(); variableNode; variableNode = variableNode->get_NextNode())
+				{
+
+					if (variableNode->content.get_Name() == tempName)
+						return 18;
+
+				}
+
+				for (lossAccumulatorNode = tempLossAccumulators.get_FirstNode(); lossAccumulatorNode;
+					lossAccumulatorNode = lossAccumulatorNode->get_NextNode())
+				{
+
+					if (lossAccumulatorNode->content.get_Name() == tempName)
+						return 18;
+
+				}
+
+				//check for required </name> tag
+				if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
+					return 19;
+
+				//check for required <lossType> tag
+				if (!loadedContent.validateWordNode_MatchesWord(lossTypeInTag, wordIterationNode))
+					return 20;
+
+				//capture required lossType unsigned char (must be <= 2)
+				if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempLossType, 0, true, 2))
+					return 21;
+
+				//check for required </lossType> tag
+				if (!loadedContent.validateWordNode_MatchesWord(lossTypeOutTag, wordIterationNode))
+					return 22;
+
+				//check for required <outputIndex> tag
+				if (!loadedContent.validateWordNode_MatchesWord(outputIndexInTag, wordIterationNode))
+					return 23;
+
+				//capture required outputIndex unsigned short (must be < outputCellCount)
+				if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempOutputIndex, 0,
+					true, outputCellCount - 1))
+					return 24;
+
+				//check for required </outputIndex> tag
+				if (!loadedContent.validateWordNode_MatchesWord(outputIndexOutTag, wordIterationNode))
+					return 25;
+
+				//check for required <columnIndex> tag
+				if (!loadedContent.validateWordNode_MatchesWord(columnIndexInTag, wordIterationNode))
+					return 26;
+
+				//capture required columnIndex unsigned short (must be < dataSetColumnCount)
+				if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempColumnIndex, 0,
+					true, dataSetColumnCount - 1))
+					return 27;
+
+				//check for required </columnIndex> tag
+				if (!loadedContent.validateWordNode_MatchesWord(columnIndexOutTag, wordIterationNode))
+					return 28;
+
+				//check for required <columnSubIndex> tag
+				if (!loadedContent.validateWordNode_MatchesWord(columnSubIndexInTag, wordIterationNode))
+					return 29;
+
+				//capture required columnSubIndex unsigned short (must be < the column's frame length)
+				if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempColumnSubIndex, 0,
+					true, fixedInputs.get_ColumnFrameLength(tempColumnIndex) - 1))
+					return 30;
+
+				//check for required </columnSubIndex> tag
+				if (!loadedContent.validateWordNode_MatchesWord(columnSubIndexOutTag, wordIterationNode))
+					return 31;
+
+				//check for required <threshold> tag
+				if (!loadedContent.validateWordNode_MatchesWord(thresholdInTag, wordIterationNode))
+					return 32;
+
+				//capture required threshold double
+				if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, tempThreshold))
+					return 33;
+
+				//check for required </threshold> tag
+				if (!loadedContent.validateWordNode_MatchesWord(thresholdOutTag, wordIterationNode))
+					return 34;
+
+				//check for required </la_#> tag
+				if (!loadedContent.validateWordNode_MatchesTerm(lossAccumulatorOutTag, wordIterationNode))
+					return 35;
+
+				tempLossAccumulators.add_NewNode(LossAccumulator(tempName, tempLossType, tempOutputIndex,
+					tempColumnIndex, tempColumnSubIndex, tempThreshold));
+
+			}
+
+			//check for required </lossAccumulators> tag
+			if (!loadedContent.validateWordNode_MatchesWord(lossAccumulatorsOutTag, wordIterationNode))
+				return 36;
+
+		}
+
+		//initialize lossAccumulators and add their variables to variablesList
+		lossAccumulatorCount = tempLossAccumulators.get_ListLength();
+		lossAccumulators = tempLossAccumulators;
+		firstLossVariableNode = NULL;
+
+		for (count = 0; count < lossAccumulatorCount; count++)
+		{
+
+			LossAccumulator *lossAccumulator(lossAccumulators.get_ElementAddress(count));
+
+			lossAccumulator->set_FrameCount(totalDataFrameCount);
+
+			variableNode = variablesList.add_NewNode(Variable_Double(lossAccumulator->get_Name(),
+				lossAccumulator->get_ValueAddress()));
+
+			if (!firstLossVariableNode)
+				firstLossVariableNode = variableNode;
+
+		}
+
+		//check for required <evaluationCriteriaExpressions> tag
+		if (!loadedContent.validateWordNode_MatchesWord(evaluationCriteriaExpressionsInTag, wordIterationNode))
+			return 1;
+
+		//evaluationCriteriaExpressions initialization loop
+		while (evaluationCriteriaExpressionInTag.testWord_MatchesTerm(wordIterationNode->content))
+		{
+
+			//check for required <ece_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(evaluationCriteriaExpressionInTag, wordIterationNode))
+				return 2;
+
+			tempExpressionNode = tempExpressions.add_NewNode();
+
+			//check for valid expression using only variables contained in variablesList
+			if (!tempExpressionNode->content.initialize(wordIterationNode->content, variablesList))
+				return 3;
+
+			wordIterationNode = wordIterationNode->get_NextNode();
+
+			if (!wordIterationNode)
+				return 4;
+
+			//check for required </ece_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(evaluationCriteriaExpressionOutTag, wordIterationNode))
+				return 5;
+
+		}
+
+		//check for required </evaluationCriteriaExpressions> tag
+		if (!loadedContent.validateWordNode_MatchesWord(evaluationCriteriaExpressionsOutTag, wordIterationNode))
+			return 6;
+
+		//check whether the correct number of evaluation criteria expressions are represented
+		if (tempExpressions.get_ListLength() != dataSetRowCount)
+			return 7;
+
+		//this sections of the file is valid, initialize calculatedInputUpdateExpressions
+		evaluationCriteriaExpressions = tempExpressions;
+
+		tempExpressions.delete_WholeList();
+
+		//complete initialization of variables list
+		for (count = 0; count < dataSetColumnCount; count++)
+		{
+
+			frameLength = fixedInputs.get_ColumnFrameLength(count);
+			columnName = fixedInputs.get_ColumnName(count);
+
+			for (frameSubIndex = 0; frameSubIndex < frameLength; frameSubIndex++)
+			{
+
+				//set up subFrameIndexWord to correspond to this subframe index
+				//in the format "[#]" then add subFrameIndexWord to the end of
+				//columnName and create a new Variable_Double corresponding to the combined word
+				subFrameIndexWord.add_NewNode('[');
+				subFrameIndexWord.transcribe_UnsignedShort(frameSubIndex);
+				subFrameIndexWord.add_NewNode(']');
+
+				columnName.add_CutWholeList(subFrameIndexWord);
+
+				variablesList.add_NewNode(Variable_Double(columnName,
+					fixedInputs.get_FrameAdjustedDataPointAddress(0, count, 0, frameSubIndex)));
+
+				//***TESTING***
+				cout << "\n";
+				columnName.output_Console();
+				//***TESTING***
+
+				charNode = columnName.get_LastNode();
+
+				do
+				{
+
+					charNode = charNode->get_PriorNode();
+
+				} while (charNode->content != '[');
+
+				columnName.delete_Range(charNode, columnName.get_LastNode());
+
+			}
+
+		}
+
+		//check for required <calculatedInputUpdateExpressions> tag
+		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputUpdateExpressionsInTag, wordIterationNode))
+			return 8;
+
+		//calculatedInputUpdateExpressions initialization loop
+		while (calculatedInputUpdateExpressionInTag.testWord_MatchesTerm(wordIterationNode->content))
+		{
+
+			//check for required <ciue_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputUpdateExpressionInTag, wordIterationNode))
+				return 9;
+
+			tempExpressionNode = tempExpressions.add_NewNode();
+
+			//check for valid expression using only variables contained in variablesList
+			if (!tempExpressionNode->content.initialize(wordIterationNode->content, variablesList))
+				return 10;
+
+			wordIterationNode = wordIterationNode->get_NextNode();
+
+			if (!wordIterationNode)
+				return 11;
+
+			//check for required </ciue_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputUpdateExpressionOutTag, wordIterationNode))
+				return 12;
+
+		}
+
+		//check for required </calculatedInputUpdateExpressions> tag
+		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputUpdateExpressionsOutTag, wordIterationNode))
+			return 13;
+
+		//check whether the correct number of calculated input update expressions are represented
+		if (tempExpressions.get_ListLength() != calculatedInputsCount)
+			return 14;
+
+		//losses are only known at the end of a data set row, check that no calculated
+		//input update expression refers to one
+		for (count = 0, variableNode = firstLossVariableNode; count < lossAccumulatorCount;
+			count++, variableNode = variableNode->get_NextNode())
+		{
+
+			for (tempExpressionNode = tempExpressions.get_FirstNode(); tempExpressionNode;
+				tempExpressionNode = tempExpressionNode->get_NextNode())
+			{
+
+				if (tempExpressionNode->content.test_RefersToComponent(&(variableNode->content)))
+					return 37;
+
+			}
+
+		}
+
+		//this sections of the file is valid, initialize calculatedInputUpdateExpressions
+		calculatedInputUpdateExpressions = tempExpressions;
+
+		//populate updatingFixedInputsVariables
+		populate_UpdatingFixedInputsVariables();
+
+		//classify the calculated inputs; any net dependent calculated input
+		//reads an output (directly or through other calculated inputs)
+		populate_DataOnlyCalculatedInputs();
+
+		calculatedInputsReadOutputs = (netCalculatedInputCount > 0);
+
+		if (calculatedInputsReadOutputs)
+			incrementalEvaluation = false;
+
+		//evaluationCriteriaExpressions, calculatedInputUpdateExpressions, variablesList,
+		//updatingFixedInputsVariables, the calculated input classification and
+		//calculatedInputsReadOutputs have been initialized
+		return 0;
+
+	}
+
+	inline bool sub_Initialize_InterpretReturn_ExpressionsValidation(
+		const unsigned char fileValidationReturnCode)
+	{
+
+		cout << "\n";
+
+		if (fileValidationReturnCode == 0)
+		{
+
+			cout << "loss accumulator, calculated input update and evaluation criteria expressions file sections are valid";
+			return true;
+
+		}
+
+		else
+		{
+
+			if (fileValidationReturnCode == 1)
+				cout << "missing <evaluationCriteriaExpressions> tag or incomplete file";
+			else if (fileValidationReturnCode == 2)
+				cout << "missing <ece_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 3)
+				cout << "syntax of an evaluation criteria expression is invalid or refers to an illegal variable";
+			else if (fileValidationReturnCode == 4)
+				cout << "incomplete file";
+			else if (fileValidationReturnCode == 5)
+				cout << "missing </ece_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 6)
+				cout << "missing </evaluationCriteriaExpressions> tag or incomplete file";
+			else if (fileValidationReturnCode == 7)
+				cout << "discrepant dataSetRowCount and counted evaluation criteria expressions";
+			else if (fileValidationReturnCode == 8)
+				cout << "missing <calculatedInputUpdateExpressions> tag or incomplete file";
+			else if (fileValidationReturnCode == 9)
+				cout << "missing <ciue_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 10)
+				cout << "syntax of an calculate input update expression is invalid or refers to an illegal variable";
+			else if (fileValidationReturnCode == 11)
+				cout << "incomplete file";
+			else if (fileValidationReturnCode == 12)
+				cout << "missing </ciue_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 13)
+				cout << "missing </calculatedInputUpdateExpressions> tag or incomplete file";
+			else if (fileValidationReturnCode == 14)
+				cout << "discrepant calculatedInputsCount and counted calculated input update expressions";
+			else if (fileValidationReturnCode == 15)
+				cout << "missing <la_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 16)
+				cout << "missing <name> tag or incomplete file";
+			else if (fileValidationReturnCode == 17)
+				cout << "missing <name> value or incomplete file";
+			else if (fileValidationReturnCode == 18)
+				cout << "loss accumulator name is already the name of a calculated input, output or loss accumulator";
+			else if (fileValidationReturnCode == 19)
+				cout << "missing </name> tag or incomplete file";
+			else if (fileValidationReturnCode == 20)
+				cout << "missing <lossType> tag or incomplete file";
+			else if (fileValidationReturnCode == 21)
+				cout << "invalid <lossType> value or incomplete file";
+			else if (fileValidationReturnCode == 22)
+				cout << "missing </lossType> tag or incomplete file";
+			else if (fileValidationReturnCode == 23)
+				cout << "missing <outputIndex> tag or incomplete file";
+			else if (fileValidationReturnCode == 24)
+				cout << "invalid <outputIndex> value or incomplete file";
+			else if (fileValidationReturnCode == 25)
+				cout << "missing </outputIndex> tag or incomplete file";
+			else if (fileValidationReturnCode == 26)
+				cout << "missing <columnIndex> tag or incomplete file";
+			else if (fileValidationReturnCode == 27)
+				cout << "invalid <columnIndex> value or incomplete file";
+			else if (fileValidationReturnCode == 28)
+				cout << "missing </columnIndex> tag or incomplete file";
+			else if (fileValidationReturnCode == 29)
+				cout << "missing <columnSubIndex> tag or incomplete file";
+			else if (fileValidationReturnCode == 30)
+				cout << "invalid <columnSubIndex> value or incomplete file";
+			else if (fileValidationReturnCode == 31)
+				cout << "missing </columnSubIndex> tag or incomplete file";
+			else if (fileValidationReturnCode == 32)
+				cout << "missing <threshold> tag or incomplete file";
+			else if (fileValidationReturnCode == 33)
+				cout << "invalid <threshold> value or incomplete file";
+			else if (fileValidationReturnCode == 34)
+				cout << "missing </threshold> tag or incomplete file";
+			else if (fileValidationReturnCode == 35)
+				cout << "missing </la_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 36)
+				cout << "missing </lossAccumulators> tag or incomplete file";
+			else if (fileValidationReturnCode == 37)
+				cout << "a calculated input update expression refers to a loss accumulator";
+
+			//reverse any possible partial initialization
+
+			//numerical properties null states
+			totalNetCount = 2;
+			inputCellCount = 1;
+			outputCellCount = 1;
+			totalCellCount = 3;
+			maxRoundsPerStimulate = 1;
+			dataSetColumnCount = 1;
+			dataSetRowCount = 1;
+			totalDataFrameCount = 1;
+			calculatedInputsCount = 0;
+
+			//fixedInputs and calculatedInputs null states
+			fixedInputs = DataSetCollection();
+			calculatedInputs.resize_NoCopy(0);
+
+			//outputs null state
+			outputs.resize_NoCopy(1);
+
+			//variablesList, updatingFixedInputsVariables, evaluationCriteraExpressions
+			//and calculatedInputUpdateExpressions null states
+			variablesList.delete_WholeList();
+			updatingFixedInputsVariables.delete_WholeList();
+			evaluationCriteriaExpressions.resize_NoCopy(1);
+			calculatedInputUpdateExpressions.resize_NoCopy(0);
+			lossAccumulatorCount = 0;
+
+			return false;
+
+		}
+
+	}
+
+	/*
+	checks the cell controls section of loadedContent to ensure it
+	matches the xml format described below (w/out whitespace); initializes
+	//cellControls and trackers then returns 0 if the file section is valid,
+	otherwise returns an error code for console reporting;
+	<cellControlGroups>												//required
+		<ccg_0>														//required (tag matches any <ccg_#>)
+			<groupLength>...</groupLength>										//required (unsigned short >= 1)
+			<linksCoeffCenter>...</linksCoeffCenter>				//required (double > 0.0)
+			<internalSpread>...</internalSpread>					//required (double > 0.0)
+			<broadcastSpread>...</broadcastSpread>					//required (double > 0.0)
+			<linksCoeffSpread>...</linksCoeffSpread>				//required (double > 0.0)
+			<decayRateSpread>...</decayRateSpread>					//required (double > 0.0)
+			<refractoryPeriodSpread>...</refractoryPeriodSpread>	//required (unsigned char >= 1)
+			<broadcastSwitchSignFreq>...</broadcastSwitchSignFreq>	//required (double >= 0.0, <= 1.0)
+			<linksSwitchSignFreq>...</linksSwitchSignFreq>			//required (double >= 0.0, <= 1.0)
+		</ccg_0>													//required (tag matches any </ccg_#>)
+		<ccg_1>														//optional
+			...
+		</ccg_1>
+		...
+	</cellControlGroups>
+	*/
+	inline unsigned char sub_Initialize_ValidateCellControls(
+		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	{
+
+		//variables for validation
+		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+		
+		Word cellControlGroupsInTag("<cellControlGroups>");
+		Word cellControlGroupsOutTag("</cellControlGroups>");
+
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("c", 0, false, 2, 2));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord cellControlGroupInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("c", 0, false, 2, 2));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord cellControlGroupOutTag(tempConstructCodes);
+
+		Word groupLengthInTag("<groupLength>");
+		Word groupLengthOutTag("</groupLength>");
+		Word linksCoeffCenterInTag("<linksCoeffCenter>");
+		Word linksCoeffCenterOutTag("</linksCoeffCenter>");
+		Word internalSpreadInTag("<internalSpread>");
+		Word internalSpreadOutTag("</internalSpread>");
+		Word broadcastSpreadInTag("<broadcastSpread>");
+		Word broadcastSpreadOutTag("</broadcastSpread>");
+		Word linksCoeffSpreadInTag("<linksCoeffSpread>");
+		Word linksCoeffSpreadOutTag("</linksCoeffSpread>");
+		Word decayRateSpreadInTag("<decayRateSpread>");
+		Word decayRateSpreadOutTag("</decayRateSpread>");
+		Word refractoryPeriodSpreadInTag("<refractoryPeriodSpread>");
+		Word refractoryPeriodSpreadOutTag("</refractoryPeriodSpread>");	
+		Word broadcastSwitchSignFreqInTag("<broadcastSwitchSignFreq>");
+		Word broadcastSwitchSignFreqOutTag("</broadcastSwitchSignFreq>");
+		Word linksSwitchSignFreqInTag("<linksSwitchSignFreq>");
+		Word linksSwitchSignFreqOutTag("</linksSwitchSignFreq>");
+
+		//storage variables
+		unsigned short groupLength;
+		double linksCoeffCenter;
+		double internalSpread;
+		double broadcastSpread;
+		double linksCoeffSpread;
+		double decayRateSpread;
+		unsigned char refractoryPeriodSpread;
+		double broadcastSwitchSignFreq;
+		double linksSwitchSignFreq;
+		UniformList<CellControl> tempCellControlsList;
+		UniformNode<CellControl> *cellControlNode;
+
+		unsigned short tempTotalCellCount = 0;
+
+		//main body of validation logic
+
+		//check for required <cellControlGroups> tag
+		if (!loadedContent.validateWordNode_MatchesWord(cellControlGroupsInTag, wordIterationNode))
+			return 2;
+
+		//output object construction loop
+		do
+		{
+
+			//check for required <ccg_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(cellControlGroupInTag, wordIterationNode))
+				return 3;
+
+			//check for required <groupLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(groupLengthInTag, wordIterationNode))
+				return 31;
+
+			//capture required groupLength unsigned short (>= 1)
+			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, groupLength, 1))
+				return 32;
+
+			//check for required </groupLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(groupLengthOutTag, wordIterationNode))
+				return 33;
+
+			//check for required <linksCoeffCenter> tag
+			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffCenterInTag, wordIterationNode))
+				return 4;
+
+			//capture required linksCoeffCenter double (any value)
+			if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, linksCoeffCenter))
+				return 5;
+
+			//check for required </linksCoeffCenter> tag
+			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffCenterOutTag, wordIterationNode))
+				return 6;
+
+			//check for required <internalSpread> tag
+			if(!loadedContent.validateWordNode_MatchesWord(internalSpreadInTag, wordIterationNode))
+				return 7;
+
+			//capture required internalSpread double (must be > 0.0)
+			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, internalSpread, true, true))
+				return 8;
+
+			//check for required </internalSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(internalSpreadOutTag, wordIterationNode))
+				return 9;
+
+			//check for required <broadcastSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(broadcastSpreadInTag, wordIterationNode))
+				return 10;
+
+			//capture required broadcastSpread double (must be > 0.0)
+			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, broadcastSpread, true, true))
+				return 1;
+
+			//check for required </broadcastSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(broadcastSpreadOutTag, wordIterationNode))
+				return 12;
+
+			//check for required <linksCoeffSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffSpreadInTag, wordIterationNode))
+				return 13;
+
+			//capture required linksCoeffSpread double (must be > 0)
+			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, linksCoeffSpread, true, true))
+				return 14;
+
+			//check for required </linksCoeffSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffSpreadOutTag, wordIterationNode))
+				return 15;
+
+			//check for required <decayRateSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(decayRateSpreadInTag, wordIterationNode))
+				return 16;
+
+			//capture required decayRateSpread double (must be > 0)
+			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, decayRateSpread, true, true))
+				return 17;
+
+			//check for required </decayRateSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(decayRateSpreadOutTag, wordIterationNode))
+				return 18;
+
+			//check for required <refractoryPeriodSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodSpreadInTag, wordIterationNode))
+				return 19;
+
+			//capture required refractoryPeriodSpread unsigned char (>= 1)
+			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, refractoryPeriodSpread, 1))
+				return 20;
+
+			//check for required </refractoryPeriodSpread> tag
+			if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodSpreadOutTag, wordIterationNode))
+				return 21;
+
+			//check for required <broadcastSwitchSignFreq> tag
+			if (!loadedContent.validateWordNode_MatchesWord(broadcastSwitchSignFreqInTag, wordIterationNode))
+				return 22;
+
+			//capture required broadcastSwitchSignFreq double (>=0 and <= 1.0)
+			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode,
+				broadcastSwitchSignFreq, false, true, 0.0, true, 1.0))
+				return 23;
+
+			//check for required </broadcastSwitchSignFreq> tag
+			if (!loadedContent.validateWordNode_MatchesWord(broadcastSwitchSignFreqOutTag, wordIterationNode))
+				return 24;
+
+			//check for required <linksSwitchSignFreq> tag
+			if (!loadedContent.validateWordNode_MatchesWord(linksSwitchSignFreqInTag, wordIterationNode))
+				return 25;
+
+			//capture required linksSwitchSignFreq double (>=0 and <= 1.0)
+			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode,
+				linksSwitchSignFreq, false, true, 0.0, true, 1.0))
+				return 26;
+
+			//check for required </linksSwitchSignFreq> tag
+			if (!loadedContent.validateWordNode_MatchesWord(linksSwitchSignFreqOutTag, wordIterationNode))
+				return 27;
+
+			//check for required associated </ccg_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(cellControlGroupOutTag, wordIterationNode))
+				return 28;
+
+			//update tempTotalCellCount
+			tempTotalCellCount += groupLength;
+
+			//add/initialize node(s) to tempCellControlsList
+			cellControlNode = tempCellControlsList.add_NewRange(groupLength, NULL, true, false);
+
+			do
+			{
+
+				cellControlNode->content = CellControl(linksCoeffCenter, internalSpread,
+					broadcastSpread, linksCoeffSpread, decayRateSpread, refractoryPeriodSpread,
+					broadcastSwitchSignFreq, linksSwitchSignFreq);
+
+				cellControlNode = cellControlNode->get_NextNode();
+
+			} while (cellControlNode);
+
+		} while (cellControlGroupInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+		//check for required </cellControlGroups> tag
+		if (!loadedContent.validateWordNode_MatchesWord(cellControlGroupsOutTag, wordIterationNode))
+			return 29;
+
+		//check for required totalCellCount value
+		if (tempTotalCellCount != totalCellCount)
+			return 30;
+
+		//this section of the file is valid
+		cellControls = tempCellControlsList;
+		trackers.resize_NoCopy(totalCellCount);
+
+		//cellControls and trackers have been initialized
+		return 0;
+
+	}
+
+	inline bool sub_Initialize_InterpretReturn_CellControlsValidation(
+		const unsigned char fileValidationReturnCode)
+	{
+
+		cout << "\n";
+
+		if (fileValidationReturnCode == 0)
+		{
+
+			cout << "cell controls file section is valid";
+			return true;
+
+		}
+
+		else
+		{
+
+			if (fileValidationReturnCode == 2)
+				cout << "missing <cellControlGroups> tag or incomplete file";
+			else if (fileValidationReturnCode == 3)
+				cout << "missing <ccg_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 31)
+				cout << "missing <groupLength> tag or incomplete file";
+			else if (fileValidationReturnCode == 32)
+				cout << "invalid <groupLength> value or incomplete file";
+			else if (fileValidationReturnCode == 33)
+				cout << "missing </groupLength> tag or incomplete file";
+			else if (fileValidationReturnCode == 4)
+				cout << "missing <linksCoeffCenter> tag or incomplete file";
+			else if (fileValidationReturnCode == 5)
+				cout << "invalid <linksCoeffCenter> value or incomplete file";
+			else if (fileValidationReturnCode == 6)
+				cout << "missing </linksCoeffCenter> tag or incomplete file";
+			else if (fileValidationReturnCode == 7)
+				cout << "missing <internalSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 8)
+				cout << "invalid <internalSpread> value or incomplete file";
+			else if (fileValidationReturnCode == 9)
+				cout << "missing </internalSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 10)
+				cout << "missing <broadcastSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 11)
+				cout << "invalid <broadcastSpread> value or incomplete file";
+			else if (fileValidationReturnCode == 12)
+				cout << "missing </broadcastSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 13)
+				cout << "missing <linksCoeffSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 14)
+				cout << "invalid <linksCoeffSpread> value or incomplete file";
+			else if (fileValidationReturnCode == 15)
+				cout << "missing </linksCoeffSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 16)
+				cout << "missing <decayRateSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 17)
+				cout << "invalid <decayRateSpread> value or incomplete file";
+			else if (fileValidationReturnCode == 18)
+				cout << "missing </decayRateSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 19)
+				cout << "missing <refractoryPeriodSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 20)
+				cout << "invalid <refractoryPeriodSpread> value or incomplete file";
+			else if (fileValidationReturnCode == 21)
+				cout << "missing </refractoryPeriodSpread> tag or incomplete file";
+			else if (fileValidationReturnCode == 22)
+				cout << "missing <broadcastSwitchSignFreq> tag or incomplete file";
+			else if (fileValidationReturnCode == 23)
+				cout << "invalid <broadcastSwitchSignFreq> value or incomplete file";
+			else if (fileValidationReturnCode == 24)
+				cout << "missing </broadcastSwitchSignFreq> tag or incomplete file";
+			else if (fileValidationReturnCode == 25)
+				cout << "missing <linksSwitchSignFreq> tag or incomplete file";
+			else if (fileValidationReturnCode == 26)
+				cout << "invalid <linksSwitchSignFreq> value or incomplete file";
+			else if (fileValidationReturnCode == 27)
+				cout << "missing </linksSwitchSignFreq> tag or incomplete file";
+			else if (fileValidationReturnCode == 28)
+				cout << "missing </ccg_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 29)
+				cout << "missing </cellControlGroups> tag";
+			else if (fileValidationReturnCode == 30)
+				cout << "discrepant totalCellCount and counted cell controls";
+
+			//reverse any possible partial initialization
+
+			//numerical properties null states
+			totalNetCount = 2;
+			inputCellCount = 1;
+			outputCellCount = 1;
+			totalCellCount = 3;
+			maxRoundsPerStimulate = 1;
+			dataSetColumnCount = 1;
+			dataSetRowCount = 1;
+			totalDataFrameCount = 1;
+			calculatedInputsCount = 0;
+
+			//fixedInputs and calculatedInputs null states
+			fixedInputs = DataSetCollection();
+			calculatedInputs.resize_NoCopy(0);
+
+			//outputs null state
+			outputs.resize_NoCopy(1);
+
+			//variablesList, updatingFixedInputsVariables, evaluationCriteraExpressions
+			//and calculatedInputUpdateExpressions null states
+			variablesList.delete_WholeList();
+			updatingFixedInputsVariables.delete_WholeList();
+			evaluationCriteriaExpressions.resize_NoCopy(1);
+			calculatedInputUpdateExpressions.resize_NoCopy(0);
+			lossAccumulatorCount = 0;
+
+			//cellControls and trackers null states
+			cellControls.resize_NoCopy(3);
+			trackers.resize_NoCopy(3);
+
+			return false;
+
+		}
+
+	}
+
+	/*
+	checks the nets and terminal sections of loadedContent to ensure they
+	matches the xml format described below (w/out whitespace); initializes
+	//nets then returns 0 if the file section is valid, otherwise returns
+	an error code for console reporting
+		<netGroups>															//required
+			<ng_0>															//required
+				<groupLength>...</groupLength>								//required unsigned short >= 1
+				<c_0>														//required
+					<internalCoeff>...</internalCoeff>						//required double >= 0.0
+					<broadcastCoeff>...</broadcastCoeff>					//required double any value
+					<decayRate>...</decayRate>								//required double >= 0.0, <= 1.0
+					<refractoryPeriod>...</refractoryPeriod>				//required unsigned char > 0
+					<postLinks>												//required
+						<pl_0>												//required
+							<postCellIndex>...</postCellIndex>				//unsigned short < totalCellCount
+							<linkCoeff>...</linkCoeff>						//required double any value			
+						</pl_0>												//required
+						<pl_1>												//optional
+							...
+						</pl_1>
+						...
+					</postLinks>											//required
+				</c_0>														//required
+				<c_1>														//optional
+					...
+				</c_1>
+				...
+
+			</ng_0>															//required
+			<ng_1>															//optional
+			...
+			</ng_1>
+			...
+		</netGroups>														//required
+	</Population>															//required
+	*/
+	inline unsigned char sub_Initialize_ValidateNetsAndTerminal(
+		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)	
+	{
+
+		//variables for validation
+		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+
+		Word netGroupsInTag("<netGroups>");
+		Word netGroupsOutTag("</netGroups>");
+
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('n'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord netGroupInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('n'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord netGroupOutTag(tempConstructCodes);
+
+		Word groupLengthInTag("<groupLength>");
+		Word groupLengthOutTag("</groupLength>");
+		Word cellsInTag("<cells>");
+		Word cellsOutTag("</cells>");
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord cellInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord cellOutTag(tempConstructCodes);
+
+		Word internalCoeffInTag("<internalCoeff>");
+		Word internalCoeffOutTag("</internalCoeff>");
+		Word broadcastCoeffInTag("<broadcastCoeff>");
+		Word broadcastCoeffOutTag("</broadcastCoeff>");
+		Word decayRateInTag("<decayRate>");
+		Word decayRateOutTag("</decayRate>");
+		Word refractoryPeriodInTag("<refractoryPeriod>");
+		Word refractoryPeriodOutTag("</refractoryPeriod>");
+		Word postLinksInTag("<postLinks>");
+		Word postLinksOutTag("</postLinks>");
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('l'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord postLinkInTag(tempConstructCodes);
+
+		tempConstructCodes.delete_WholeList();
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('l'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord postLinkOutTag(tempConstructCodes);
+
+		Word postCellIndexInTag("<postCellIndex>");
+		Word postCellIndexOutTag("</postCellIndex>");
+		Word linkCoeffInTag("<linkCoeff>");
+		Word linkCoeffOutTag("</linkCoeff>");
+		Word populationOutTag("</Population>");
+
+		//storage variables
+		unsigned short groupLength;
+		double internalCoeff;
+		double broadcastCoeff;
+		double decayRate;
+		unsigned char refractoryPeriod;
+		unsigned short tempPostCellIndex;
+		int priorTempPostCellIndex;
+		double tempLinkCoeff;
+		UniformList<Link> postLinksList;
+		ExtensibleArray<bool> cellPriorLinksCounts(totalCellCount);
+		ExtensibleArray<unsigned short> netPriorLinksCounts(totalCellCount);
+		UniformList<Cell> tempCellsList;
+		unsigned short cellCount;
+		unsigned short secondCellCount;
+		UniformList<Net> tempNetsList;
+		UniformNode<Net> *netNode;
+
+		//initialize the netPriorLinksCounts list
+		for (cellCount = 0; cellCount < totalCellCount; cellCount++)
+			*(netPriorLinksCounts.get_ElementAddress(cellCount)) = 0;			
+
+		//main body of file validation logic
+
+		//check for required <netGroups> tag
+		if (!loadedContent.validateWordNode_MatchesWord(netGroupsInTag, wordIterationNode))
+			return 2;
+
+		//net object construction loop
+		do
+		{
+
+			//check for required <ng_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(netGroupInTag, wordIterationNode))
+				return 3;
+
+			//check for required <groupLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(groupLengthInTag, wordIterationNode))
+				return 38;
+
+			//capture required <groupLength> unsigned int (>= 1)
+			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, groupLength, 1))
+				return 39;
+
+			//check for required </groupLength> tag
+			if (!loadedContent.validateWordNode_MatchesWord(groupLengthOutTag, wordIterationNode))
+				return 40;
+
+			//check for required <cells> tag
+			if (!loadedContent.validateWordNode_MatchesWord(cellsInTag, wordIterationNode))
+				return 4;
 
-		//this section of the file is valid; totalNetCount, inputCellCount, outputCellCount,
-		//totalCellCount, maxRoundsPerStimulate, dataSetColumnCount, dataSetRowCount,
-		//totalDataFrameCount, and calculatedInputsCount have been initialized
+			cellCount = 0;
+			
+			do
+			{
+
+				priorTempPostCellIndex = -1;
+
+				//check for required <c_#> tag
+				if (!loadedContent.validateWordNode_MatchesTerm(cellInTag, wordIterationNode))
+					return 5;
+
+				//check for required <internalCoeff> tag
+				if (!loadedContent.validateWordNode_MatchesWord(internalCoeffInTag, wordIterationNode))
+					return 6;
+
+				//capture required <internalCoeff> double (>= 0.0)
+				if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, internalCoeff, false, true, 0.0))
+					return 7;
+
+				//check for required </internalCoeff> tag
+				if (!loadedContent.validateWordNode_MatchesWord(internalCoeffOutTag, wordIterationNode))
+					return 8;
+
+				//check for required <broadcastCoeff> tag
+				if (!loadedContent.validateWordNode_MatchesWord(broadcastCoeffInTag, wordIterationNode))
+					return 9;
+
+				//capture required <broadcastCoeff> double (any value)
+				if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, broadcastCoeff))
+					return 10;
+
+				//check for required </broadcastCoeff> tag
+				if (!loadedContent.validateWordNode_MatchesWord(broadcastCoeffOutTag, wordIterationNode))
+					return 11;
+
+				//check for required <decayRate> tag
+				if (!loadedContent.validateWordNode_MatchesWord(decayRateInTag, wordIterationNode))
+					return 12;
+
+				//capture required <decayRate> double (>= 0.0, <= 1.0)
+				if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode,
+					decayRate, false, true, 0.0, true, 1.0))
+					return 13;
+
+				//check for required </decayRate> tag
+				if (!loadedContent.validateWordNode_MatchesWord(decayRateOutTag, wordIterationNode))
+					return 14;
+
+				//check for required <refractoryPeriod> tag
+				if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodInTag, wordIterationNode))
+					return 15;
+
+				//capture required <refractoryPeriod> unsigned char (> 0)
+				if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, refractoryPeriod, 1))
+					return 16;
+
+				//check for required </refractoryPeriod> tag
+				if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodOutTag, wordIterationNode))
+					return 17;
+
+				//check for required <postLinks> tag
+				if (!loadedContent.validateWordNode_MatchesWord(postLinksInTag, wordIterationNode))
+					return 18;
+
+				//reset the cellPriorLinksCounts list
+				for (secondCellCount = 0; secondCellCount < totalCellCount; secondCellCount++)
+					*(cellPriorLinksCounts.get_ElementAddress(secondCellCount)) = false;
+
+				do
+				{
+
+					//check for required <pl_#> tag
+					if (!loadedContent.validateWordNode_MatchesTerm(postLinkInTag, wordIterationNode))
+						return 19;
+
+					//check for required <postCellIndex> tag
+					if (!loadedContent.validateWordNode_MatchesWord(postCellIndexInTag, wordIterationNode))
+						return 20;
+
+					//capture required <postCellIndex> unsigned short (>= 0, < totalCellCount)
+					if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempPostCellIndex, 0, true, (totalCellCount - 1)))
+						return 21;
+
+					//ensure postCellIndex is not this cell's index, is not a duplicate index
+					//within this postLinks list, and is in correct ascending list order;
+					//increment the index's netPriorCellLinks tracking count
+					if (tempPostCellIndex == cellCount)
+						return 22;
+
+					else
+					{
+
+						if (!cellPriorLinksCounts.get_Element(tempPostCellIndex))
+						{
+
+							if (tempPostCellIndex > priorTempPostCellIndex)
+							{
+
+								*(cellPriorLinksCounts.get_ElementAddress(tempPostCellIndex)) = true;
+								priorTempPostCellIndex = tempPostCellIndex;
+
+								*(netPriorLinksCounts.get_ElementAddress(tempPostCellIndex)) += 1;
+
+							}
+
+							//the index is not in correct ascending list order
+							else
+								return 23;
+
+						}
+
+						//the index is duplicated in this postLinks list
+						else
+							return 24;
+
+					}
+
+					//check for required </postCellIndex> tag
+					if (!loadedContent.validateWordNode_MatchesWord(postCellIndexOutTag, wordIterationNode))
+						return 25;
+
+					//check for required <linkCoeff> tag
+					if (!loadedContent.validateWordNode_MatchesWord(linkCoeffInTag, wordIterationNode))
+						return 26;
+
+					//capture required <linkCoeff> double (any value)
+					if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, tempLinkCoeff))
+						return 27;
+
+					//check for required </linkCoeff> tag
+					if (!loadedContent.validateWordNode_MatchesWord(linkCoeffOutTag, wordIterationNode))
+						return 28;
+
+					//check for required </pl_#> tag
+					if (!loadedContent.validateWordNode_MatchesTerm(postLinkOutTag, wordIterationNode))
+						return 29;
+
+					//add the new link
+					postLinksList.add_NewNode(Link(tempPostCellIndex, tempLinkCoeff));
+
+				} while (postLinkInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+				//check for required </postLinks> tag
+				if (!loadedContent.validateWordNode_MatchesWord(postLinksOutTag, wordIterationNode))
+					return 30;
+
+				//check for required </c_#> tag
+				if (!loadedContent.validateWordNode_MatchesTerm(cellOutTag, wordIterationNode))
+					return 31;
+
+				//add the new cell to the temp list
+				tempCellsList.add_NewNode(Cell(internalCoeff, broadcastCoeff,
+					decayRate, refractoryPeriod, postLinksList));
+				cellCount++;
+
+			} while (cellInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+			//ensure that the correct number of cells has been created
+			if (cellCount != totalCellCount)
+				return 32;
+
+			//check for required </cells> tag
+			if (!loadedContent.validateWordNode_MatchesWord(cellsOutTag, wordIterationNode))
+				return 33;
+
+			//check for required </ng_#> tag
+			if (!loadedContent.validateWordNode_MatchesTerm(netGroupOutTag, wordIterationNode))
+				return 34;
+
+			//add the new net(s) to tempNetsList
+			netNode = tempNetsList.add_NewRange(groupLength, NULL, true, false);
+
+			do
+			{
+
+				netNode->content = Net(tempCellsList, netPriorLinksCounts, inputCellCount, totalCellCount);
+
+				netNode = netNode->get_NextNode();
+
+			} while (netNode);
+
+			//reset the temp tracking variables
+			tempCellsList.delete_WholeList();
+
+			//reset the netPriorLinksCounts list
+			for (cellCount = 0; cellCount < totalCellCount; cellCount++)
+				*(netPriorLinksCounts.get_ElementAddress(cellCount)) = 0;
+
+		} while (netGroupInTag.testWord_MatchesTerm(wordIterationNode->content));
+
+		//ensure that the correct number of nets is represented
+		if (tempNetsList.get_ListLength() != totalNetCount)
+			return 35;
+
+		//check for required </netGroups> tag
+		if (!loadedContent.validateWordNode_MatchesWord(netGroupsOutTag, wordIterationNode))
+			return 36;
+
+		//check for final required </Population> tag
+		if (!loadedContent.validateWordNode_MatchesWord(populationOutTag, wordIterationNode, false, false))
+			return 37;
+
+		//this section of the file is valid
+		nets = tempNetsList;
+		reset_NetRanks();
+
+		//totalNetCount and nets have been initialized
 		return 0;
 
 	}
 
-	inline bool sub_Initialize_InterpretReturn_NumericalPropertiesValidation(
+	inline bool sub_Initialize_InterpretReturn_NetsAndTerminalValidation(
 		const unsigned char fileValidationReturnCode)
 	{
 
@@ -1907,72 +5206,92 @@ private:
 		if (fileValidationReturnCode == 0)
 		{
 
-			cout << "leading and numerical properties file sections are valid";
+			cout << "nets file section is valid";
 			return true;
 
 		}
-			
+
 		else
 		{
 
-			if (fileValidationReturnCode == 1)
-				cout << "missing XML header or incomplete file";
-			else if (fileValidationReturnCode == 2)
-				cout << "missing <Population> tag or incomplete file";
+			if (fileValidationReturnCode == 2)
+				cout << "missing <netGroups> tag or incomplete file";
 			else if (fileValidationReturnCode == 3)
-				cout << "missing <totalNetCount> tag or incomplete file";
+				cout << "missing <ng_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 38)
+				cout << "missing <groupLength> tag or incomplete file";
+			else if (fileValidationReturnCode == 39)
+				cout << "invalid <groupLength> value or incomplete file";
+			else if (fileValidationReturnCode == 40)
+				cout << "missing </groupLength> tag or incomplete file";
 			else if (fileValidationReturnCode == 4)
-				cout << "invalid <totalNetCount> value or incomplete file";
+				cout << "missing <cells> tag or incomplete file";
 			else if (fileValidationReturnCode == 5)
-				cout << "missing </totalNetCount> tag or incomplete file";
+				cout << "missing <c_#> tag or incomplete file";
 			else if (fileValidationReturnCode == 6)
-				cout << "missing <inputCellCount> tag or incomplete file";
+				cout << "missing <internalCoeff> tag or incomplete file";
 			else if (fileValidationReturnCode == 7)
-				cout << "invalid <inputCellCount> value or incomplete file";
+				cout << "invalid <internalCoeff> value or incomplete file";
 			else if (fileValidationReturnCode == 8)
-				cout << "missing </inputCellCount> tag or incomplete file";
+				cout << "missing </internalCoeff> tag or incomplete file";
 			else if (fileValidationReturnCode == 9)
-				cout << "missing <outputCellCount> tag or incomplete file";
+				cout << "missing <broadcastCoeff> tag or incomplete file";
 			else if (fileValidationReturnCode == 10)
-				cout << "invalid <outputCellCount> value or incomplete file";
+				cout << "invalid <broadcastCoeff> value or incomplete file";
 			else if (fileValidationReturnCode == 11)
-				cout << "missing </outputCellCount> tag or incomplete file";
+				cout << "missing </broadcastCoeff> tag or incomplete file";
 			else if (fileValidationReturnCode == 12)
-				cout << "missing <totalCellCount> tag or incomplete file";
+				cout << "missing <decayRate> tag or incomplete file";
 			else if (fileValidationReturnCode == 13)
-				cout << "invalid <totalCellCount> value or incomplete file";
+				cout << "invalid <decayRate> value or incomplete file";
 			else if (fileValidationReturnCode == 14)
-				cout << "missing </totalCellCount> tag or incomplete file";
+				cout << "missing </decayRate> tag or incomplete file";
 			else if (fileValidationReturnCode == 15)
-				cout << "missing <maxRoundsPerStimulate> tag or incomplete file";
+				cout << "missing <refractoryPeriod> tag or incomplete file";
 			else if (fileValidationReturnCode == 16)
-				cout << "invalid <maxRoundsPerStimulate> value or incomplete file";
+				cout << "invalid <refractoryPeriod> value or incomplete file";
 			else if (fileValidationReturnCode == 17)
-				cout << "missing </maxRoundsPerStimulate> tag or incomplete file";
+				cout << "missing </refractoryPeriod> tag or incomplete file";
 			else if (fileValidationReturnCode == 18)
-				cout << "missing <dataSetColumnCount> tag or incomplete file";
+				cout << "missing <postLinks> tag or incomplete file";
 			else if (fileValidationReturnCode == 19)
-				cout << "invalid <dataSetColumnCount> value or incomplete file";
+				cout << "missing <pl_#> tag or incomplete file";
 			else if (fileValidationReturnCode == 20)
-				cout << "missing </dataSetColumnCount> tag or incomplete file";
+				cout << "missing <postCellIndex> tag or incomplete file";
 			else if (fileValidationReturnCode == 21)
-				cout << "missing <dataSetRowCount> tag or incomplete file";
+				cout << "invalid <postCellIndex> value or incomplete file";
 			else if (fileValidationReturnCode == 22)
-				cout << "invalid <dataSetRowCount> value or incomplete file";
+				cout << "invalid <postCellIndex> value (value == cell index)";
 			else if (fileValidationReturnCode == 23)
-				cout << "missing </dataSetRowCount> tag or incomplete file";
+				cout << "<postCellIndex> value is not in correct ascending list order";
 			else if (fileValidationReturnCode == 24)
-				cout << "missing <totalDataFrameCount> tag or incomplete file";
+				cout << "duplicate <postCellIndex> found";
 			else if (fileValidationReturnCode == 25)
-				cout << "invalid <totalDataFrameCount> value or incomplete file";
+				cout << "missing </postCellIndex> tag or incomplete file";
 			else if (fileValidationReturnCode == 26)
-				cout << "missing </totalDataFrameCount> tag or incomplete file";
+				cout << "missing <linkCoeff> tag or incomplete file";
 			else if (fileValidationReturnCode == 27)
-				cout << "missing <calculatedInputsCount> tag or incomplete file";
+				cout << "invalid <linkCoeff> value or incomplete file";
 			else if (fileValidationReturnCode == 28)
-				cout << "invalid <calculatedInputsCount> value or incomplete file";
+				cout << "missing </linkCoeff> tag or incomplete file";
 			else if (fileValidationReturnCode == 29)
-				cout << "missing </calculatedInputsCount> tag or incomplete file";
+				cout << "missing </pl_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 30)
+				cout << "missing </postLinks> tag or incomplete file";
+			else if (fileValidationReturnCode == 31)
+				cout << "missing </c_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 32)
+				cout << "discrepant totalCellCount and counted cells";
+			else if (fileValidationReturnCode == 33)
+				cout << "missing </cells> tag or incomplete file";
+			else if (fileValidationReturnCode == 34)
+				cout << "missing </ng_#> tag or incomplete file";
+			else if (fileValidationReturnCode == 35)
+				cout << "discrepant totalNetsCount and counted nets";
+			else if (fileValidationReturnCode == 36)
+				cout << "missing </netGroups> tag or incomplete file";
+			else if (fileValidationReturnCode == 37)
+				cout << "missing terminal </Population> tag";
 
 			//reverse any possible partial initialization
 
@@ -1987,2430 +5306,1893 @@ private:
 			totalDataFrameCount = 1;
 			calculatedInputsCount = 0;
 
-			return false;
-
-		}
-
-	}
-
-	/*
-	checks the fixedInputs and calculatedInputs sections of loadedContent to
-	ensure they match the xml format described below (w/out whitespace);
-	initializes fixedInputs, calculatedInputs, and calculatedInputsPrepValues;
-	returns 0 if the file section is valid, otherwise returns an error code for console reporting;
-	<fixedInputs>												//required
-		<name>...</name>										//required (alphanumeric Word)
-		<columns>												//required
-			<c_0>												//required (tag matches any <c_#>)
-				<name>...</name>								//required (alphanumeric Word)
-				<frameLength>...</frameLength>					//required (unsigned short >= 1)
-				<shiftLength>...</shiftLength>					//required (any unsigned short)
-			</c_0>												//required (tag matches any </c_#>)
-			<c_1>												//optional
-				...
-			</c_1>
-			...
-		</columns>												//required
-		<rows>													//required
-			<r_0>												//required
-				<name>...</name>								//required (alphanumeric Word)
-				<dataSets>										//required
-					<ds_0>										//required (tag matches any <ds_#>)
-						<dataPoints>							//required
-							<dp_0>...</dp_0>					//required (any double)
-							<dp_1>...</dp_1>					//optional
-							...
-						</dataPoints>							//required
-					</ds_0>										//required (tag matches any </ds_#>)
-					<ds_1>										//optional
-						...
-					</ds_1>
-					...
-				</dataSets>										//required
-			</r_0>
-			<r_1>												//optional
-				...
-			</r_1>
-			...
-		</rows>
-	</fixedInputs>
-	<calculatedInputs>											//required
-		<ci_0>													//optional (tag matches any <ci_#>)
-			<name>...</name>									//required (alphanumeric Word)
-			<defaultValue>...</defaultValue>					//required (any double)
-		</ci_0>													//required (tag matches any </ci_#>)
-		<ci_1>													//optional
-			...
-		</ci_0>
-		...
-	</calculatedInputs>											//required
-	*/
-	inline unsigned char sub_Initialize_Validate_Inputs(
-		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
-	{
-
-		//variables for fixedInputs section validation
-		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
-
-		Word fixedInputsInTag("<fixedInputs>");
-		Word fixedInputsOutTag("</fixedInputs>");
-		Word nameInTag("<name>");
-		Word nameOutTag("</name>");
-		Word columnsInTag("<columns>");
-		Word columnsOutTag("</columns>");
-
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord columnInTag(tempConstructCodes);
-
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord columnOutTag(tempConstructCodes);
-
-		Word frameLengthInTag("<frameLength>");
-		Word frameLengthOutTag("</frameLength>");
-		Word shiftLengthInTag("<shiftLength>");
-		Word shiftLengthOutTag("</shiftLength>");
-		Word rowsInTag("<rows>");
-		Word rowsOutTag("</rows>");
-
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('r'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord rowInTag(tempConstructCodes);
-
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('r'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord rowOutTag(tempConstructCodes);
-
-		Word dataSetsInTag("<dataSets>");
-		Word dataSetsOutTag("</dataSets>");
-
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('s'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord dataSetInTag(tempConstructCodes);
-
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('s'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord dataSetOutTag(tempConstructCodes);
-
-		Word dataPointsInTag("<dataPoints>");
-		Word dataPointsOutTag("</dataPoints>");
-
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord dataPointInTag(tempConstructCodes);
-
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('d'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord dataPointOutTag(tempConstructCodes);
-
-		//temp storage variables
-		Word fixedInputsName;
-		Word tempName;
-		unsigned short tempFrameLength;
-		unsigned short tempShiftLength;
-		UniformList<DataSetColumn> tempDataSetColumns;
-		UniformNode<DataSetColumn> *tempColumnNode;
-		
-		UniformList<double> tempDataPointsList;
-		UniformNode<double> *tempDataPointNode;
-		unsigned long long tempDataPointsListLength;
-
-		UniformList<DataSet> tempDataSets;
-		UniformList<DataSetRow> tempDataSetRows;
-
-		unsigned short tempInputCellCount = 0;
+			//fixedInputs and calculatedInputs null states
+			fixedInputs = DataSetCollection();
+			calculatedInputs.resize_NoCopy(0);
 
-		//main body of validation logic
+			//outputs null state
+			outputs.resize_NoCopy(1);
 
-		//check for required <fixedInputs> tag
-		if (!loadedContent.validateWordNode_MatchesWord(fixedInputsInTag, wordIterationNode))
-			return 1;
+			//variablesList, updatingFixedInputsVariables, evaluationCriteraExpressions
+			//and calculatedInputUpdateExpressions null states
+			variablesList.delete_WholeList();
+			updatingFixedInputsVariables.delete_WholeList();
+			evaluationCriteriaExpressions.resize_NoCopy(1);
+			calculatedInputUpdateExpressions.resize_NoCopy(0);
+			lossAccumulatorCount = 0;
 
-		//check for required <name> tag
-		if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
-			return 49;
+			//cellControls and trackers null states
+			cellControls.resize_NoCopy(3);
+			trackers.resize_NoCopy(3);
 
-		//capture required name alphanumeric word
-		if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, fixedInputsName))
-			return 50;
+			//nets null state
+			nets.resize_NoCopy(2);
+			reset_NetRanks();
 
-		//check for required </name> tag
-		if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
-			return 51;
+			return false;
 
-		//check for required <columns> tag
-		if (!loadedContent.validateWordNode_MatchesWord(columnsInTag, wordIterationNode))
-			return 2;
+		}
 
-		//columns validation loop
-		do
-		{
+	}
 
-			//check for required <c_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(columnInTag, wordIterationNode))
-				return 3;
+	//parses streamedRow, a data set row written on one line as its name, then the data
+	//points of each data set separated by ',', then its evaluation criteria expression,
+	//with ';' between each part (e.g. "r_0601;0.5,0.25,0.1;1.5,2.5;o_0*o_0"), into newRow
+	//and newCriteria; returns a validation code: 0 means success, 1 the number of parts
+	//does not match dataSetColumnCount, 2 the name is not alphanumeric, 3 a data point is
+	//not a floating point value, 4 a data set does not fit its column, 5 the evaluation
+	//criteria expression is invalid
+	inline unsigned char sub_Stream_ParseRow(Word &streamedRow, DataSetRow &newRow,
+		Expression_Double &newCriteria)
+	{
 
-			//check for required <name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
-				return 4;
+		UniformList<Word> parts;
+		UniformNode<Word> *partNode(parts.add_NewNode());
+		UniformNode<char> *charNode(streamedRow.get_FirstNode());
+		UniformList<DataSet> dataSets;
+		UniformList<double> dataPoints;
+		Word dataPoint;
+		unsigned short dataSetColumnIndex;
+		unsigned short frameLength;
+		unsigned long long dataPointsLength;
 
-			//capture required name alphanumeric word
-			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
-				return 5;
+		//split the row into its parts
+		while (charNode)
+		{
 
-			//check for required </name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
-				return 6;
+			if (charNode->content == ';')
+				partNode = parts.add_NewNode();
 
-			//check for required <frameLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(frameLengthInTag, wordIterationNode))
-				return 7;
+			else
+				partNode->content.add_NewNode(charNode->content);
 
-			//capture required frameLength unsigned short (>= 1)
-			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempFrameLength, 1))
-				return 8;
+			charNode = charNode->get_NextNode();
 
-			//check for required </frameLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(frameLengthOutTag, wordIterationNode))
-				return 9;
+		}
 
-			//update the value of tempInputCellCount for later validation against inputCellCount
-			tempInputCellCount += tempFrameLength;
+		if (parts.get_ListLength() != static_cast<unsigned long long>(dataSetColumnCount) + 2)
+			return 1;
 
-			//check for required <shiftLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(shiftLengthInTag, wordIterationNode))
-				return 10;
+		partNode = parts.get_FirstNode();
 
-			//capture required shiftLength unsigned short
-			if (!loadedContent.validateWordNode_UnsignedInt_Unlimited(wordIterationNode, tempShiftLength))
-				return 11;
+		if (!partNode->content.test_ListPopulated() || !partNode->content.validate_AlphanumericVariable())
+			return 2;
 
-			//check for required </shiftLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(shiftLengthOutTag, wordIterationNode))
-				return 12;
+		//data sets
+		for (dataSetColumnIndex = 0; dataSetColumnIndex < dataSetColumnCount; dataSetColumnIndex++)
+		{
 
-			//check for required associated </c_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(columnOutTag, wordIterationNode))
-				return 13;
+			partNode = partNode->get_NextNode();
+			charNode = partNode->content.get_FirstNode();
 
-			tempDataSetColumns.add_NewNode(DataSetColumn(tempName,
-				tempFrameLength, tempShiftLength));
+			do
+			{
 
-		} while (columnInTag.testWord_MatchesTerm(wordIterationNode->content));
+				if (!charNode || charNode->content == ',')
+				{
 
-		//check for required </columns> tag
-		if (!loadedContent.validateWordNode_MatchesWord(columnsOutTag, wordIterationNode))
-			return 52;
+					if (!dataPoint.test_ListPopulated() || !dataPoint.validate_FloatingPoint())
+						return 3;
 
-		if (tempDataSetColumns.get_ListLength() != dataSetColumnCount)
-			return 14;
+					dataPoints.add_NewNode(dataPoint.interpret_Double());
+					dataPoint.delete_WholeList();
 
-		//check for required <rows> tag
-		if (!loadedContent.validateWordNode_MatchesWord(rowsInTag, wordIterationNode))
-			return 15;
+				}
 
-		//row validation loop
-		do
-		{
+				else
+					dataPoint.add_NewNode(charNode->content);
 
-			//check for required <r_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(rowInTag, wordIterationNode))
-				return 16;
+				if (charNode)
+					charNode = charNode->get_NextNode();
 
-			//check for required <name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
-				return 17;
+				else
+					break;
 
-			//capture required name alphanumeric Word
-			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
-				return 18;
+			} while (true);
 
-			//check for required </name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
-				return 19;
+			//the same structure checks as population initialization
+			frameLength = fixedInputs.get_ColumnFrameLength(dataSetColumnIndex);
+			dataPointsLength = dataPoints.get_ListLength();
 
-			//check for required <dataSets> tag
-			if (!loadedContent.validateWordNode_MatchesWord(dataSetsInTag, wordIterationNode))
-				return 20;
+			if (dataPointsLength < (totalDataFrameCount * fixedInputs.get_ColumnShiftLength(dataSetColumnIndex)) + frameLength
+				|| (dataPointsLength == frameLength && totalDataFrameCount != 1))
+				return 4;
 
-			tempColumnNode = tempDataSetColumns.get_FirstNode();
+			dataSets.add_NewNode(DataSet(dataPoints));
+			dataPoints.delete_WholeList();
 
-			//data set validation loop
-			do
-			{
+		}
 
-				//test whether there are more data sets in this row
-				//than there should be based on the number of columns
-				if (!tempColumnNode)
-					return 30;
+		//evaluation criteria expression
+		partNode = partNode->get_NextNode();
 
-				//check for required <ds_#> tag
-				if (!loadedContent.validateWordNode_MatchesTerm(dataSetInTag, wordIterationNode))
-					return 21;
+		if (!partNode->content.test_ListPopulated() || !newCriteria.initialize(partNode->content, variablesList))
+			return 5;
 
-				//check for required <dataPoints> tag
-				if (!loadedContent.validateWordNode_MatchesWord(dataPointsInTag, wordIterationNode))
-					return 22;
+		newRow = DataSetRow(parts.get_FirstNode()->content, dataSets);
 
-				//tempDataPoints population loop
-				do
-				{
+		return 0;
 
-					//check for required <dp_#> tag
-					if (!loadedContent.validateWordNode_MatchesTerm(dataPointInTag, wordIterationNode))
-						return 23;
+	}
 
-					//capture required dp_# value
-					tempDataPointNode = tempDataPointsList.add_NewNode();
-					if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(
-						wordIterationNode, tempDataPointNode->content))
-						return 24;
+	//takes in up to rowsPerCycle complete rows from rowStream (see sub_Stream_ParseRow()),
+	//each replacing the oldest data set row; the replaced row's recorded fitness
+	//contributions and traced frames are discarded from every net; invalid rows are
+	//reported and skipped; stops early at the end of rowStream, clearing its state so a file
+	//still being written is read again next cycle (a partial last line is kept until its
+	//'\n' arrives); returns the number of rows replaced
+	inline unsigned short sub_Stream_TakeInRows()
+	{
 
-					//check for required </dp_#> tag
-					if (!loadedContent.validateWordNode_MatchesTerm(dataPointOutTag, wordIterationNode))
-						return 25;
+		unsigned short replacedRowCount(0);
+		unsigned short count;
+		unsigned char rowValidationReturnCode;
+		char nextChar;
 
-				} while (dataPointInTag.testWord_MatchesTerm(wordIterationNode->content));
+		while (replacedRowCount < rowsPerCycle)
+		{
 
-				//check for required </dataPoints> tag
-				if (!loadedContent.validateWordNode_MatchesWord(dataPointsOutTag, wordIterationNode))
-					return 26;
+			nextChar = rowStream->get();
 
-				//check for required associated </ds_#> tag
-				if (!loadedContent.validateWordNode_MatchesTerm(dataSetOutTag, wordIterationNode))
-					return 27;
+			if (!rowStream->good())
+			{
 
-				//verify that the structure of data set is valid in context of it's corresponding row
-				tempFrameLength = tempColumnNode->content.get_FrameLength();
-				tempShiftLength = tempColumnNode->content.get_ShiftLength();
-				tempDataPointsListLength = tempDataPointsList.get_ListLength();
+				rowStream->clear();
+				break;
 
-				if (tempDataPointsListLength < (totalDataFrameCount * tempShiftLength) + tempFrameLength)
-					return 28;
+			}
 
-				else if (tempDataPointsListLength == tempFrameLength && totalDataFrameCount != 1)
-					return 29;
+			//whitespace is not significant in a streamed row
+			if (nextChar == ' ' || nextChar == '\t' || nextChar == '\r')
+				continue;
 
-				//add the current data set to tempDataSets and reset
-				//tempDataPointsList to prep for the next possible data set
-				tempDataSets.add_NewNode(DataSet(tempDataPointsList));
-				tempDataPointsList.delete_WholeList();
+			if (nextChar != '\n')
+			{
 
-				//iterate to the next column
-				tempColumnNode = tempColumnNode->get_NextNode();
+				pendingStreamedRow.add_NewNode(nextChar);
+				continue;
 
-			} while (dataSetInTag.testWord_MatchesTerm(wordIterationNode->content));
+			}
 
-			//ensure there are not fewer data sets in this row than there are columns
-			if (tempDataSets.get_ListLength() != dataSetColumnCount)
-				return 31;
+			if (!pendingStreamedRow.test_ListPopulated())
+				continue;
 
-			//check for required </dataSets> tag
-			if (!loadedContent.validateWordNode_MatchesWord(dataSetsOutTag, wordIterationNode))
-				return 32;
+			DataSetRow newRow;
+			Expression_Double newCriteria;
 
-			//check for required associated </r_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(rowOutTag, wordIterationNode))
-				return 33;
+			rowValidationReturnCode = sub_Stream_ParseRow(pendingStreamedRow, newRow, newCriteria);
+			pendingStreamedRow.delete_WholeList();
 
-			//add the current row to tempDataSetRows and reset
-			//tempDataSets to prep for the next possible row
-			tempDataSetRows.add_NewNode(DataSetRow(tempName, tempDataSets));
-			tempDataSets.delete_WholeList();
+			if (rowValidationReturnCode == 1)
+				cout << "\nstreamed row skipped; it must have a name, " << dataSetColumnCount << " data sets and a criteria expression";
 
-		} while (rowInTag.testWord_MatchesTerm(wordIterationNode->content));
+			else if (rowValidationReturnCode == 2)
+				cout << "\nstreamed row skipped; invalid name";
 
-		//check for required </rows> tag
-		if (!loadedContent.validateWordNode_MatchesWord(rowsOutTag, wordIterationNode))
-			return 34;
+			else if (rowValidationReturnCode == 3)
+				cout << "\nstreamed row skipped; invalid data point";
 
-		//ensure there are the correct number of rows
-		if (tempDataSetRows.get_ListLength() != dataSetRowCount)
-			return 35;
+			else if (rowValidationReturnCode == 4)
+				cout << "\nstreamed row skipped; a data set is too short for its column's frames";
 
-		//check for required </fixedInputs> tag
-		if (!loadedContent.validateWordNode_MatchesWord(fixedInputsOutTag, wordIterationNode))
-			return 36;
+			else if (rowValidationReturnCode == 5)
+				cout << "\nstreamed row skipped; invalid evaluation criteria expression";
 
-		//the fixedInputs section of the file is valid
-		fixedInputs = DataSetCollection(fixedInputsName, tempDataSetRows, tempDataSetColumns);
+			if (rowValidationReturnCode)
+				continue;
 
-		//calculated input validation section
+			fixedInputs.replace_Row(oldestRowIndex, newRow);
+			*(evaluationCriteriaExpressions.get_ElementAddress(oldestRowIndex)) = newCriteria;
+			*(dataOnlyValuesComputed.get_ElementAddress(oldestRowIndex)) = false;
 
-		//novel variables for calculated input validation
-		Word calculatedInputsInTag("<calculatedInputs>");
-		Word calculatedInputsOutTag("</calculatedInputs>");
+			for (count = 0; count < totalNetCount; count++)
+			{
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord calculatedInputInTag(tempConstructCodes);
+				nets.get_ElementAddress(count)->clear_RecordedRowFitness(oldestRowIndex);
+				nets.get_ElementAddress(count)->clear_TracedFrames(oldestRowIndex * totalDataFrameCount,
+					totalDataFrameCount);
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord calculatedInputOutTag(tempConstructCodes);
+			}
 
-		Word defaultValueInTag("<defaultValue>");
-		Word defaultValueOutTag("</defaultValue>");
+			oldestRowIndex = (oldestRowIndex + 1) % dataSetRowCount;
+			replacedRowCount++;
 
-		//novel temp storage variables for calculated input validation
-		double tempDefaultValue;
-		UniformList<Input_Calculated> tempCalculatedInputsList;
+		}
 
-		//check for required <calculatedInputs> tag
-		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsInTag, wordIterationNode))
-			return 37;
+		//a new criteria expression may utilize further fixed input variables
+		if (replacedRowCount)
+			populate_UpdatingFixedInputsVariables();
 
-		//calculated input object construction loop
-		while (calculatedInputInTag.testWord_MatchesTerm(wordIterationNode->content))
-		{
+		return replacedRowCount;
 
-			//check for required <ci_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputInTag, wordIterationNode))
-				return 38;
+	}
 
-			//check for required <name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
-				return 39;
+	//returns a hash identifying data set row dataSetRowIndex by its name, its evaluation
+	//criteria expression and every data point its data frames read, so a row keeps its
+	//key when other rows are added to or removed from the data set
+	unsigned long long get_DataSetRowKey(const unsigned long long dataSetRowIndex)
+	{
 
-			//capture required name alphanumeric Word
-			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
-				return 40;
+		Genome rowContent;
+		UniformNode<char> *charNode(fixedInputs.get_RowName(dataSetRowIndex).get_FirstNode());
+		unsigned long long dataFrameIndex;
+		unsigned short dataSetColumnIndex;
+		unsigned short dataFrameSubIndex;
+		unsigned short dataSetFrameLength;
 
-			//check for required </name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
-				return 41;
+		while (charNode)
+		{
 
-			//check for required <defaultValue> tag
-			if (!loadedContent.validateWordNode_MatchesWord(defaultValueInTag, wordIterationNode))
-				return 42;
+			rowContent.append_Varint(static_cast<unsigned char>(charNode->content));
+			charNode = charNode->get_NextNode();
 
-			//capture required <defaultValue> value
-			if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, tempDefaultValue))
-				return 43;
+		}
 
-			//check for required </defaultValue> tag
-			if (!loadedContent.validateWordNode_MatchesWord(defaultValueOutTag, wordIterationNode))
-				return 44;
+		charNode = evaluationCriteriaExpressions.get_ElementAddress(dataSetRowIndex)->get_WrittenForm().get_FirstNode();
 
-			//check for required </ci_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputOutTag, wordIterationNode))
-				return 45;
+		while (charNode)
+		{
 
-			tempCalculatedInputsList.add_NewNode(Input_Calculated(tempDefaultValue, tempName));
+			rowContent.append_Varint(static_cast<unsigned char>(charNode->content));
+			charNode = charNode->get_NextNode();
 
 		}
 
-		//check for required </calculatedInputs> tag
-		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputsOutTag, wordIterationNode))
-			return 46;
+		for (dataSetColumnIndex = 0; dataSetColumnIndex < dataSetColumnCount; dataSetColumnIndex++)
+		{
 
-		if (tempCalculatedInputsList.get_ListLength() != calculatedInputsCount)
-			return 47;
+			dataSetFrameLength = fixedInputs.get_ColumnFrameLength(dataSetColumnIndex);
 
-		tempInputCellCount += calculatedInputsCount;
+			for (dataFrameIndex = 0; dataFrameIndex < totalDataFrameCount; dataFrameIndex++)
+			{
 
-		if (tempInputCellCount != inputCellCount)
-			return 48;
+				for (dataFrameSubIndex = 0; dataFrameSubIndex < dataSetFrameLength; dataFrameSubIndex++)
+					rowContent.append_Double(fixedInputs.get_FrameAdjustedDataPoint(dataSetRowIndex,
+						dataSetColumnIndex, dataFrameIndex, dataFrameSubIndex));
 
-		//the calculated inputs section of the file is valid
-		calculatedInputs = tempCalculatedInputsList;
+			}
 
-		//fixedInputs and calculatedInputs have been initialized
-		return 0;
+		}
 
-	}
+		return rowContent.get_Hash();
 
-	inline bool sub_Initialize_InterpretReturn_InputsValidation(
-		const unsigned char fileValidationReturnCode)
+	}
+
+	//returns a hash of the population properties which affect every row's evaluation
+	//(other than the nets); row fitness records are only valid while it is unchanged
+	unsigned long long get_RowEvaluationKey()
 	{
 
-		cout << "\n";
+		Genome evaluationContent;
+		UniformNode<char> *charNode;
+		unsigned short count;
 
-		if (fileValidationReturnCode == 0)
+		evaluationContent.append_Varint(maxRoundsPerStimulate);
+		evaluationContent.append_Varint(totalDataFrameCount);
+		evaluationContent.append_Varint(dataSetColumnCount);
+		evaluationContent.append_Varint(calculatedInputsCount);
+		evaluationContent.append_Varint(outputCellCount);
+
+		for (count = 0; count < outputCellCount; count++)
+			evaluationContent.append_Varint(outputs.get_ElementAddress(count)->get_MaxActivations());
+
+		//losses read by evaluation criteria (keys without loss accumulators are unchanged)
+		if (lossAccumulatorCount)
 		{
 
-			cout << "fixedInputs and calculatedInputs file sections are valid";
-			return true;
+			evaluationContent.append_Varint(lossAccumulatorCount);
+
+			for (count = 0; count < lossAccumulatorCount; count++)
+				lossAccumulators.get_ElementAddress(count)->append_ToKey(evaluationContent);
 
 		}
-			
-		else
+
+		for (count = 0; count < calculatedInputsCount; count++)
 		{
 
-			if (fileValidationReturnCode == 1)
-				cout << "missing <fixedInputs> tag or incomplete file";
-			else if (fileValidationReturnCode == 49)
-				cout << "missing fixedInputs <name> tag or incomplete file";
-			else if (fileValidationReturnCode == 50)
-				cout << "missing fixedInputs <name> value or incomplete file";
-			else if (fileValidationReturnCode == 51)
-				cout << "missing fixedInputs </name> tag or incomplete file";
-			else if (fileValidationReturnCode == 2)
-				cout << "missing <columns> tag or incomplete file";
-			else if (fileValidationReturnCode == 3)
-				cout << "missing <c_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 4)
-				cout << "missing column <name> tag or incomplete file";
-			else if (fileValidationReturnCode == 5)
-				cout << "missing column <name> value or incomplete file";
-			else if (fileValidationReturnCode == 6)
-				cout << "missing column </name> tag or incomplete file";
-			else if (fileValidationReturnCode == 7)
-				cout << "missing <frameLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 8)
-				cout << "invalid <frameLength> value or incomplete file";
-			else if (fileValidationReturnCode == 9)
-				cout << "missing </frameLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 10)
-				cout << "missing <shiftLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 11)
-				cout << "invalid <shiftLength> value or incomplete file";
-			else if (fileValidationReturnCode == 12)
-				cout << "missing </shiftLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 13)
-				cout << "missing </c_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 14)
-				cout << "discrepant dataSetColumnCount and counted data set columns";
-			else if (fileValidationReturnCode == 52)
-				cout << "missing </columns> tag or incomplete file";
-			else if (fileValidationReturnCode == 15)
-				cout << "missing <rows> tag or incomplete file";
-			else if (fileValidationReturnCode == 16)
-				cout << "missing <r_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 17)
-				cout << "missing row <name> tag or incomplete file";
-			else if (fileValidationReturnCode == 18)
-				cout << "missing row <name> value or incomplete file";
-			else if (fileValidationReturnCode == 19)
-				cout << "missing row </name> tag or incomplete file";
-			else if (fileValidationReturnCode == 20)
-				cout << "missing <dataSets> tag or incomplete file";
-			else if (fileValidationReturnCode == 21)
-				cout << "missing <ds_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 22)
-				cout << "missing <dataPoints> tag or incomplete file";
-			else if (fileValidationReturnCode == 23)
-				cout << "missing <dp_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 24)
-				cout << "invalid <dp_#> value or incomplete file";
-			else if (fileValidationReturnCode == 25)
-				cout << "missing </dp_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 26)
-				cout << "missing </dataPoints> tag or incomplete file";
-			else if (fileValidationReturnCode == 27)
-				cout << "missing </ds_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 28)
-				cout << "illegal structure: dataPoints listLength < (totalDataFrameCount * shiftLength) + frameLength";
-			else if (fileValidationReturnCode == 29)
-				cout << "illegal structure: totalDataFrameCount must = 1 when dataPoints listLength == frameLength ";
-			else if (fileValidationReturnCode == 30)
-				cout << "illegal structure: more DataSet objects contained in a row than there are columns";
-			else if (fileValidationReturnCode == 31)
-				cout << "illegal structure: fewer DataSet objects contained in a row than there are columns";
-			else if (fileValidationReturnCode == 32)
-				cout << "missing </dataSets> tag or incomplete file";
-			else if (fileValidationReturnCode == 33)
-				cout << "missing </r_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 34)
-				cout << "missing </rows> tag or incomplete file";
-			else if (fileValidationReturnCode == 35)
-				cout << "discrepant dataSetRowCount and counted rows";
-			else if (fileValidationReturnCode == 36)
-				cout << "missing </fixedInputs> tag or incomplete file";
-			else if (fileValidationReturnCode == 37)
-				cout << "missing <calculatedInputs> tag or incomplete file";
-			else if (fileValidationReturnCode == 38)
-				cout << "missing <ci_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 39)
-				cout << "missing calculated input <name> tag or incomplete file";
-			else if (fileValidationReturnCode == 40)
-				cout << "missing calculated input <name> value or incomplete file";
-			else if (fileValidationReturnCode == 41)
-				cout << "missing calculated input </name> tag or incomplete file";
-			else if (fileValidationReturnCode == 42)
-				cout << "missing <defaultValue> tag or incomplete file";
-			else if (fileValidationReturnCode == 43)
-				cout << "invalid <defaultValue> value or incomplete file";
-			else if (fileValidationReturnCode == 44)
-				cout << "missing </defaultValue> tag or incomplete file";
-			else if (fileValidationReturnCode == 45)
-				cout << "missing </ci_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 46)
-				cout << "missing </calculatedInputs> tag or incomplete file";
-			else if (fileValidationReturnCode == 47)
-				cout << "discrepant calculatedInputsCount and counted calculated inputs";
-			else if (fileValidationReturnCode == 48)
-				cout << "discrepant inputCellCount and calculated number of required input cells";
+			calculatedInputs.get_ElementAddress(count)->reset();
+			evaluationContent.append_Double(calculatedInputs.get_ElementAddress(count)->get_CurrentValue());
 
-			//reverse any possible partial initialization
+			charNode = calculatedInputUpdateExpressions.get_ElementAddress(count)->get_WrittenForm().get_FirstNode();
 
-			//numerical properties null states
-			totalNetCount = 2;
-			inputCellCount = 1;
-			outputCellCount = 1;
-			totalCellCount = 3;
-			maxRoundsPerStimulate = 1;
-			dataSetColumnCount = 1;
-			dataSetRowCount = 1;
-			totalDataFrameCount = 1;
-			calculatedInputsCount = 0;
+			while (charNode)
+			{
 
-			//fixedInputs and calculatedInputs null states
-			fixedInputs = DataSetCollection();
-			calculatedInputs.resize_NoCopy(0);
+				evaluationContent.append_Varint(static_cast<unsigned char>(charNode->content));
+				charNode = charNode->get_NextNode();
 
-			return false;
+			}
 
 		}
 
+		return evaluationContent.get_Hash();
+
 	}
 
-	/*
-	checks the outputs section of loadedContent to ensure it matches
-	the xml format described below (w/out whitespace);
-	initializes outputs and returns 0 if the file section is valid,
-	otherwise returns an error code for console reporting;
-	<outputs>											//required
-		<o_0>											//required (tag matches any <o_#>)
-			<name>...</name>							//required (alphanumeric Word)
-			<maxActivations>...</maxActivations>		//required (unsigned short >= 1)
-		</o_0>											//required (tag matches any </o_#>)
-		<o_1>											//optional
-			...
-		</o_1>
-		...
-	</outputs>											//required
-	*/
-	inline unsigned char sub_Initialize_Validate_Outputs(
-		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	//writes a checkpoint of the run (state, with elapsedSeconds used so far) to
+	//checkpointFileName; the checkpoint holds the random generator state, the
+	//evolution settings of this population, netRanks and every net (with its row
+	//fitness record, see set_RowFitnessRecording()), and is written
+	//to a temporary file which then replaces checkpointFileName, so an interrupted
+	//write never damages an earlier checkpoint; returns false if writing fails
+	bool output_Checkpoint(Word &checkpointFileName, EvolutionState &state, const double elapsedSeconds)
 	{
 
-		//novel variables for output validation
-		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
-		
-		Word outputsInTag("<outputs>");
-		Word outputsOutTag("</outputs>");
+		ofstream outputFile;
+		unsigned long long count;
+		const unsigned long long evolutionControlsLength(evolutionControls.get_ArrayLength());
 
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('o'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord outputInTag(tempConstructCodes);
+		if (!open_OutputFile_BinaryTemporary(outputFile, checkpointFileName))
+			return false;
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('o'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord outputOutTag(tempConstructCodes);
+		//identification and population shape
+		outputValue_ToOpenFile_Binary(checkpointFileTag, outputFile);
+		outputValue_ToOpenFile_Binary(checkpointFileVersion, outputFile);
+		outputValue_ToOpenFile_Binary(totalNetCount, outputFile);
+		outputValue_ToOpenFile_Binary(totalCellCount, outputFile);
+		outputValue_ToOpenFile_Binary(outputCellCount, outputFile);
+		outputValue_ToOpenFile_Binary(dataSetRowCount, outputFile);
+		outputValue_ToOpenFile_Binary(totalDataFrameCount, outputFile);
+
+		//run progress
+		outputValue_ToOpenFile_Binary(get_RandomGenerator().get_State(), outputFile);
+		state.output_ToOpenFile_Binary(outputFile, elapsedSeconds);
+
+		//evolution settings
+		outputValue_ToOpenFile_Binary(parentSelector.get_SelectionType(), outputFile);
+		outputValue_ToOpenFile_Binary(parentSelector.get_TournamentSize(), outputFile);
+		outputValue_ToOpenFile_Binary(incrementalEvaluation, outputFile);
+		outputValue_ToOpenFile_Binary(earlyAbort, outputFile);
+		outputValue_ToOpenFile_Binary(batchedCriteria, outputFile);
+		outputValue_ToOpenFile_Binary(rowFitnessRecording, outputFile);
+		outputValue_ToOpenFile_Binary(screening, outputFile);
+		screeningControl.output_ToOpenFile_Binary(outputFile);
+		outputValue_ToOpenFile_Binary(screeningTolerance, outputFile);
+		outputValue_ToOpenFile_Binary(screeningAuditInterval, outputFile);
+		outputValue_ToOpenFile_Binary(evolutionControlsLength, outputFile);
+
+		for (count = 0; count < evolutionControlsLength; count++)
+			evolutionControls.get_ElementAddress(count)->output_ToOpenFile_Binary(outputFile);
 
-		Word nameInTag("<name>");
-		Word nameOutTag("</name>");
-		Word maxActivationsInTag("<maxActivations>");
-		Word maxActivationsOutTag("</maxActivations>");
+		//nets
+		for (count = 0; count < totalNetCount; count++)
+			outputValue_ToOpenFile_Binary(netRanks.get_Element(count), outputFile);
 
-		//storage variables
-		Word tempName;
-		unsigned short tempMaxActivations;
-		UniformList<Output> tempOutputsList;
+		for (count = 0; count < totalNetCount; count++)
+		{
 
-		//check for required <outputs> tag
-		if (!loadedContent.validateWordNode_MatchesWord(outputsInTag, wordIterationNode))
-			return 2;
+			nets.get_ElementAddress(count)->output_ToOpenFile_Binary(outputFile);
+			nets.get_ElementAddress(count)->output_RowFitnessRecord_ToOpenFile_Binary(outputFile);
 
-		//output object construction loop
-		do
-		{
+		}
 
-			//check for required <o_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(outputInTag, wordIterationNode))
-				return 3;
+		if (!outputFile.good())
+			return false;
 
-			//check for required <name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameInTag, wordIterationNode))
-				return 4;
+		outputFile.close();
 
-			//capture required name alphanumeric Word
-			if (!loadedContent.validateWordNode_CaptureAlphaNumeric(wordIterationNode, tempName))
-				return 5;
+		return replace_File_FromTemporary(checkpointFileName);
 
-			//check for required </name> tag
-			if (!loadedContent.validateWordNode_MatchesWord(nameOutTag, wordIterationNode))
-				return 6;
+	}
 
-			//check for required <maxActivations> tag
-			if (!loadedContent.validateWordNode_MatchesWord(maxActivationsInTag, wordIterationNode))
-				return 7;
+	//reads the checkpoint in checkpointFileName (see output_Checkpoint()) into state and
+	//this population; nothing is changed unless the whole checkpoint is read and fits
+	//this population; returns a validation code: 0 means success, 1 the file does not
+	//open, 2 it is not a checkpoint of this version, 3 it was written by a population of
+	//another shape, 4 the run progress is invalid, 5 the evolution settings are invalid,
+	//6 netRanks is invalid, 7 a net is invalid
+	unsigned char load_Checkpoint(Word &checkpointFileName, EvolutionState &state)
+	{
 
-			//capture required maxActivations unsigned short (must be >= 1)
-			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempMaxActivations, 1))
-				return 8;
+		ifstream inputFile;
+		unsigned long long count;
+		unsigned int fileTag;
+		unsigned short fileVersion;
+		unsigned short fileTotalNetCount;
+		unsigned short fileTotalCellCount;
+		unsigned short fileOutputCellCount;
+		unsigned long long fileDataSetRowCount;
+		unsigned long long fileTotalDataFrameCount;
+		unsigned long long randomState;
+		unsigned char selectionType;
+		unsigned short tournamentSize;
+		bool fileIncrementalEvaluation;
+		bool fileEarlyAbort;
+		bool fileBatchedCriteria;
+		bool fileRowFitnessRecording;
+		bool fileScreening;
+		EvolutionControl fileScreeningControl;
+		double fileScreeningTolerance;
+		unsigned short fileScreeningAuditInterval;
+		unsigned long long evolutionControlsLength;
+		EvolutionControl evolutionControl;
+		UniformList<EvolutionControl> fileEvolutionControls;
+		ExtensibleArray<unsigned short> fileNetRanks(totalNetCount);
+		ExtensibleArray<bool> rankedSlots(totalNetCount);
+		ExtensibleArray<Net> fileNets(totalNetCount);
+
+		if (!open_InputFile_Binary(inputFile, checkpointFileName))
+			return 1;
 
-			//check for required </maxActivations> tag
-			if (!loadedContent.validateWordNode_MatchesWord(maxActivationsOutTag, wordIterationNode))
-				return 9;
+		//identification and population shape
+		if (!inputValue_FromOpenFile_Binary(fileTag, inputFile) || fileTag != checkpointFileTag
+			|| !inputValue_FromOpenFile_Binary(fileVersion, inputFile) || fileVersion != checkpointFileVersion)
+			return 2;
 
-			//check for required </o_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(outputOutTag, wordIterationNode))
-				return 10;
+		if (!inputValue_FromOpenFile_Binary(fileTotalNetCount, inputFile) || fileTotalNetCount != totalNetCount
+			|| !inputValue_FromOpenFile_Binary(fileTotalCellCount, inputFile) || fileTotalCellCount != totalCellCount
+			|| !inputValue_FromOpenFile_Binary(fileOutputCellCount, inputFile) || fileOutputCellCount != outputCellCount
+			|| !inputValue_FromOpenFile_Binary(fileDataSetRowCount, inputFile) || fileDataSetRowCount != dataSetRowCount
+			|| !inputValue_FromOpenFile_Binary(fileTotalDataFrameCount, inputFile) || fileTotalDataFrameCount != totalDataFrameCount)
+			return 3;
 
-			//add a node to tempOutputs
-			tempOutputsList.add_NewNode(Output(tempName, tempMaxActivations));
+		//run progress
+		if (!inputValue_FromOpenFile_Binary(randomState, inputFile)
+			|| !state.load_FromOpenFile_Binary(inputFile, totalNetCount))
+			return 4;
 
-		} while (outputInTag.testWord_MatchesTerm(wordIterationNode->content));
+		//evolution settings
+		if (!inputValue_FromOpenFile_Binary(selectionType, inputFile)
+			|| !inputValue_FromOpenFile_Binary(tournamentSize, inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileIncrementalEvaluation, inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileEarlyAbort, inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileBatchedCriteria, inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileRowFitnessRecording, inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileScreening, inputFile)
+			|| !fileScreeningControl.load_FromOpenFile_Binary(inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileScreeningTolerance, inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileScreeningAuditInterval, inputFile)
+			|| !inputValue_FromOpenFile_Binary(evolutionControlsLength, inputFile))
+			return 5;
 
-		//check for required </outputs> tag
-		if (!loadedContent.validateWordNode_MatchesWord(outputsOutTag, wordIterationNode))
-			return 11;
+		if (selectionType > 2 || (selectionType == 1 && tournamentSize < 2)
+			|| ((fileIncrementalEvaluation || fileRowFitnessRecording) && calculatedInputsReadOutputs)
+			|| fileScreeningTolerance < 0.0 || !evolutionControlsLength)
+			return 5;
 
-		//check for required length
-		if (tempOutputsList.get_ListLength() != outputCellCount)
-			return 12;
+		for (count = 0; fileScreening && count < fileScreeningControl.get_DataSetRowIndicesLength(); count++)
+		{
 
-		//this section of the file is valid
-		outputs = tempOutputsList;
+			if (fileScreeningControl.get_DataSetRowIndicesElement(count) >= dataSetRowCount)
+				return 5;
 
-		//outputs has been initialized
-		return 0;
+		}
 
-	}
+		for (count = 0; count < evolutionControlsLength; count++)
+		{
 
-	inline bool sub_Initialize_InterpretReturn_OutputsValidation(
-		const unsigned char fileValidationReturnCode)
-	{
+			if (!evolutionControl.load_FromOpenFile_Binary(inputFile))
+				return 5;
+
+			fileEvolutionControls.add_NewNode(evolutionControl);
+
+		}
 
-		cout << "\n";
+		//the schedule position must be within the schedule
+		if (state.evolutionControlIndex >= evolutionControlsLength || state.repetitionCount
+			>= fileEvolutionControls.get_NodeAddress(state.evolutionControlIndex)->content.get_TotalRepetitions())
+			return 5;
 
-		if (fileValidationReturnCode == 0)
+		//netRanks must be an ordering of every slot index
+		for (count = 0; count < totalNetCount; count++)
+			*(rankedSlots.get_ElementAddress(count)) = false;
+
+		for (count = 0; count < totalNetCount; count++)
 		{
 
-			cout << "outputs file section is valid";
-			return true;
+			if (!inputValue_FromOpenFile_Binary(*(fileNetRanks.get_ElementAddress(count)), inputFile)
+				|| fileNetRanks.get_Element(count) >= totalNetCount
+				|| rankedSlots.get_Element(fileNetRanks.get_Element(count)))
+				return 6;
+
+			*(rankedSlots.get_ElementAddress(fileNetRanks.get_Element(count))) = true;
 
 		}
 
-		else
+		for (count = 0; count < totalNetCount; count++)
 		{
 
-			if (fileValidationReturnCode == 2)
-				cout << "missing <outputs> tag or incomplete file";
-			else if (fileValidationReturnCode == 3)
-				cout << "missing <o_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 4)
-				cout << "missing <name> tag or incomplete file";
-			else if (fileValidationReturnCode == 5)
-				cout << "missing <name> value or incomplete file";
-			else if (fileValidationReturnCode == 6)
-				cout << "missing </name> tag or incomplete file";
-			else if (fileValidationReturnCode == 7)
-				cout << "missing <maxActivations> tag or incomplete file";
-			else if (fileValidationReturnCode == 8)
-				cout << "invalid <maxActivations> value or incomplete file";
-			else if (fileValidationReturnCode == 9)
-				cout << "missing </maxActivations> tag or incomplete file";
-			else if (fileValidationReturnCode == 10)
-				cout << "missing </o_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 11)
-				cout << "missing </outputs> tag or incomplete file";
-			else if (fileValidationReturnCode == 12)
-				cout << "discrepant outputCellCount and counted outputs";
+			if (!fileNets.get_ElementAddress(count)->load_FromOpenFile_Binary(inputFile, totalCellCount)
+				|| !fileNets.get_ElementAddress(count)->load_RowFitnessRecord_FromOpenFile_Binary(inputFile, dataSetRowCount))
+				return 7;
 
-			//reverse any possible partial initialization
+		}
 
-			//numerical properties null states
-			totalNetCount = 2;
-			inputCellCount = 1;
-			outputCellCount = 1;
-			totalCellCount = 3;
-			maxRoundsPerStimulate = 1;
-			dataSetColumnCount = 1;
-			dataSetRowCount = 1;
-			totalDataFrameCount = 1;
-			calculatedInputsCount = 0;
+		//every section has been read and validated, replace the population's run state
+		if (!set_EvolutionControls(fileEvolutionControls))
+			return 5;
 
-			//fixedInputs and calculatedInputs null states
-			fixedInputs = DataSetCollection();
-			calculatedInputs.resize_NoCopy(0);
+		set_ParentSelection(selectionType, tournamentSize);
+		incrementalEvaluation = fileIncrementalEvaluation;
+		earlyAbort = fileEarlyAbort;
+		batchedCriteria = fileBatchedCriteria;
+		rowFitnessRecording = fileRowFitnessRecording;
+		screening = fileScreening;
+		screeningControl = fileScreeningControl;
+		screeningTolerance = fileScreeningTolerance;
+		screeningAuditInterval = fileScreeningAuditInterval;
 
-			//outputs null state
-			outputs.resize_NoCopy(1);
+		netRanks = fileNetRanks;
+		nets = fileNets;
 
-			return false;
+		get_RandomGenerator().set_State(randomState);
 
-		}
+		return 0;
 
 	}
 
-	/*
-	checks the calculatedInputUpdateExpressions and evaluationCriteriaExpressions
-	sections of loadedContent to ensure they match the xml format described below
-	(w/out whitespace); first initializes variablesList with Variable_Doubles
-	corresponding to each fixed input column (first data frame of the first row initially),
-	calculated input, and output; next initializes calculatedInputUpdateBlueprints
-	and calculatedInputUpdateExpressions; returns 0 if the file section is valid,
-	otherwise returns an error code for console reporting;
-	<evaluationCriteriaExpressions>
-		<ece_0>...</ece_0>							//required (tags match any <ece_#> and </ece_#>, content is an alphanumeric matching the name of any calculated input or output represented in variablesList
-		...
-	</evaluationCriteriaExpressions>				//required
-	<calculatedInputUpdateExpressions>				//required
-		<ciue_0>...</ciue_0>						//optional (tags match any <ciue_#> and </ciue_#>, content is an alphanumeric or alphanumeric indexed matching the name of any fixed input, calculated input, or output represented in variablesList
-		...
-	</calculatedInputUpdateExpressions>				//required
-	*/
-	inline unsigned char sub_Initialize_Validate_Expressions(
-		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
+	//runs evolution cycles from state until a stop condition of runControl is met;
+	//reproduction is asexual if state's maxSpliceLength is 0, otherwise sexual with
+	//splices of at most maxSpliceLength cells; if state's adaptiveMutation is true, its
+	//mutationControl is adapted each cycle (see MutationControl), children being
+	//compared with their (better) parent only when consecutive cycles evaluate the same
+	//rows; if screening is enabled, each cycle's children are pre-screened on the probe
+	//rows before full evaluation (see set_Screening()); outputs one JSON object per cycle
+	//(and per screened-out child) to progressOutput, checkpoints the run as runControl
+	//requires (see resume_Evolve()) and records the results in runControl; the target
+	//and stagnation stop conditions are only tested on cycles whose evolution control
+	//evaluates every data set row (see test_CoversAllRows())
+	void sub_Evolve(RunControl &runControl, EvolutionState &state, ostream &progressOutput)
 	{
 
-		//partially initialize variablesList;
-		variablesList.delete_WholeList();
+		//used to facilitate updating calculatedInputs in parallel rather than in series
+		ExtensibleArray<double> calculatedInputsPrepValues(calculatedInputsCount);
+
+		//arrays used to store cell indices reach action potential in a given round
+		//within the stimulate() function (array length set to totalCellCount + 1
+		//because it is possible for every cell to be activated in a single stimulus
+		//round and one additional element is needed in that case to store the terminal
+		//boundary marker value of (-1)
+		ExtensibleArray<int> activationListRoundA(totalCellCount + 1);
+		ExtensibleArray<int> activationListRoundB(totalCellCount + 1);
 
+		//additional initial setup
+		unsigned short netIndex;
+		unsigned short motherIndex;
 		unsigned short count;
-		unsigned short frameLength;
-		unsigned short frameSubIndex;
-		Word columnName;
-		Word subFrameIndexWord;
-		UniformNode<char> *charNode;
-		Output *currentOutput;
-		Input_Calculated *currentCalculatedInput;
+		EvolutionControl *currentEvolutionControl;
+		unsigned short activeNetCount;
+		ExtensibleArray<double> survivorFitnessRatings(totalNetCount);
 
-		for (count = 0; count < calculatedInputsCount; count++)
-		{
+		//offspring screening setup
+		ExtensibleArray<bool> screenedOutNets(totalNetCount);
+		ExtensibleArray<double> childProbeFitnessRatings(totalNetCount);
+		double screeningThreshold(DBL_MAX);
+		unsigned short screenedOutCount;
 
-			currentCalculatedInput = calculatedInputs.get_ElementAddress(count);
+		//early abort setup
+		double abortFitnessRating;
 
-			variablesList.add_NewNode(Variable_Double(currentCalculatedInput->get_Name(),
-				currentCalculatedInput->get_WorkingValueAddress()));
+		//mutation adaptation setup
+		unsigned short successCount;
+		unsigned short trialCount;
+
+		for (count = 0; count < totalNetCount; count++)
+			*(screenedOutNets.get_ElementAddress(count)) = false;
+
+		//stop condition setup
+		const time_t startTime(time(NULL));
+		double elapsedSeconds;
+		unsigned short reseedNetCount;
+		unsigned char stopReason(0);
+
+		//checkpoint setup
+		unsigned int checkpointCycleCount(state.cycleCount);
+		double checkpointElapsedSeconds(state.priorElapsedSeconds);
+
+		//windowed evolution setup
+		unsigned short streamedRowCount(0);
+
+		//culling stays suspended once a negative criteria value has been found in the run
+		negativeCriteriaValue = state.negativeCriteriaValueFound;
+
+		//the cycles of runControl may already have been completed (see resume_Evolve())
+		if (state.cycleCount >= runControl.get_MaxCycles())
+		{
+
+			runControl.set_Results(state.cycleCount, 1);
+			return;
 
 		}
 
-		for (count = 0; count < outputCellCount; count++)
+		//evolution cycle loop
+		do
 		{
 
-			currentOutput = outputs.get_ElementAddress(count);
+			//windowed evolution, slide the window over newly streamed rows; fitnessRatings
+			//from before the window moved are not comparable with those after it, so the
+			//best fitnessRating, probe fitnessRatings and mutation adaptation start over
+			if (rowStream)
+			{
 
-			variablesList.add_NewNode(Variable_Double(currentOutput->get_Name(),
-				currentOutput->get_ValueAddress()));
+				streamedRowCount = sub_Stream_TakeInRows();
 
-		}
+				if (streamedRowCount)
+				{
 
-		//novel variables for calculatedInputUpdateExpressions population
-		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+					state.bestFitnessRating = DBL_MAX;
+					state.stagnantCycleCount = 0;
+					state.clear_ProbeFitnessRatings();
+					state.childEvolutionControlIndex = evolutionControls.get_ArrayLength();
 
-		Word evaluationCriteriaExpressionsInTag("<evaluationCriteriaExpressions>");
-		Word evaluationCriteriaExpressionsOutTag("</evaluationCriteriaExpressions>");
+				}
 
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord evaluationCriteriaExpressionInTag(tempConstructCodes);
+			}
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord evaluationCriteriaExpressionOutTag(tempConstructCodes);
+			//set up the evolution control for this cycle
+			currentEvolutionControl = evolutionControls.get_ElementAddress(state.evolutionControlIndex);
+			activeNetCount = get_ActiveNetCount(currentEvolutionControl);
 
-		Word calculatedInputUpdateExpressionsInTag("<calculatedInputUpdateExpressions>");
-		Word calculatedInputUpdateExpressionsOutTag("</calculatedInputUpdateExpressions>");
+			//pre-screen the last cycle's children on the probe rows
+			if (screening && state.childCount)
+				state.netRowEvaluations += screen_Children(activationListRoundA, activationListRoundB,
+					calculatedInputsPrepValues, state.childSlotIndices, state.childCount, state.survivorCount,
+					childProbeFitnessRatings, screeningThreshold, state.screenedOutChildTotal, screenedOutNets,
+					state.probeFitnessKeys, state.probeFitnessRatings);
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('u'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord calculatedInputUpdateExpressionInTag(tempConstructCodes);
+			//nets cannot survive beyond the survivalThreshold (see also
+			//stimulate_AllFrames_SingleEvolutionCycle())
+			abortFitnessRating = currentEvolutionControl->get_SurvivalThreshold();
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('i'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('u'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('e'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord calculatedInputUpdateExpressionOutTag(tempConstructCodes);
+			//run all stimulation and performance updates
+			if (screening)
+				state.netRowEvaluations += stimulate_AllFrames_SingleEvolutionCycle(activationListRoundA,
+					activationListRoundB, calculatedInputsPrepValues, currentEvolutionControl,
+					activeNetCount, &screenedOutNets, abortFitnessRating);
 
-		//storage variables
-		UniformList<Expression_Double> tempExpressions;
-		UniformNode<Expression_Double> *tempExpressionNode;
-		UniformNode<Variable_Double> *variableNode;
+			else
+				state.netRowEvaluations += stimulate_AllFrames_SingleEvolutionCycle(activationListRoundA,
+					activationListRoundB, calculatedInputsPrepValues, currentEvolutionControl,
+					activeNetCount, NULL, abortFitnessRating);
 
-		//main body of validation logic
+			//rank nets in order of fitness
+			sort_NetRanks(activeNetCount);
+			state.survivorCount = get_SurvivorCount(currentEvolutionControl, activeNetCount);
 
-		//check for required <evaluationCriteriaExpressions> tag
-		if (!loadedContent.validateWordNode_MatchesWord(evaluationCriteriaExpressionsInTag, wordIterationNode))
-			return 1;
+			state.cycleCount++;
 
-		//evaluationCriteriaExpressions initialization loop
-		while (evaluationCriteriaExpressionInTag.testWord_MatchesTerm(wordIterationNode->content))
-		{
+			//report the (first) negative criteria value, which suspended early abort culling
+			if (negativeCriteriaValue && !state.negativeCriteriaValueFound)
+			{
 
-			//check for required <ece_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(evaluationCriteriaExpressionInTag, wordIterationNode))
-				return 2;
+				state.negativeCriteriaValueFound = true;
 
-			tempExpressionNode = tempExpressions.add_NewNode();
+				progressOutput << "{\"cycle\":" << state.cycleCount;
+				progressOutput << ",\"earlyAbortSuspended\":true";
+				progressOutput << ",\"negativeCriteriaRow\":" << negativeCriteriaRowIndex << "}\n";
 
-			//check for valid expression using only variables contained in variablesList
-			if (!tempExpressionNode->content.initialize(wordIterationNode->content, variablesList))
-				return 3;
+			}
 
-			wordIterationNode = wordIterationNode->get_NextNode();
+			//log the children screened out of (or audited in) this cycle's full evaluation
+			if (screening && state.childCount)
+				screenedOutCount = output_ScreenedChildren(state.childSlotIndices, state.childCount,
+					childProbeFitnessRatings, screeningThreshold, screenedOutNets, state.cycleCount,
+					progressOutput);
 
-			if (!wordIterationNode)
-				return 4;
+			else
+				screenedOutCount = 0;
 
-			//check for required </ece_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(evaluationCriteriaExpressionOutTag, wordIterationNode))
-				return 5;
+			elapsedSeconds = state.priorElapsedSeconds + difftime(time(NULL), startTime);
 
-		}
+			//track improvement of the best fitnessRating (over every data set row)
+			if (fullCoverageControls.get_Element(state.evolutionControlIndex))
+			{
 
-		//check for required </evaluationCriteriaExpressions> tag
-		if (!loadedContent.validateWordNode_MatchesWord(evaluationCriteriaExpressionsOutTag, wordIterationNode))
-			return 6;
+				if (get_RankedNet(0)->get_FitnessRating() < state.bestFitnessRating)
+				{
 
-		//check whether the correct number of evaluation criteria expressions are represented
-		if (tempExpressions.get_ListLength() != dataSetRowCount)
-			return 7;
+					state.bestFitnessRating = get_RankedNet(0)->get_FitnessRating();
+					state.stagnantCycleCount = 0;
 
-		//this sections of the file is valid, initialize calculatedInputUpdateExpressions
-		evaluationCriteriaExpressions = tempExpressions;
+				}
 
-		tempExpressions.delete_WholeList();
+				else
+					state.stagnantCycleCount++;
 
-		//complete initialization of variables list
-		for (count = 0; count < dataSetColumnCount; count++)
-		{
+			}
 
-			frameLength = fixedInputs.get_ColumnFrameLength(count);
-			columnName = fixedInputs.get_ColumnName(count);
+			//test stop conditions (the population is left ranked and unreproduced)
+			if (fullCoverageControls.get_Element(state.evolutionControlIndex)
+				&& runControl.test_TargetReached(get_RankedNet(0)->get_FitnessRating()))
+				stopReason = 2;
+
+			else if (runControl.get_MaxSeconds() > 0.0 && elapsedSeconds >= runControl.get_MaxSeconds())
+				stopReason = 3;
+
+			else if (runControl.get_MaxNetRowEvaluations() && state.netRowEvaluations >= runControl.get_MaxNetRowEvaluations())
+				stopReason = 4;
+
+			else if (runControl.get_StagnationCycles() && state.stagnantCycleCount >= runControl.get_StagnationCycles()
+				&& state.restartCount == runControl.get_MaxRestarts())
+				stopReason = 5;
+
+			else if (state.cycleCount >= runControl.get_MaxCycles())
+				stopReason = 1;
+
+			//structured progress
+			progressOutput << "{\"cycle\":" << state.cycleCount;
+			progressOutput << ",\"evolutionControl\":" << state.evolutionControlIndex;
+			progressOutput << ",\"activeNets\":" << activeNetCount;
+			progressOutput << ",\"survivors\":" << state.survivorCount;
+			progressOutput << ",\"topFitnessRating\":";
+			outputDouble_JSON(get_RankedNet(0)->get_FitnessRating(), progressOutput);
+			progressOutput << ",\"bestFitnessRating\":";
+			outputDouble_JSON(state.bestFitnessRating, progressOutput);
+			progressOutput << ",\"netRowEvaluations\":" << state.netRowEvaluations;
+			progressOutput << ",\"elapsedSeconds\":" << elapsedSeconds;
+			progressOutput << ",\"mutationsPerNet\":" << state.mutationControl.get_MutationsPerNet();
+			progressOutput << ",\"mutationAmplitude\":";
+			outputDouble_JSON(state.mutationControl.get_MutationAmplitude(), progressOutput);
+			progressOutput << ",\"screenedOut\":" << screenedOutCount;
+			progressOutput << ",\"streamedRows\":" << streamedRowCount;
+			progressOutput << ",\"restarts\":" << state.restartCount << "}\n";
+
+			if (stopReason)
+				break;
 
-			for (frameSubIndex = 0; frameSubIndex < frameLength; frameSubIndex++)
+			prepare_ParentSelector(state.survivorCount, survivorFitnessRatings);
+
+			//adapt mutation to the success rate of the last cycle's children
+			if (state.adaptiveMutation && state.childEvolutionControlIndex == state.evolutionControlIndex)
 			{
 
-				//set up subFrameIndexWord to correspond to this subframe index
-				//in the format "[#]" then add subFrameIndexWord to the end of
-				//columnName and create a new Variable_Double corresponding to the combined word
-				subFrameIndexWord.add_NewNode('[');
-				subFrameIndexWord.transcribe_UnsignedShort(frameSubIndex);
-				subFrameIndexWord.add_NewNode(']');
+				successCount = count_SuccessfulChildren(state.childSlotIndices, state.parentFitnessRatings,
+					state.childCount, trialCount);
+				state.mutationControl.adapt(successCount, trialCount);
 
-				columnName.add_CutWholeList(subFrameIndexWord);
+			}
 
-				variablesList.add_NewNode(Variable_Double(columnName,
-					fixedInputs.get_FrameAdjustedDataPointAddress(0, count, 0, frameSubIndex)));
+			state.childCount = 0;
+			state.childEvolutionControlIndex = state.evolutionControlIndex;
 
-				//***TESTING***
-				cout << "\n";
-				columnName.output_Console();
-				//***TESTING***
+			//reproduction of surviving nets; each net ranked below the survivors is
+			//overwritten by a child of survivor(s) chosen by parentSelector, starting
+			//from the bottom ranked net
+			for (count = state.survivorCount; count < activeNetCount; count++)
+			{
 
-				charNode = columnName.get_LastNode();
+				motherIndex = parentSelector.select_PrimaryParentRank(activeNetCount - 1 - count);
 
-				do
+				//asexual reproduction, copy the parent over the child
+				if (!state.maxSpliceLength)
 				{
 
-					charNode = charNode->get_PriorNode();
-
-				} while (charNode->content != '[');
+					*(get_RankedNet(count)) = *(get_RankedNet(motherIndex));
 
-				columnName.delete_Range(charNode, columnName.get_LastNode());
+					*(state.parentFitnessRatings.get_ElementAddress(state.childCount)) = survivorFitnessRatings.get_Element(motherIndex);
 
-			}
+				}
 
-		}
+				//sexual reproduction, splice groups of cells from mother and father nets into child
+				else
+				{
 
-		//check for required <calculatedInputUpdateExpressions> tag
-		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputUpdateExpressionsInTag, wordIterationNode))
-			return 8;
+					netIndex = parentSelector.select_SecondaryParentRank(motherIndex);
 
-		//calculatedInputUpdateExpressions initialization loop
-		while (calculatedInputUpdateExpressionInTag.testWord_MatchesTerm(wordIterationNode->content))
-		{
+					get_RankedNet(count)->meiosis(get_RankedNet(motherIndex)->get_Cells(),
+						get_RankedNet(netIndex)->get_Cells(), state.maxSpliceLength);
 
-			//check for required <ciue_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputUpdateExpressionInTag, wordIterationNode))
-				return 9;
+					if (survivorFitnessRatings.get_Element(motherIndex) < survivorFitnessRatings.get_Element(netIndex))
+						*(state.parentFitnessRatings.get_ElementAddress(state.childCount)) = survivorFitnessRatings.get_Element(motherIndex);
 
-			tempExpressionNode = tempExpressions.add_NewNode();
+					else
+						*(state.parentFitnessRatings.get_ElementAddress(state.childCount)) = survivorFitnessRatings.get_Element(netIndex);
 
-			//check for valid expression using only variables contained in variablesList
-			if (!tempExpressionNode->content.initialize(wordIterationNode->content, variablesList))
-				return 10;
+				}
 
-			wordIterationNode = wordIterationNode->get_NextNode();
+				*(state.childSlotIndices.get_ElementAddress(state.childCount)) = netRanks.get_Element(count);
+				state.childCount++;
 
-			if (!wordIterationNode)
-				return 11;
+			}
 
-			//check for required </ciue_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(calculatedInputUpdateExpressionOutTag, wordIterationNode))
-				return 12;
+			//mutate all but the top performing net
+			for (count = 1; count < activeNetCount; count++)
+				get_RankedNet(count)->mutate(state.mutationControl.get_MutationsPerNet(),
+					state.mutationControl.get_MutationAmplitude());
 
-		}
+			//restart from stagnation by reseeding the bottom ranked nets with
+			//heavily mutated copies of the top net
+			if (runControl.get_StagnationCycles() && state.stagnantCycleCount >= runControl.get_StagnationCycles())
+			{
 
-		//check for required </calculatedInputUpdateExpressions> tag
-		if (!loadedContent.validateWordNode_MatchesWord(calculatedInputUpdateExpressionsOutTag, wordIterationNode))
-			return 13;
+				reseedNetCount = runControl.get_ReseedNetCount(activeNetCount);
 
-		//check whether the correct number of calculated input update expressions are represented
-		if (tempExpressions.get_ListLength() != calculatedInputsCount)
-			return 14;
+				for (count = activeNetCount - reseedNetCount; count < activeNetCount; count++)
+				{
 
-		//this sections of the file is valid, initialize calculatedInputUpdateExpressions
-		calculatedInputUpdateExpressions = tempExpressions;
+					*(get_RankedNet(count)) = *(get_RankedNet(0));
+					get_RankedNet(count)->mutate(runControl.get_ReseedMutationsPerNet(),
+						runControl.get_ReseedMutationAmplitude());
 
-		//populate updatingFixedInputsVariables
-		updatingFixedInputsVariables.delete_WholeList();
-		variableNode = variablesList.get_LastNode();
+				}
 
-		for (count = (dataSetColumnCount - 1); count > 0; count--)
-		{
+				//reseeded nets are not children for mutation adaptation
+				state.childCount = 0;
 
-			frameLength = fixedInputs.get_ColumnFrameLength(count);
+				state.stagnantCycleCount = 0;
+				state.restartCount++;
 
-			for (frameSubIndex = (frameLength - 1); frameSubIndex > 0; frameSubIndex--)
-			{
+			}
 
-				if (variableNode->content.get_Utilized())
-					updatingFixedInputsVariables.add_NewNode(FixedInputReference(
-						&(variableNode->content), frameSubIndex, count), NULL, false);
+			iterate_EvolutionControl(state.evolutionControlIndex, state.repetitionCount);
 
-				variableNode = variableNode->get_PriorNode();
+			//checkpoint the run as it stands at the start of the next cycle
+			elapsedSeconds = state.priorElapsedSeconds + difftime(time(NULL), startTime);
 
-			}
+			if (runControl.test_CheckpointDue(state.cycleCount - checkpointCycleCount,
+				elapsedSeconds - checkpointElapsedSeconds))
+			{
 
-			if (variableNode->content.get_Utilized())
-				updatingFixedInputsVariables.add_NewNode(FixedInputReference(
-					&(variableNode->content), frameSubIndex, count), NULL, false);
+				if (!output_Checkpoint(runControl.get_CheckpointFileName(), state, elapsedSeconds))
+					cout << "\ncheckpoint could not be written after cycle " << state.cycleCount;
 
-			variableNode = variableNode->get_PriorNode();
+				checkpointCycleCount = state.cycleCount;
+				checkpointElapsedSeconds = elapsedSeconds;
 
-		}
+			}
 
-		frameLength = fixedInputs.get_ColumnFrameLength(count);
+		} while (true);
 
-		for (frameSubIndex = (frameLength - 1); frameSubIndex > 0; frameSubIndex--)
-		{
+		runControl.set_Results(state.cycleCount, stopReason);
 
-			if (variableNode->content.get_Utilized())
-				updatingFixedInputsVariables.add_NewNode(FixedInputReference(
-					&(variableNode->content), frameSubIndex, count), NULL, false);
+	}
 
-			variableNode = variableNode->get_PriorNode();
+public:
 
-		}
+	//default constructor; ensure null state but safe default construction 
+	Population() : totalNetCount(2), inputCellCount(1), outputCellCount(1), totalCellCount(3),
+		maxRoundsPerStimulate(1), dataSetColumnCount(1), dataSetRowCount(1), totalDataFrameCount(1),
+		calculatedInputsCount(0), fixedInputs(DataSetCollection()), calculatedInputs(0), outputs(1),
+		evaluationCriteriaExpressions(1), calculatedInputUpdateExpressions(0), cellControls(3), trackers(3),
+		evolutionControls(1), fullCoverageControls(1), nets(2), incrementalEvaluation(false),
+		calculatedInputsReadOutputs(false), lossAccumulatorCount(0), dataOnlyCalculatedInputCount(0),
+		netCalculatedInputCount(0), screening(false), screeningTolerance(0.0), screeningAuditInterval(0),
+		rowFitnessRecording(false), rowStream(NULL), rowsPerCycle(1), oldestRowIndex(0), earlyAbort(false),
+		negativeCriteriaValue(false), negativeCriteriaRowIndex(0), batchedCriteria(false)
+	{
 
-		if (variableNode->content.get_Utilized())
-			updatingFixedInputsVariables.add_NewNode(FixedInputReference(
-				&(variableNode->content), frameSubIndex, count), NULL, false);
+		//the default evolution control evaluates the single data set row
+		*(fullCoverageControls.get_ElementAddress(0)) = true;
 
-		//evaluationCriteriaExpressions, calculatedInputUpdateExpressions, variablesList,
-		//and updatingFixedInputsVariables have been initialized
-		return 0;
+		//nets null state
+		reset_NetRanks();
 
 	}
 
-	inline bool sub_Initialize_InterpretReturn_ExpressionsValidation(
-		const unsigned char fileValidationReturnCode)
+	//initializes this Population
+	bool initialize()
 	{
 
-		cout << "\n";
+		cout << "\n\n*** Population Initialization ***";
 
-		if (fileValidationReturnCode == 0)
-		{
+		//file name variables
+		ConsoleValidation_Word populationFileName;
+		FileValidation_WordGroup loadedContent;
+		unsigned char fileValidationReturnCode;
 
-			cout << "calculated input update and evaluation criteria expressions file sections are valid";
-			return true;
+		//open and load contents of populationFile, the population file from which to load
+		cout << "\nenter name of population load file (including extension): ";
+		populationFileName.getInput_Console();
 
-		}
+		loadedContent.getInput_File(populationFileName);
 
-		else
+		if (!loadedContent.test_ListPopulated())
 		{
 
-			if (fileValidationReturnCode == 1)
-				cout << "missing <evaluationCriteriaExpressions> tag or incomplete file";
-			else if (fileValidationReturnCode == 2)
-				cout << "missing <ece_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 3)
-				cout << "syntax of an evaluation criteria expression is invalid or refers to an illegal variable";
-			else if (fileValidationReturnCode == 4)
-				cout << "incomplete file";
-			else if (fileValidationReturnCode == 5)
-				cout << "missing </ece_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 6)
-				cout << "missing </evaluationCriteriaExpressions> tag or incomplete file";
-			else if (fileValidationReturnCode == 7)
-				cout << "discrepant dataSetRowCount and counted evaluation criteria expressions";
-			else if (fileValidationReturnCode == 8)
-				cout << "missing <calculatedInputUpdateExpressions> tag or incomplete file";
-			else if (fileValidationReturnCode == 9)
-				cout << "missing <ciue_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 10)
-				cout << "syntax of an calculate input update expression is invalid or refers to an illegal variable";
-			else if (fileValidationReturnCode == 11)
-				cout << "incomplete file";
-			else if (fileValidationReturnCode == 12)
-				cout << "missing </ciue_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 13)
-				cout << "missing </calculatedInputUpdateExpressions> tag or incomplete file";
-			else if (fileValidationReturnCode == 14)
-				cout << "discrepant calculatedInputsCount and counted calculated input update expressions";
+			cout << "invalid file name or empty file";
+			return false;
 
-			//reverse any possible partial initialization
+		}
 
-			//numerical properties null states
-			totalNetCount = 2;
-			inputCellCount = 1;
-			outputCellCount = 1;
-			totalCellCount = 3;
-			maxRoundsPerStimulate = 1;
-			dataSetColumnCount = 1;
-			dataSetRowCount = 1;
-			totalDataFrameCount = 1;
-			calculatedInputsCount = 0;
+		//initial editing/validation
+		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode(">", 0, true, 1, 0));
+		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
+		ValidationWord universalTag(tempConstructCodes);
 
-			//fixedInputs and calculatedInputs null states
-			fixedInputs = DataSetCollection();
-			calculatedInputs.resize_NoCopy(0);
+		//delete all spaces
+		loadedContent.editRange_DeleteWhitespace(loadedContent.get_FirstNode(),
+			loadedContent.get_LastNode(), false);
 
-			//outputs null state
-			outputs.resize_NoCopy(1);
+		//insert word divisions before and after any angled brace tags
+		loadedContent.editRange_Split(universalTag, loadedContent.get_FirstNode(),
+			loadedContent.get_LastNode(), true, true);
 
-			//variablesList, updatingFixedInputsVariables, evaluationCriteraExpressions
-			//and calculatedInputUpdateExpressions null states
-			variablesList.delete_WholeList();
-			updatingFixedInputsVariables.delete_WholeList();
-			evaluationCriteriaExpressions.resize_NoCopy(1);
-			calculatedInputUpdateExpressions.resize_NoCopy(0);
+		UniformNode<Word> *wordIterationNode = loadedContent.get_FirstNode();
 
+		//validate the leading and numerical properties sections of the file, initialize
+		//totalNetCount, inputCellCount, outputCellCount, totalCellCount,
+		//maxRoundsPerStimulate, dataSetColumnCount, dataSetRowCount,
+		//totalDataFrameCount, and calculatedInputsCount
+		fileValidationReturnCode = sub_Initialize_Validate_NumericalProperties(
+			loadedContent, wordIterationNode);
+		
+		if (!sub_Initialize_InterpretReturn_NumericalPropertiesValidation(fileValidationReturnCode))
 			return false;
 
-		}
-
-	}
-
-	/*
-	checks the cell controls section of loadedContent to ensure it
-	matches the xml format described below (w/out whitespace); initializes
-	//cellControls and trackers then returns 0 if the file section is valid,
-	otherwise returns an error code for console reporting;
-	<cellControlGroups>												//required
-		<ccg_0>														//required (tag matches any <ccg_#>)
-			<groupLength>...</groupLength>										//required (unsigned short >= 1)
-			<linksCoeffCenter>...</linksCoeffCenter>				//required (double > 0.0)
-			<internalSpread>...</internalSpread>					//required (double > 0.0)
-			<broadcastSpread>...</broadcastSpread>					//required (double > 0.0)
-			<linksCoeffSpread>...</linksCoeffSpread>				//required (double > 0.0)
-			<decayRateSpread>...</decayRateSpread>					//required (double > 0.0)
-			<refractoryPeriodSpread>...</refractoryPeriodSpread>	//required (unsigned char >= 1)
-			<broadcastSwitchSignFreq>...</broadcastSwitchSignFreq>	//required (double >= 0.0, <= 1.0)
-			<linksSwitchSignFreq>...</linksSwitchSignFreq>			//required (double >= 0.0, <= 1.0)
-		</ccg_0>													//required (tag matches any </ccg_#>)
-		<ccg_1>														//optional
-			...
-		</ccg_1>
-		...
-	</cellControlGroups>
-	*/
-	inline unsigned char sub_Initialize_ValidateCellControls(
-		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)
-	{
+		//validate the inputs section of the file, initialize fixedInputs, calculatedInputs and calculatedInputsPrepValues
+		fileValidationReturnCode = sub_Initialize_Validate_Inputs(
+			loadedContent, wordIterationNode);
 
-		//variables for validation
-		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
-		
-		Word cellControlGroupsInTag("<cellControlGroups>");
-		Word cellControlGroupsOutTag("</cellControlGroups>");
+		if (!sub_Initialize_InterpretReturn_InputsValidation(fileValidationReturnCode))
+			return false;
 
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("c", 0, false, 2, 2));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord cellControlGroupInTag(tempConstructCodes);
+		//validate the outputs section of the file, initialize outputs
+		fileValidationReturnCode = sub_Initialize_Validate_Outputs(
+			loadedContent, wordIterationNode);
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("c", 0, false, 2, 2));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord cellControlGroupOutTag(tempConstructCodes);
+		if (!sub_Initialize_InterpretReturn_OutputsValidation(fileValidationReturnCode))
+			return false;
 
-		Word groupLengthInTag("<groupLength>");
-		Word groupLengthOutTag("</groupLength>");
-		Word linksCoeffCenterInTag("<linksCoeffCenter>");
-		Word linksCoeffCenterOutTag("</linksCoeffCenter>");
-		Word internalSpreadInTag("<internalSpread>");
-		Word internalSpreadOutTag("</internalSpread>");
-		Word broadcastSpreadInTag("<broadcastSpread>");
-		Word broadcastSpreadOutTag("</broadcastSpread>");
-		Word linksCoeffSpreadInTag("<linksCoeffSpread>");
-		Word linksCoeffSpreadOutTag("</linksCoeffSpread>");
-		Word decayRateSpreadInTag("<decayRateSpread>");
-		Word decayRateSpreadOutTag("</decayRateSpread>");
-		Word refractoryPeriodSpreadInTag("<refractoryPeriodSpread>");
-		Word refractoryPeriodSpreadOutTag("</refractoryPeriodSpread>");	
-		Word broadcastSwitchSignFreqInTag("<broadcastSwitchSignFreq>");
-		Word broadcastSwitchSignFreqOutTag("</broadcastSwitchSignFreq>");
-		Word linksSwitchSignFreqInTag("<linksSwitchSignFreq>");
-		Word linksSwitchSignFreqOutTag("</linksSwitchSignFreq>");
+		//validate the evaluation criteria and calculated input update expressions sections
+		//of the file, initialize variablesList, updatingFixedInputsVariables,
+		//evaluationCriteriaExpressions and calculatedInputUpdateExpressions
+		fileValidationReturnCode = sub_Initialize_Validate_Expressions(
+			loadedContent, wordIterationNode);
 
-		//storage variables
-		unsigned short groupLength;
-		double linksCoeffCenter;
-		double internalSpread;
-		double broadcastSpread;
-		double linksCoeffSpread;
-		double decayRateSpread;
-		unsigned char refractoryPeriodSpread;
-		double broadcastSwitchSignFreq;
-		double linksSwitchSignFreq;
-		UniformList<CellControl> tempCellControlsList;
-		UniformNode<CellControl> *cellControlNode;
+		if (!sub_Initialize_InterpretReturn_ExpressionsValidation(
+			fileValidationReturnCode))
+			return false;
 
-		unsigned short tempTotalCellCount = 0;
+		//validate the cellControls section of the file,
+		//initialize cellControls and trackers
+		fileValidationReturnCode = sub_Initialize_ValidateCellControls(
+			loadedContent, wordIterationNode);
 
-		//main body of validation logic
+		if (!sub_Initialize_InterpretReturn_CellControlsValidation(fileValidationReturnCode))
+			return false;
 
-		//check for required <cellControlGroups> tag
-		if (!loadedContent.validateWordNode_MatchesWord(cellControlGroupsInTag, wordIterationNode))
-			return 2;
+		//validate the nets and terminal sections of the file,
+		//initialize nets
+		fileValidationReturnCode = sub_Initialize_ValidateNetsAndTerminal(
+			loadedContent, wordIterationNode);
 
-		//output object construction loop
-		do
-		{
+		if (!sub_Initialize_InterpretReturn_NetsAndTerminalValidation(fileValidationReturnCode))
+			return false;
 
-			//check for required <ccg_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(cellControlGroupInTag, wordIterationNode))
-				return 3;
+		//until an evolution schedule is set, every cycle evaluates all data set rows
+		reset_EvolutionControls();
+		screening = false;
+		rowFitnessRecording = false;
+		clear_RowStream();
+		clear_NativeExpressions();
+		earlyAbort = false;
+		batchedCriteria = false;
 
-			//check for required <groupLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(groupLengthInTag, wordIterationNode))
-				return 31;
+		//every section of the file has been checked and cross validated
+		//all population variables have been initialized
+		return true;
 
-			//capture required groupLength unsigned short (>= 1)
-			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, groupLength, 1))
-				return 32;
+	}
 
-			//check for required </groupLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(groupLengthOutTag, wordIterationNode))
-				return 33;
+	//sets the evolution schedule used by evolve_Asexual() and evolve_Sexual(); each
+	//evolution cycle evaluates only the data set rows of the current control using
+	//at most its maxPopulationSize nets, and only nets within its survivalThreshold
+	//reproduce; each control is used for totalRepetitions cycles before the next and
+	//the schedule restarts after the final control; returns false (leaving the
+	//current schedule unchanged) if any control is invalid for this population
+	bool set_EvolutionControls(UniformList<EvolutionControl> &aEvolutionControls)
+	{
 
-			//check for required <linksCoeffCenter> tag
-			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffCenterInTag, wordIterationNode))
-				return 4;
+		UniformNode<EvolutionControl> *evolutionControlNode(aEvolutionControls.get_FirstNode());
+		unsigned long long evolutionControlIndex(0);
+		unsigned long long count;
+		unsigned long long length;
 
-			//capture required linksCoeffCenter double (any value)
-			if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, linksCoeffCenter))
-				return 5;
+		if (!evolutionControlNode)
+		{
 
-			//check for required </linksCoeffCenter> tag
-			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffCenterOutTag, wordIterationNode))
-				return 6;
+			cout << "\nevolution schedule must contain at least one evolution control";
+			return false;
 
-			//check for required <internalSpread> tag
-			if(!loadedContent.validateWordNode_MatchesWord(internalSpreadInTag, wordIterationNode))
-				return 7;
+		}
 
-			//capture required internalSpread double (must be > 0.0)
-			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, internalSpread, true, true))
-				return 8;
+		while (evolutionControlNode)
+		{
 
-			//check for required </internalSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(internalSpreadOutTag, wordIterationNode))
-				return 9;
+			if (evolutionControlNode->content.get_MaxPopulationSize() < 2)
+			{
 
-			//check for required <broadcastSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(broadcastSpreadInTag, wordIterationNode))
-				return 10;
+				cout << "\nevolution control " << evolutionControlIndex << ": maxPopulationSize must be >= 2";
+				return false;
 
-			//capture required broadcastSpread double (must be > 0.0)
-			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, broadcastSpread, true, true))
-				return 1;
+			}
 
-			//check for required </broadcastSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(broadcastSpreadOutTag, wordIterationNode))
-				return 12;
+			if (!evolutionControlNode->content.get_TotalRepetitions())
+			{
 
-			//check for required <linksCoeffSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffSpreadInTag, wordIterationNode))
-				return 13;
+				cout << "\nevolution control " << evolutionControlIndex << ": totalRepetitions must be >= 1";
+				return false;
 
-			//capture required linksCoeffSpread double (must be > 0)
-			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, linksCoeffSpread, true, true))
-				return 14;
+			}
 
-			//check for required </linksCoeffSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(linksCoeffSpreadOutTag, wordIterationNode))
-				return 15;
+			length = evolutionControlNode->content.get_DataSetRowIndicesLength();
 
-			//check for required <decayRateSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(decayRateSpreadInTag, wordIterationNode))
-				return 16;
+			if (!length)
+			{
 
-			//capture required decayRateSpread double (must be > 0)
-			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, decayRateSpread, true, true))
-				return 17;
+				cout << "\nevolution control " << evolutionControlIndex << ": at least one data set row index is required";
+				return false;
 
-			//check for required </decayRateSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(decayRateSpreadOutTag, wordIterationNode))
-				return 18;
+			}
 
-			//check for required <refractoryPeriodSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodSpreadInTag, wordIterationNode))
-				return 19;
+			for (count = 0; count < length; count++)
+			{
 
-			//capture required refractoryPeriodSpread unsigned char (>= 1)
-			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, refractoryPeriodSpread, 1))
-				return 20;
+				if (evolutionControlNode->content.get_DataSetRowIndicesElement(count) >= dataSetRowCount)
+				{
 
-			//check for required </refractoryPeriodSpread> tag
-			if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodSpreadOutTag, wordIterationNode))
-				return 21;
+					cout << "\nevolution control " << evolutionControlIndex << ": data set row index ";
+					cout << evolutionControlNode->content.get_DataSetRowIndicesElement(count) << " is out of range";
+					return false;
 
-			//check for required <broadcastSwitchSignFreq> tag
-			if (!loadedContent.validateWordNode_MatchesWord(broadcastSwitchSignFreqInTag, wordIterationNode))
-				return 22;
+				}
 
-			//capture required broadcastSwitchSignFreq double (>=0 and <= 1.0)
-			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode,
-				broadcastSwitchSignFreq, false, true, 0.0, true, 1.0))
-				return 23;
+			}
 
-			//check for required </broadcastSwitchSignFreq> tag
-			if (!loadedContent.validateWordNode_MatchesWord(broadcastSwitchSignFreqOutTag, wordIterationNode))
-				return 24;
+			evolutionControlNode = evolutionControlNode->get_NextNode();
+			evolutionControlIndex++;
 
-			//check for required <linksSwitchSignFreq> tag
-			if (!loadedContent.validateWordNode_MatchesWord(linksSwitchSignFreqInTag, wordIterationNode))
-				return 25;
+		}
 
-			//capture required linksSwitchSignFreq double (>=0 and <= 1.0)
-			if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode,
-				linksSwitchSignFreq, false, true, 0.0, true, 1.0))
-				return 26;
+		evolutionControls = aEvolutionControls;
 
-			//check for required </linksSwitchSignFreq> tag
-			if (!loadedContent.validateWordNode_MatchesWord(linksSwitchSignFreqOutTag, wordIterationNode))
-				return 27;
+		//coverage is found once here rather than every cycle
+		fullCoverageControls.resize_NoCopy(evolutionControls.get_ArrayLength());
 
-			//check for required associated </ccg_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(cellControlGroupOutTag, wordIterationNode))
-				return 28;
+		for (evolutionControlIndex = 0; evolutionControlIndex < evolutionControls.get_ArrayLength(); evolutionControlIndex++)
+			*(fullCoverageControls.get_ElementAddress(evolutionControlIndex)) =
+				test_CoversAllRows(evolutionControls.get_ElementAddress(evolutionControlIndex));
 
-			//update tempTotalCellCount
-			tempTotalCellCount += groupLength;
+		return true;
 
-			//add/initialize node(s) to tempCellControlsList
-			cellControlNode = tempCellControlsList.add_NewRange(groupLength, NULL, true, false);
+	}
 
-			do
-			{
+	//sets the method evolve_Asexual() and evolve_Sexual() use to select parents among
+	//surviving nets; selectionType 0 means truncation (survivors parent equal numbers
+	//of children), 1 tournament (best of tournamentSize random survivors), and 2 fitness
+	//proportional (drawn from an alias table built once per evolution cycle); returns
+	//false (leaving the current method unchanged) if the parameters are invalid
+	bool set_ParentSelection(const unsigned char selectionType, const unsigned short tournamentSize = 2)
+	{
 
-				cellControlNode->content = CellControl(linksCoeffCenter, internalSpread,
-					broadcastSpread, linksCoeffSpread, decayRateSpread, refractoryPeriodSpread,
-					broadcastSwitchSignFreq, linksSwitchSignFreq);
+		if (selectionType > 2)
+		{
 
-				cellControlNode = cellControlNode->get_NextNode();
+			cout << "\nselection type must be 0 (truncation), 1 (tournament), or 2 (fitness proportional)";
+			return false;
 
-			} while (cellControlNode);
+		}
 
-		} while (cellControlGroupInTag.testWord_MatchesTerm(wordIterationNode->content));
+		if (selectionType == 1 && tournamentSize < 2)
+		{
 
-		//check for required </cellControlGroups> tag
-		if (!loadedContent.validateWordNode_MatchesWord(cellControlGroupsOutTag, wordIterationNode))
-			return 29;
+			cout << "\ntournament size must be >= 2";
+			return false;
 
-		//check for required totalCellCount value
-		if (tempTotalCellCount != totalCellCount)
-			return 30;
+		}
 
-		//this section of the file is valid
-		cellControls = tempCellControlsList;
-		trackers.resize_NoCopy(totalCellCount);
+		parentSelector = ParentSelector(selectionType, tournamentSize);
 
-		//cellControls and trackers have been initialized
-		return 0;
+		return true;
 
 	}
 
-	inline bool sub_Initialize_InterpretReturn_CellControlsValidation(
-		const unsigned char fileValidationReturnCode)
+	//enables/disables incremental evaluation, in which each net records the cells
+	//touched in every data frame and afterwards re-stimulates only the frames in which
+	//a cell changed by mutation or meiosis was touched (reusing its recorded output
+	//values for all others); returns false if calculated inputs read outputs since
+	//data frames are then not independent of each other
+	bool set_IncrementalEvaluation(const bool aIncrementalEvaluation)
 	{
 
-		cout << "\n";
-
-		if (fileValidationReturnCode == 0)
+		if (aIncrementalEvaluation && calculatedInputsReadOutputs)
 		{
 
-			cout << "cell controls file section is valid";
-			return true;
+			cout << "\nincremental evaluation unavailable; calculated input update expressions refer to outputs";
+			return false;
 
 		}
 
-		else
-		{
-
-			if (fileValidationReturnCode == 2)
-				cout << "missing <cellControlGroups> tag or incomplete file";
-			else if (fileValidationReturnCode == 3)
-				cout << "missing <ccg_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 31)
-				cout << "missing <groupLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 32)
-				cout << "invalid <groupLength> value or incomplete file";
-			else if (fileValidationReturnCode == 33)
-				cout << "missing </groupLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 4)
-				cout << "missing <linksCoeffCenter> tag or incomplete file";
-			else if (fileValidationReturnCode == 5)
-				cout << "invalid <linksCoeffCenter> value or incomplete file";
-			else if (fileValidationReturnCode == 6)
-				cout << "missing </linksCoeffCenter> tag or incomplete file";
-			else if (fileValidationReturnCode == 7)
-				cout << "missing <internalSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 8)
-				cout << "invalid <internalSpread> value or incomplete file";
-			else if (fileValidationReturnCode == 9)
-				cout << "missing </internalSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 10)
-				cout << "missing <broadcastSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 11)
-				cout << "invalid <broadcastSpread> value or incomplete file";
-			else if (fileValidationReturnCode == 12)
-				cout << "missing </broadcastSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 13)
-				cout << "missing <linksCoeffSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 14)
-				cout << "invalid <linksCoeffSpread> value or incomplete file";
-			else if (fileValidationReturnCode == 15)
-				cout << "missing </linksCoeffSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 16)
-				cout << "missing <decayRateSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 17)
-				cout << "invalid <decayRateSpread> value or incomplete file";
-			else if (fileValidationReturnCode == 18)
-				cout << "missing </decayRateSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 19)
-				cout << "missing <refractoryPeriodSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 20)
-				cout << "invalid <refractoryPeriodSpread> value or incomplete file";
-			else if (fileValidationReturnCode == 21)
-				cout << "missing </refractoryPeriodSpread> tag or incomplete file";
-			else if (fileValidationReturnCode == 22)
-				cout << "missing <broadcastSwitchSignFreq> tag or incomplete file";
-			else if (fileValidationReturnCode == 23)
-				cout << "invalid <broadcastSwitchSignFreq> value or incomplete file";
-			else if (fileValidationReturnCode == 24)
-				cout << "missing </broadcastSwitchSignFreq> tag or incomplete file";
-			else if (fileValidationReturnCode == 25)
-				cout << "missing <linksSwitchSignFreq> tag or incomplete file";
-			else if (fileValidationReturnCode == 26)
-				cout << "invalid <linksSwitchSignFreq> value or incomplete file";
-			else if (fileValidationReturnCode == 27)
-				cout << "missing </linksSwitchSignFreq> tag or incomplete file";
-			else if (fileValidationReturnCode == 28)
-				cout << "missing </ccg_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 29)
-				cout << "missing </cellControlGroups> tag";
-			else if (fileValidationReturnCode == 30)
-				cout << "discrepant totalCellCount and counted cell controls";
-
-			//reverse any possible partial initialization
+		incrementalEvaluation = aIncrementalEvaluation;
 
-			//numerical properties null states
-			totalNetCount = 2;
-			inputCellCount = 1;
-			outputCellCount = 1;
-			totalCellCount = 3;
-			maxRoundsPerStimulate = 1;
-			dataSetColumnCount = 1;
-			dataSetRowCount = 1;
-			totalDataFrameCount = 1;
-			calculatedInputsCount = 0;
+		return true;
 
-			//fixedInputs and calculatedInputs null states
-			fixedInputs = DataSetCollection();
-			calculatedInputs.resize_NoCopy(0);
+	}
 
-			//outputs null state
-			outputs.resize_NoCopy(1);
+	//enables offspring screening; before each evolution cycle's full evaluation the last
+	//cycle's children and the surviving nets are evaluated on probeDataSetRowIndices only,
+	//children whose probe fitnessRating is more than aScreeningTolerance above the worst
+	//survivor's skip full evaluation and rank last; every aScreeningAuditInterval'th
+	//screened-out child is fully evaluated anyway (0 means never), and every screened-out
+	//child is logged to the progress output so that screening accuracy can be audited;
+	//returns false (leaving screening unchanged) if the parameters are invalid
+	bool set_Screening(UniformList<unsigned long long> &probeDataSetRowIndices,
+		const double aScreeningTolerance = 0.0, const unsigned short aScreeningAuditInterval = 0)
+	{
 
-			//variablesList, updatingFixedInputsVariables, evaluationCriteraExpressions
-			//and calculatedInputUpdateExpressions null states
-			variablesList.delete_WholeList();
-			updatingFixedInputsVariables.delete_WholeList();
-			evaluationCriteriaExpressions.resize_NoCopy(1);
-			calculatedInputUpdateExpressions.resize_NoCopy(0);
+		UniformNode<unsigned long long> *rowIndexNode(probeDataSetRowIndices.get_FirstNode());
 
-			//cellControls and trackers null states
-			cellControls.resize_NoCopy(3);
-			trackers.resize_NoCopy(3);
+		if (!rowIndexNode)
+		{
 
+			cout << "\nscreening requires at least one probe data set row index";
 			return false;
 
 		}
 
-	}
+		while (rowIndexNode)
+		{
 
-	/*
-	checks the nets and terminal sections of loadedContent to ensure they
-	matches the xml format described below (w/out whitespace); initializes
-	//nets then returns 0 if the file section is valid, otherwise returns
-	an error code for console reporting
-		<netGroups>															//required
-			<ng_0>															//required
-				<groupLength>...</groupLength>								//required unsigned short >= 1
-				<c_0>														//required
-					<internalCoeff>...</internalCoeff>						//required double >= 0.0
-					<broadcastCoeff>...</broadcastCoeff>					//required double any value
-					<decayRate>...</decayRate>								//required double >= 0.0, <= 1.0
-					<refractoryPeriod>...</refractoryPeriod>				//required unsigned char > 0
-					<postLinks>												//required
-						<pl_0>												//required
-							<postCellIndex>...</postCellIndex>				//unsigned short < totalCellCount
-							<linkCoeff>...</linkCoeff>						//required double any value			
-						</pl_0>												//required
-						<pl_1>												//optional
-							...
-						</pl_1>
-						...
-					</postLinks>											//required
-				</c_0>														//required
-				<c_1>														//optional
-					...
-				</c_1>
-				...
+			if (rowIndexNode->content >= dataSetRowCount)
+			{
 
-			</ng_0>															//required
-			<ng_1>															//optional
-			...
-			</ng_1>
-			...
-		</netGroups>														//required
-	</Population>															//required
-	*/
-	inline unsigned char sub_Initialize_ValidateNetsAndTerminal(
-		FileValidation_WordGroup &loadedContent, UniformNode<Word> *&wordIterationNode)	
-	{
+				cout << "\nprobe data set row index " << rowIndexNode->content << " is out of range";
+				return false;
 
-		//variables for validation
-		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
+			}
 
-		Word netGroupsInTag("<netGroups>");
-		Word netGroupsOutTag("</netGroups>");
+			rowIndexNode = rowIndexNode->get_NextNode();
 
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('n'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord netGroupInTag(tempConstructCodes);
+		}
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('n'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('g'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord netGroupOutTag(tempConstructCodes);
+		if (aScreeningTolerance < 0.0)
+		{
 
-		Word groupLengthInTag("<groupLength>");
-		Word groupLengthOutTag("</groupLength>");
-		Word cellsInTag("<cells>");
-		Word cellsOutTag("</cells>");
+			cout << "\nscreening tolerance must be >= 0.0";
+			return false;
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord cellInTag(tempConstructCodes);
+		}
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('c'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord cellOutTag(tempConstructCodes);
+		screeningControl = EvolutionControl(totalNetCount, DBL_MAX, 1, probeDataSetRowIndices);
+		screeningTolerance = aScreeningTolerance;
+		screeningAuditInterval = aScreeningAuditInterval;
+		screening = true;
 
-		Word internalCoeffInTag("<internalCoeff>");
-		Word internalCoeffOutTag("</internalCoeff>");
-		Word broadcastCoeffInTag("<broadcastCoeff>");
-		Word broadcastCoeffOutTag("</broadcastCoeff>");
-		Word decayRateInTag("<decayRate>");
-		Word decayRateOutTag("</decayRate>");
-		Word refractoryPeriodInTag("<refractoryPeriod>");
-		Word refractoryPeriodOutTag("</refractoryPeriod>");
-		Word postLinksInTag("<postLinks>");
-		Word postLinksOutTag("</postLinks>");
+		return true;
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('l'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord postLinkInTag(tempConstructCodes);
+	}
 
-		tempConstructCodes.delete_WholeList();
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('/'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('p'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('l'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('_'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode("09", 1, false, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord postLinkOutTag(tempConstructCodes);
+	//disables offspring screening
+	void clear_Screening()
+	{
 
-		Word postCellIndexInTag("<postCellIndex>");
-		Word postCellIndexOutTag("</postCellIndex>");
-		Word linkCoeffInTag("<linkCoeff>");
-		Word linkCoeffOutTag("</linkCoeff>");
-		Word populationOutTag("</Population>");
+		screening = false;
 
-		//storage variables
-		unsigned short groupLength;
-		double internalCoeff;
-		double broadcastCoeff;
-		double decayRate;
-		unsigned char refractoryPeriod;
-		unsigned short tempPostCellIndex;
-		int priorTempPostCellIndex;
-		double tempLinkCoeff;
-		UniformList<Link> postLinksList;
-		ExtensibleArray<bool> cellPriorLinksCounts(totalCellCount);
-		ExtensibleArray<unsigned short> netPriorLinksCounts(totalCellCount);
-		UniformList<Cell> tempCellsList;
-		unsigned short cellCount;
-		unsigned short secondCellCount;
-		UniformList<Net> tempNetsList;
-		UniformNode<Net> *netNode;
+	}
 
-		//initialize the netPriorLinksCounts list
-		for (cellCount = 0; cellCount < totalCellCount; cellCount++)
-			*(netPriorLinksCounts.get_ElementAddress(cellCount)) = 0;			
+	//enables/disables early abort; the caller declares that every evaluation criteria
+	//expression is non-negative, so a net's partial fitnessRating is a lower bound on its
+	//final fitnessRating; nets whose partial fitnessRating exceeds the survivalThreshold
+	//(or a rating enough nets of the same cycle already beat) are culled mid-evaluation and
+	//rank last; the declaration is checked after every row, and if a negative value is
+	//found the nets culled in that cycle are evaluated again and culling is suspended for
+	//the rest of the run (reported in the run's progress output; the setting is unchanged)
+	void set_EarlyAbort(const bool aEarlyAbort)
+	{
 
-		//main body of file validation logic
+		earlyAbort = aEarlyAbort;
 
-		//check for required <netGroups> tag
-		if (!loadedContent.validateWordNode_MatchesWord(netGroupsInTag, wordIterationNode))
-			return 2;
+	}
 
-		//net object construction loop
-		do
-		{
+	//enables/disables batched criteria, in which each evolution cycle evaluates every
+	//evaluation criteria expression once for all of its nets (see
+	//stimulate_AllFrames_SingleEvolutionCycle_Batched()) rather than once per net;
+	//fitnessRatings are unchanged; cycles are not batched while early abort is set,
+	//since early abort needs each row's contribution as soon as the row is stimulated
+	void set_BatchedCriteria(const bool aBatchedCriteria)
+	{
 
-			//check for required <ng_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(netGroupInTag, wordIterationNode))
-				return 3;
+		batchedCriteria = aBatchedCriteria;
 
-			//check for required <groupLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(groupLengthInTag, wordIterationNode))
-				return 38;
+	}
 
-			//capture required <groupLength> unsigned int (>= 1)
-			if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, groupLength, 1))
-				return 39;
+	//enables/disables row fitness recording, in which each net keeps its fitness
+	//contribution for every data set row it has been evaluated on, keyed by the content
+	//hash of its cells (see Net::get_ContentHash()); nets whose cells are unchanged
+	//(survivors and children identical to their parents) are not stimulated on recorded
+	//rows, and records saved by output_RowFitnessRecords() can be loaded into a later
+	//run over a grown data set so unchanged nets are only stimulated on the new rows;
+	//disabling it discards every record; returns false if calculated inputs read outputs
+	//since a row's contribution then depends on the rows evaluated before it
+	bool set_RowFitnessRecording(const bool aRowFitnessRecording)
+	{
 
-			//check for required </groupLength> tag
-			if (!loadedContent.validateWordNode_MatchesWord(groupLengthOutTag, wordIterationNode))
-				return 40;
+		if (aRowFitnessRecording && calculatedInputsReadOutputs)
+		{
 
-			//check for required <cells> tag
-			if (!loadedContent.validateWordNode_MatchesWord(cellsInTag, wordIterationNode))
-				return 4;
+			cout << "\nrow fitness recording unavailable; calculated input update expressions refer to outputs";
+			return false;
 
-			cellCount = 0;
-			
-			do
-			{
+		}
 
-				priorTempPostCellIndex = -1;
+		rowFitnessRecording = aRowFitnessRecording;
 
-				//check for required <c_#> tag
-				if (!loadedContent.validateWordNode_MatchesTerm(cellInTag, wordIterationNode))
-					return 5;
+		if (!rowFitnessRecording)
+		{
 
-				//check for required <internalCoeff> tag
-				if (!loadedContent.validateWordNode_MatchesWord(internalCoeffInTag, wordIterationNode))
-					return 6;
+			for (unsigned short count = 0; count < totalNetCount; count++)
+				nets.get_ElementAddress(count)->clear_RowFitnessRecord();
 
-				//capture required <internalCoeff> double (>= 0.0)
-				if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode, internalCoeff, false, true, 0.0))
-					return 7;
+		}
 
-				//check for required </internalCoeff> tag
-				if (!loadedContent.validateWordNode_MatchesWord(internalCoeffOutTag, wordIterationNode))
-					return 8;
+		return true;
 
-				//check for required <broadcastCoeff> tag
-				if (!loadedContent.validateWordNode_MatchesWord(broadcastCoeffInTag, wordIterationNode))
-					return 9;
+	}
 
-				//capture required <broadcastCoeff> double (any value)
-				if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, broadcastCoeff))
-					return 10;
+	//sets windowed evolution, in which the population evolves against a sliding window of
+	//the dataSetRowCount most recent data set rows (initially the population file's rows);
+	//before each evolution cycle up to aRowsPerCycle rows are read from aRowStream, one per
+	//line as a name, the data points of each data set and an evaluation criteria expression
+	//separated by ';' (data points separated by ','), each replacing the oldest row in place
+	//so memory stays bounded by the window; row fitness recording is enabled (when
+	//available) so nets unchanged since the last cycle are only stimulated on the new rows;
+	//evolution control and screening row indices refer to window positions; a file still
+	//being written is read as rows are appended, reading a pipe waits for rows so they pace
+	//evolution; checkpoints do not hold the window contents; returns false if aRowsPerCycle is 0
+	bool set_RowStream(istream &aRowStream, const unsigned short aRowsPerCycle = 1)
+	{
 
-				//check for required </broadcastCoeff> tag
-				if (!loadedContent.validateWordNode_MatchesWord(broadcastCoeffOutTag, wordIterationNode))
-					return 11;
+		if (!aRowsPerCycle)
+		{
 
-				//check for required <decayRate> tag
-				if (!loadedContent.validateWordNode_MatchesWord(decayRateInTag, wordIterationNode))
-					return 12;
+			cout << "\nrows per cycle must be >= 1";
+			return false;
 
-				//capture required <decayRate> double (>= 0.0, <= 1.0)
-				if (!loadedContent.validateWordNode_FloatingPoint_Limited(wordIterationNode,
-					decayRate, false, true, 0.0, true, 1.0))
-					return 13;
+		}
 
-				//check for required </decayRate> tag
-				if (!loadedContent.validateWordNode_MatchesWord(decayRateOutTag, wordIterationNode))
-					return 14;
+		rowStream = &aRowStream;
+		rowsPerCycle = aRowsPerCycle;
+		pendingStreamedRow.delete_WholeList();
 
-				//check for required <refractoryPeriod> tag
-				if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodInTag, wordIterationNode))
-					return 15;
+		if (!calculatedInputsReadOutputs)
+			rowFitnessRecording = true;
 
-				//capture required <refractoryPeriod> unsigned char (> 0)
-				if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, refractoryPeriod, 1))
-					return 16;
+		return true;
 
-				//check for required </refractoryPeriod> tag
-				if (!loadedContent.validateWordNode_MatchesWord(refractoryPeriodOutTag, wordIterationNode))
-					return 17;
+	}
 
-				//check for required <postLinks> tag
-				if (!loadedContent.validateWordNode_MatchesWord(postLinksInTag, wordIterationNode))
-					return 18;
+	//ends windowed evolution; the current window remains the population's data set rows
+	void clear_RowStream()
+	{
 
-				//reset the cellPriorLinksCounts list
-				for (secondCellCount = 0; secondCellCount < totalCellCount; secondCellCount++)
-					*(cellPriorLinksCounts.get_ElementAddress(secondCellCount)) = false;
+		rowStream = NULL;
+		pendingStreamedRow.delete_WholeList();
 
-				do
-				{
+	}
 
-					//check for required <pl_#> tag
-					if (!loadedContent.validateWordNode_MatchesTerm(postLinkInTag, wordIterationNode))
-						return 19;
+	//compiles every calculatedInputUpdateExpression and evaluationCriteriaExpression to
+	//native code (see NativeExpressionLibrary::build(), the files are <fileNamePrefix>.cpp
+	//and <fileNamePrefix>.so) and, once each native function has matched the interpreter
+	//on sampleCount random bindings of the variables, has the expressions call it; returns
+	//false, leaving the expressions interpreted, if native code is unavailable, fails to
+	//build or does not match; call once the population is initialized (initializing again,
+	//or replacing a streamed row's criteria, returns those expressions to the interpreter)
+	bool set_NativeExpressions(Word &fileNamePrefix, const unsigned short sampleCount = 16)
+	{
+
+		const unsigned long long expressionCount(calculatedInputsCount + dataSetRowCount);
+		const unsigned long long variableCount(variablesList.get_ListLength());
+		ExtensibleArray<Expression_Double*> expressions(expressionCount);
+		ExtensibleArray<NativeExpressionFunction> functions(expressionCount);
+		ExtensibleArray<double*> savedValueAddresses(variableCount);
+		ExtensibleArray<double> sampleValues(variableCount);
+		RandomGenerator sampleGenerator; //kept apart from the shared generator so evolution is unaffected
+		UniformNode<Variable_Double> *variableNode;
+		unsigned long long count;
+		unsigned long long mismatchIndex(expressionCount);
+		const double sampleScales[4] = {1.0, 10.0, 1000.0, 0.01};
+		unsigned short sampleIndex;
+		unsigned char buildReturnCode;
+
+		clear_NativeExpressions();
+
+		for (count = 0; count < calculatedInputsCount; count++)
+			*(expressions.get_ElementAddress(count)) = calculatedInputUpdateExpressions.get_ElementAddress(count);
 
-					//check for required <postCellIndex> tag
-					if (!loadedContent.validateWordNode_MatchesWord(postCellIndexInTag, wordIterationNode))
-						return 20;
+		for (count = 0; count < dataSetRowCount; count++)
+			*(expressions.get_ElementAddress(calculatedInputsCount + count)) = evaluationCriteriaExpressions.get_ElementAddress(count);
 
-					//capture required <postCellIndex> unsigned short (>= 0, < totalCellCount)
-					if (!loadedContent.validateWordNode_UnsignedInt_Limited(wordIterationNode, tempPostCellIndex, 0, true, (totalCellCount - 1)))
-						return 21;
+		buildReturnCode = nativeExpressions.build(expressions, fileNamePrefix);
 
-					//ensure postCellIndex is not this cell's index, is not a duplicate index
-					//within this postLinks list, and is in correct ascending list order;
-					//increment the index's netPriorCellLinks tracking count
-					if (tempPostCellIndex == cellCount)
-						return 22;
+		if (buildReturnCode == 1)
+			cout << "\nnative expressions are unavailable on this system; expressions remain interpreted";
 
-					else
-					{
+		else if (buildReturnCode == 2)
+			cout << "\nnative expression source could not be written; expressions remain interpreted";
 
-						if (!cellPriorLinksCounts.get_Element(tempPostCellIndex))
-						{
+		else if (buildReturnCode == 3)
+			cout << "\nnative expression compilation failed; expressions remain interpreted";
 
-							if (tempPostCellIndex > priorTempPostCellIndex)
-							{
+		else if (buildReturnCode == 4)
+			cout << "\nnative expression library could not be loaded; expressions remain interpreted";
 
-								*(cellPriorLinksCounts.get_ElementAddress(tempPostCellIndex)) = true;
-								priorTempPostCellIndex = tempPostCellIndex;
+		if (buildReturnCode)
+			return false;
 
-								*(netPriorLinksCounts.get_ElementAddress(tempPostCellIndex)) += 1;
+		for (count = 0; count < expressionCount; count++)
+		{
 
-							}
+			*(functions.get_ElementAddress(count)) = nativeExpressions.get_Function(count);
 
-							//the index is not in correct ascending list order
-							else
-								return 23;
+			if (!functions.get_Element(count))
+			{
 
-						}
+				cout << "\nnative expression library is incomplete; expressions remain interpreted";
+				nativeExpressions.unload();
 
-						//the index is duplicated in this postLinks list
-						else
-							return 24;
+				return false;
 
-					}
+			}
 
-					//check for required </postCellIndex> tag
-					if (!loadedContent.validateWordNode_MatchesWord(postCellIndexOutTag, wordIterationNode))
-						return 25;
+		}
 
-					//check for required <linkCoeff> tag
-					if (!loadedContent.validateWordNode_MatchesWord(linkCoeffInTag, wordIterationNode))
-						return 26;
+		//self-check; point every variable at sample values (restored afterwards)
+		variableNode = variablesList.get_FirstNode();
 
-					//capture required <linkCoeff> double (any value)
-					if (!loadedContent.validateWordNode_FloatingPoint_Unlimited(wordIterationNode, tempLinkCoeff))
-						return 27;
+		for (count = 0; variableNode; count++, variableNode = variableNode->get_NextNode())
+		{
 
-					//check for required </linkCoeff> tag
-					if (!loadedContent.validateWordNode_MatchesWord(linkCoeffOutTag, wordIterationNode))
-						return 28;
+			*(savedValueAddresses.get_ElementAddress(count)) = *(variableNode->content.get_ValueAddress());
+			variableNode->content.reassign_Value(sampleValues.get_ElementAddress(count));
 
-					//check for required </pl_#> tag
-					if (!loadedContent.validateWordNode_MatchesTerm(postLinkOutTag, wordIterationNode))
-						return 29;
+		}
 
-					//add the new link
-					postLinksList.add_NewNode(Link(tempPostCellIndex, tempLinkCoeff));
+		for (sampleIndex = 0; sampleIndex < sampleCount && mismatchIndex == expressionCount; sampleIndex++)
+		{
 
-				} while (postLinkInTag.testWord_MatchesTerm(wordIterationNode->content));
+			//samples range over several magnitudes
+			for (count = 0; count < variableCount; count++)
+				*(sampleValues.get_ElementAddress(count)) = ((static_cast<double>(sampleGenerator.get_Int())
+					/ 1073741823.5) - 1.0) * sampleScales[sampleIndex % 4];
 
-				//check for required </postLinks> tag
-				if (!loadedContent.validateWordNode_MatchesWord(postLinksOutTag, wordIterationNode))
-					return 30;
+			for (count = 0; count < expressionCount; count++)
+			{
 
-				//check for required </c_#> tag
-				if (!loadedContent.validateWordNode_MatchesTerm(cellOutTag, wordIterationNode))
-					return 31;
+				if (!expressions.get_Element(count)->test_NativeFunction(functions.get_Element(count)))
+				{
 
-				//add the new cell to the temp list
-				tempCellsList.add_NewNode(Cell(internalCoeff, broadcastCoeff,
-					decayRate, refractoryPeriod, postLinksList));
-				cellCount++;
+					mismatchIndex = count;
+					break;
 
-			} while (cellInTag.testWord_MatchesTerm(wordIterationNode->content));
+				}
 
-			//ensure that the correct number of cells has been created
-			if (cellCount != totalCellCount)
-				return 32;
+			}
 
-			//check for required </cells> tag
-			if (!loadedContent.validateWordNode_MatchesWord(cellsOutTag, wordIterationNode))
-				return 33;
+		}
 
-			//check for required </ng_#> tag
-			if (!loadedContent.validateWordNode_MatchesTerm(netGroupOutTag, wordIterationNode))
-				return 34;
+		variableNode = variablesList.get_FirstNode();
 
-			//add the new net(s) to tempNetsList
-			netNode = tempNetsList.add_NewRange(groupLength, NULL, true, false);
+		for (count = 0; variableNode; count++, variableNode = variableNode->get_NextNode())
+			variableNode->content.reassign_Value(savedValueAddresses.get_Element(count));
 
-			do
-			{
+		if (mismatchIndex < expressionCount)
+		{
 
-				netNode->content = Net(tempCellsList, netPriorLinksCounts, inputCellCount, totalCellCount);
+			cout << "\nnative expression " << mismatchIndex << " does not match the interpreter; expressions remain interpreted";
+			nativeExpressions.unload();
 
-				netNode = netNode->get_NextNode();
+			return false;
 
-			} while (netNode);
+		}
 
-			//reset the temp tracking variables
-			tempCellsList.delete_WholeList();
+		for (count = 0; count < expressionCount; count++)
+			expressions.get_Element(count)->attach_NativeFunction(functions.get_Element(count));
 
-			//reset the netPriorLinksCounts list
-			for (cellCount = 0; cellCount < totalCellCount; cellCount++)
-				*(netPriorLinksCounts.get_ElementAddress(cellCount)) = 0;
+		return true;
 
-		} while (netGroupInTag.testWord_MatchesTerm(wordIterationNode->content));
+	}
 
-		//ensure that the correct number of nets is represented
-		if (tempNetsList.get_ListLength() != totalNetCount)
-			return 35;
+	//returns every expression to the interpreter and unloads any native code
+	void clear_NativeExpressions()
+	{
 
-		//check for required </netGroups> tag
-		if (!loadedContent.validateWordNode_MatchesWord(netGroupsOutTag, wordIterationNode))
-			return 36;
+		unsigned long long count;
 
-		//check for final required </Population> tag
-		if (!loadedContent.validateWordNode_MatchesWord(populationOutTag, wordIterationNode, false, false))
-			return 37;
+		for (count = 0; count < calculatedInputUpdateExpressions.get_ArrayLength(); count++)
+			calculatedInputUpdateExpressions.get_ElementAddress(count)->detach_NativeFunction();
 
-		//this section of the file is valid
-		nets = tempNetsList;
+		for (count = 0; count < evaluationCriteriaExpressions.get_ArrayLength(); count++)
+			evaluationCriteriaExpressions.get_ElementAddress(count)->detach_NativeFunction();
 
-		//totalNetCount and nets have been initialized
-		return 0;
+		nativeExpressions.unload();
 
 	}
 
-	inline bool sub_Initialize_InterpretReturn_NetsAndTerminalValidation(
-		const unsigned char fileValidationReturnCode)
+	//writes the row fitness record of every net (see set_RowFitnessRecording()) to
+	//outputFileName in binary form; rows are identified by get_DataSetRowKey() and nets
+	//by content hash, so the records can be loaded by load_RowFitnessRecords() into a
+	//population initialized from an edited data set; returns false if writing fails
+	bool output_RowFitnessRecords(Word &outputFileName)
 	{
 
-		cout << "\n";
+		ofstream outputFile;
+		unsigned long long dataSetRowIndex;
+		unsigned short count;
+		unsigned short recordedNetCount(0);
+		double rowFitnessRating;
+		Net *net;
 
-		if (fileValidationReturnCode == 0)
+		if (!open_OutputFile_BinaryTemporary(outputFile, outputFileName))
+			return false;
+
+		for (count = 0; count < totalNetCount; count++)
 		{
 
-			cout << "nets file section is valid";
-			return true;
+			if (nets.get_ElementAddress(count)->get_RowFitnessRecordLength() == dataSetRowCount)
+				recordedNetCount++;
 
 		}
 
-		else
+		outputValue_ToOpenFile_Binary(rowFitnessFileTag, outputFile);
+		outputValue_ToOpenFile_Binary(rowFitnessFileVersion, outputFile);
+		outputValue_ToOpenFile_Binary(get_RowEvaluationKey(), outputFile);
+		outputValue_ToOpenFile_Binary(dataSetRowCount, outputFile);
+
+		for (dataSetRowIndex = 0; dataSetRowIndex < dataSetRowCount; dataSetRowIndex++)
+			outputValue_ToOpenFile_Binary(get_DataSetRowKey(dataSetRowIndex), outputFile);
+
+		outputValue_ToOpenFile_Binary(recordedNetCount, outputFile);
+
+		//each record is its net's content hash followed by a recorded flag and
+		//(if recorded) the fitness contribution of every row
+		for (count = 0; count < totalNetCount; count++)
 		{
 
-			if (fileValidationReturnCode == 2)
-				cout << "missing <netGroups> tag or incomplete file";
-			else if (fileValidationReturnCode == 3)
-				cout << "missing <ng_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 38)
-				cout << "missing <groupLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 39)
-				cout << "invalid <groupLength> value or incomplete file";
-			else if (fileValidationReturnCode == 40)
-				cout << "missing </groupLength> tag or incomplete file";
-			else if (fileValidationReturnCode == 4)
-				cout << "missing <cells> tag or incomplete file";
-			else if (fileValidationReturnCode == 5)
-				cout << "missing <c_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 6)
-				cout << "missing <internalCoeff> tag or incomplete file";
-			else if (fileValidationReturnCode == 7)
-				cout << "invalid <internalCoeff> value or incomplete file";
-			else if (fileValidationReturnCode == 8)
-				cout << "missing </internalCoeff> tag or incomplete file";
-			else if (fileValidationReturnCode == 9)
-				cout << "missing <broadcastCoeff> tag or incomplete file";
-			else if (fileValidationReturnCode == 10)
-				cout << "invalid <broadcastCoeff> value or incomplete file";
-			else if (fileValidationReturnCode == 11)
-				cout << "missing </broadcastCoeff> tag or incomplete file";
-			else if (fileValidationReturnCode == 12)
-				cout << "missing <decayRate> tag or incomplete file";
-			else if (fileValidationReturnCode == 13)
-				cout << "invalid <decayRate> value or incomplete file";
-			else if (fileValidationReturnCode == 14)
-				cout << "missing </decayRate> tag or incomplete file";
-			else if (fileValidationReturnCode == 15)
-				cout << "missing <refractoryPeriod> tag or incomplete file";
-			else if (fileValidationReturnCode == 16)
-				cout << "invalid <refractoryPeriod> value or incomplete file";
-			else if (fileValidationReturnCode == 17)
-				cout << "missing </refractoryPeriod> tag or incomplete file";
-			else if (fileValidationReturnCode == 18)
-				cout << "missing <postLinks> tag or incomplete file";
-			else if (fileValidationReturnCode == 19)
-				cout << "missing <pl_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 20)
-				cout << "missing <postCellIndex> tag or incomplete file";
-			else if (fileValidationReturnCode == 21)
-				cout << "invalid <postCellIndex> value or incomplete file";
-			else if (fileValidationReturnCode == 22)
-				cout << "invalid <postCellIndex> value (value == cell index)";
-			else if (fileValidationReturnCode == 23)
-				cout << "<postCellIndex> value is not in correct ascending list order";
-			else if (fileValidationReturnCode == 24)
-				cout << "duplicate <postCellIndex> found";
-			else if (fileValidationReturnCode == 25)
-				cout << "missing </postCellIndex> tag or incomplete file";
-			else if (fileValidationReturnCode == 26)
-				cout << "missing <linkCoeff> tag or incomplete file";
-			else if (fileValidationReturnCode == 27)
-				cout << "invalid <linkCoeff> value or incomplete file";
-			else if (fileValidationReturnCode == 28)
-				cout << "missing </linkCoeff> tag or incomplete file";
-			else if (fileValidationReturnCode == 29)
-				cout << "missing </pl_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 30)
-				cout << "missing </postLinks> tag or incomplete file";
-			else if (fileValidationReturnCode == 31)
-				cout << "missing </c_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 32)
-				cout << "discrepant totalCellCount and counted cells";
-			else if (fileValidationReturnCode == 33)
-				cout << "missing </cells> tag or incomplete file";
-			else if (fileValidationReturnCode == 34)
-				cout << "missing </ng_#> tag or incomplete file";
-			else if (fileValidationReturnCode == 35)
-				cout << "discrepant totalNetsCount and counted nets";
-			else if (fileValidationReturnCode == 36)
-				cout << "missing </netGroups> tag or incomplete file";
-			else if (fileValidationReturnCode == 37)
-				cout << "missing terminal </Population> tag";
+			net = nets.get_ElementAddress(count);
 
-			//reverse any possible partial initialization
+			if (net->get_RowFitnessRecordLength() != dataSetRowCount)
+				continue;
 
-			//numerical properties null states
-			totalNetCount = 2;
-			inputCellCount = 1;
-			outputCellCount = 1;
-			totalCellCount = 3;
-			maxRoundsPerStimulate = 1;
-			dataSetColumnCount = 1;
-			dataSetRowCount = 1;
-			totalDataFrameCount = 1;
-			calculatedInputsCount = 0;
+			outputValue_ToOpenFile_Binary(net->get_RowFitnessKey(), outputFile);
 
-			//fixedInputs and calculatedInputs null states
-			fixedInputs = DataSetCollection();
-			calculatedInputs.resize_NoCopy(0);
+			for (dataSetRowIndex = 0; dataSetRowIndex < dataSetRowCount; dataSetRowIndex++)
+			{
 
-			//outputs null state
-			outputs.resize_NoCopy(1);
+				if (net->get_RecordedRowFitness(dataSetRowIndex, rowFitnessRating))
+				{
 
-			//variablesList, updatingFixedInputsVariables, evaluationCriteraExpressions
-			//and calculatedInputUpdateExpressions null states
-			variablesList.delete_WholeList();
-			updatingFixedInputsVariables.delete_WholeList();
-			evaluationCriteriaExpressions.resize_NoCopy(1);
-			calculatedInputUpdateExpressions.resize_NoCopy(0);
+					outputValue_ToOpenFile_Binary(true, outputFile);
+					outputValue_ToOpenFile_Binary(rowFitnessRating, outputFile);
 
-			//cellControls and trackers null states
-			cellControls.resize_NoCopy(3);
-			trackers.resize_NoCopy(3);
+				}
+
+				else
+					outputValue_ToOpenFile_Binary(false, outputFile);
+
+			}
+
+		}
+
+		if (!outputFile.good())
+			return false;
+
+		outputFile.close();
+
+		return replace_File_FromTemporary(outputFileName);
+
+	}
+
+	//loads row fitness records written by output_RowFitnessRecords() (possibly by a run
+	//over a different data set) into every net with the same content hash; rows are
+	//matched by get_DataSetRowKey(), rows which are new to the data set remain unrecorded
+	//and rows which no longer exist are dropped; enables row fitness recording; returns
+	//false (leaving records unchanged) if the file cannot be read or was written with
+	//different evaluation properties (see get_RowEvaluationKey())
+	bool load_RowFitnessRecords(Word &inputFileName)
+	{
+
+		ifstream inputFile;
+		unsigned int fileTag;
+		unsigned short fileVersion;
+		unsigned long long evaluationKey;
+		unsigned long long fileDataSetRowCount;
+		unsigned long long fileDataSetRowIndex;
+		unsigned long long dataSetRowIndex;
+		unsigned long long rowKey;
+		unsigned long long tableIndex;
+		unsigned long long tableLength(1);
+		unsigned short recordedNetCount;
+		unsigned short netCount;
+		unsigned short count;
+		unsigned short restoredNetCount(0);
+		unsigned long long matchedRowCount(0);
+		unsigned long long contentHash;
+		bool recorded;
+		double rowFitnessRating;
 
-			//nets null state
-			nets.delete_WholeList();
-			nets.add_NewRange(2);
+		if (calculatedInputsReadOutputs)
+		{
 
+			cout << "\nrow fitness recording unavailable; calculated input update expressions refer to outputs";
 			return false;
 
 		}
 
-	}
+		if (!open_InputFile_Binary(inputFile, inputFileName))
+		{
 
-public:
+			cout << "\nrow fitness records file could not be opened";
+			return false;
 
-	//default constructor; ensure null state but safe default construction 
-	Population() : totalNetCount(2), inputCellCount(1), outputCellCount(1), totalCellCount(3),
-		maxRoundsPerStimulate(1), dataSetColumnCount(1), dataSetRowCount(1), totalDataFrameCount(1),
-		calculatedInputsCount(0), fixedInputs(DataSetCollection()), calculatedInputs(0), outputs(1),
-		evaluationCriteriaExpressions(1), calculatedInputUpdateExpressions(0), cellControls(3), trackers(3)
-	{
+		}
 
-		//nets null state
-		nets.add_NewRange(2);
+		if (!inputValue_FromOpenFile_Binary(fileTag, inputFile) || fileTag != rowFitnessFileTag
+			|| !inputValue_FromOpenFile_Binary(fileVersion, inputFile) || fileVersion != rowFitnessFileVersion
+			|| !inputValue_FromOpenFile_Binary(evaluationKey, inputFile)
+			|| !inputValue_FromOpenFile_Binary(fileDataSetRowCount, inputFile))
+		{
 
-	}
+			cout << "\nfile is not a row fitness records file of this version";
+			return false;
 
-	//initializes this Population
-	bool initialize()
-	{
+		}
 
-		cout << "\n\n*** Population Initialization ***";
+		if (evaluationKey != get_RowEvaluationKey())
+		{
 
-		//file name variables
-		ConsoleValidation_Word populationFileName;
-		FileValidation_WordGroup loadedContent;
-		unsigned char fileValidationReturnCode;
+			cout << "\nrow fitness records were made with different inputs, outputs or calculated input expressions";
+			return false;
 
-		//open and load contents of populationFile, the population file from which to load
-		cout << "\nenter name of population load file (including extension): ";
-		populationFileName.getInput_Console();
+		}
 
-		loadedContent.getInput_File(populationFileName);
+		//the row keys must all be present before any array is sized by fileDataSetRowCount
+		const streampos rowKeysPosition(inputFile.tellg());
 
-		if (!loadedContent.test_ListPopulated())
+		inputFile.seekg(0, ios::end);
+
+		if (static_cast<unsigned long long>(inputFile.tellg() - rowKeysPosition) / sizeof(rowKey) < fileDataSetRowCount)
 		{
 
-			cout << "invalid file name or empty file";
+			cout << "\nrow fitness records file is incomplete";
 			return false;
 
 		}
 
-		//initial editing/validation
-		UniformList<ValidationLetter_ConstructCode> tempConstructCodes;
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('<'));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode(">", 0, true, 1, 0));
-		tempConstructCodes.add_NewNode(ValidationLetter_ConstructCode('>'));
-		ValidationWord universalTag(tempConstructCodes);
+		inputFile.seekg(rowKeysPosition);
 
-		//delete all spaces
-		loadedContent.editRange_DeleteWhitespace(loadedContent.get_FirstNode(),
-			loadedContent.get_LastNode(), false);
+		//hash table of (current row index + 1) by row key, used to find the
+		//current row of each file row
+		while (tableLength < dataSetRowCount * 2)
+			tableLength *= 2;
 
-		//insert word divisions before and after any angled brace tags
-		loadedContent.editRange_Split(universalTag, loadedContent.get_FirstNode(),
-			loadedContent.get_LastNode(), true, true);
+		ExtensibleArray<unsigned long long> rowKeys(dataSetRowCount);
+		ExtensibleArray<unsigned long long> rowTable(tableLength);
+		ExtensibleArray<unsigned long long> fileRowIndices(fileDataSetRowCount ? fileDataSetRowCount : 1);
+		ExtensibleArray<unsigned long long> netContentHashes(totalNetCount);
 
-		UniformNode<Word> *wordIterationNode = loadedContent.get_FirstNode();
+		for (tableIndex = 0; tableIndex < tableLength; tableIndex++)
+			*(rowTable.get_ElementAddress(tableIndex)) = 0;
 
-		//validate the leading and numerical properties sections of the file, initialize
-		//totalNetCount, inputCellCount, outputCellCount, totalCellCount,
-		//maxRoundsPerStimulate, dataSetColumnCount, dataSetRowCount,
-		//totalDataFrameCount, and calculatedInputsCount
-		fileValidationReturnCode = sub_Initialize_Validate_NumericalProperties(
-			loadedContent, wordIterationNode);
-		
-		if (!sub_Initialize_InterpretReturn_NumericalPropertiesValidation(fileValidationReturnCode))
-			return false;
+		for (dataSetRowIndex = 0; dataSetRowIndex < dataSetRowCount; dataSetRowIndex++)
+		{
 
-		//validate the inputs section of the file, initialize fixedInputs, calculatedInputs and calculatedInputsPrepValues
-		fileValidationReturnCode = sub_Initialize_Validate_Inputs(
-			loadedContent, wordIterationNode);
+			rowKey = get_DataSetRowKey(dataSetRowIndex);
+			*(rowKeys.get_ElementAddress(dataSetRowIndex)) = rowKey;
+			tableIndex = rowKey & (tableLength - 1);
 
-		if (!sub_Initialize_InterpretReturn_InputsValidation(fileValidationReturnCode))
-			return false;
+			while (rowTable.get_Element(tableIndex))
+				tableIndex = (tableIndex + 1) & (tableLength - 1);
 
-		//validate the outputs section of the file, initialize outputs
-		fileValidationReturnCode = sub_Initialize_Validate_Outputs(
-			loadedContent, wordIterationNode);
+			*(rowTable.get_ElementAddress(tableIndex)) = dataSetRowIndex + 1;
 
-		if (!sub_Initialize_InterpretReturn_OutputsValidation(fileValidationReturnCode))
-			return false;
+		}
 
-		//validate the evaluation criteria and calculated input update expressions sections
-		//of the file, initialize variablesList, updatingFixedInputsVariables,
-		//evaluationCriteriaExpressions and calculatedInputUpdateExpressions
-		fileValidationReturnCode = sub_Initialize_Validate_Expressions(
-			loadedContent, wordIterationNode);
+		//map each file row to its current row (dataSetRowCount if it no longer exists)
+		for (fileDataSetRowIndex = 0; fileDataSetRowIndex < fileDataSetRowCount; fileDataSetRowIndex++)
+		{
 
-		if (!sub_Initialize_InterpretReturn_ExpressionsValidation(
-			fileValidationReturnCode))
-			return false;
+			if (!inputValue_FromOpenFile_Binary(rowKey, inputFile))
+			{
 
-		//validate the cellControls section of the file,
-		//initialize cellControls and trackers
-		fileValidationReturnCode = sub_Initialize_ValidateCellControls(
-			loadedContent, wordIterationNode);
+				cout << "\nrow fitness records file is incomplete";
+				return false;
 
-		if (!sub_Initialize_InterpretReturn_CellControlsValidation(fileValidationReturnCode))
-			return false;
+			}
 
-		//validate the nets and terminal sections of the file,
-		//initialize nets
-		fileValidationReturnCode = sub_Initialize_ValidateNetsAndTerminal(
-			loadedContent, wordIterationNode);
+			*(fileRowIndices.get_ElementAddress(fileDataSetRowIndex)) = dataSetRowCount;
+			tableIndex = rowKey & (tableLength - 1);
 
-		if (!sub_Initialize_InterpretReturn_NetsAndTerminalValidation(fileValidationReturnCode))
-			return false;
+			while (rowTable.get_Element(tableIndex))
+			{
 
-		//every section of the file has been checked and cross validated
-		//all population variables have been initialized
-		return true;
+				dataSetRowIndex = rowTable.get_Element(tableIndex) - 1;
 
-	}
+				if (rowKeys.get_Element(dataSetRowIndex) == rowKey)
+				{
 
-	void evolve_Asexual(const unsigned int evolutionCyclesCount,
-		const unsigned short mutationsPerNetPerCycle, const double mutationAmplitude)
-	{
+					*(fileRowIndices.get_ElementAddress(fileDataSetRowIndex)) = dataSetRowIndex;
+					matchedRowCount++;
+					break;
 
-		//used to facilitate updating calculatedInputs in parallel rather than in series
-		ExtensibleArray<double> calculatedInputsPrepValues(calculatedInputsCount);
+				}
 
-		//arrays used to store cell indices reach action potential in a given round
-		//within the stimulate() function (array length set to totalCellCount + 1
-		//because it is possible for every cell to be activated in a single stimulus
-		//round and one additional element is needed in that case to store the terminal
-		//boundary marker value of (-1)
-		ExtensibleArray<int> activationListRoundA(totalCellCount + 1);
-		ExtensibleArray<int> activationListRoundB(totalCellCount + 1);
+				tableIndex = (tableIndex + 1) & (tableLength - 1);
 
-		//additional initial setup
-		unsigned short cycleCount(0);
-		UniformNode<Net> *netNode;
-		UniformNode<Net> *leadingNetNode;
-		UniformNode<Net> *reverseIterationNetNode;
+			}
 
-		unsigned short count;
+		}
 
-		cout << "\n\npopulation evolution progress:";
+		for (count = 0; count < totalNetCount; count++)
+			*(netContentHashes.get_ElementAddress(count)) = nets.get_ElementAddress(count)->get_ContentHash();
 
-		//evolution cycle loop
-		while (cycleCount < evolutionCyclesCount)
+		if (!inputValue_FromOpenFile_Binary(recordedNetCount, inputFile))
 		{
 
-			//run all stimulation and performance updates
-			stimulate_AllFrames_SingleEvolutionCycle(activationListRoundA,
-				activationListRoundB, calculatedInputsPrepValues);
+			cout << "\nrow fitness records file is incomplete";
+			return false;
+
+		}
 
-			//sort nets in order of fitness
-			netNode = nets.get_FirstNode();
-			leadingNetNode = netNode->get_NextNode();
+		rowFitnessRecording = true;
 
-			do
+		//restore each file record into every net with the same content hash (the rows
+		//are read once and recorded in each matching net as they are read)
+		for (netCount = 0; netCount < recordedNetCount; netCount++)
+		{
+
+			if (!inputValue_FromOpenFile_Binary(contentHash, inputFile))
+			{
+
+				cout << "\nrow fitness records file is incomplete";
+				return false;
+
+			}
+
+			for (count = 0; count < totalNetCount; count++)
 			{
 
-				if (leadingNetNode->content.get_FitnessRating() < netNode->content.get_FitnessRating())
+				if (netContentHashes.get_Element(count) == contentHash)
 				{
 
-					reverseIterationNetNode = netNode->get_PriorNode();
+					nets.get_ElementAddress(count)->begin_RowFitnessRecord(dataSetRowCount);
+					restoredNetCount++;
 
-					do
-					{
+				}
 
-						if (!reverseIterationNetNode)
-						{
+			}
 
-							nets.move_Node(leadingNetNode, NULL, false);
-							break;
+			for (fileDataSetRowIndex = 0; fileDataSetRowIndex < fileDataSetRowCount; fileDataSetRowIndex++)
+			{
 
-						}
+				if (!inputValue_FromOpenFile_Binary(recorded, inputFile)
+					|| (recorded && !inputValue_FromOpenFile_Binary(rowFitnessRating, inputFile)))
+				{
 
-						else if (leadingNetNode->content.get_FitnessRating() >= reverseIterationNetNode->content.get_FitnessRating())
-						{
+					cout << "\nrow fitness records file is incomplete";
+					return false;
 
-							nets.move_Node(leadingNetNode, reverseIterationNetNode, true);
-							break;
+				}
 
-						}
+				dataSetRowIndex = fileRowIndices.get_Element(fileDataSetRowIndex);
 
-						else //(leadingNetNode->content.get_FitnessRating() < reverseIterationNetNode->content.get_FitnessRating())
-							reverseIterationNetNode = reverseIterationNetNode->get_PriorNode();
+				if (!recorded || dataSetRowIndex == dataSetRowCount)
+					continue;
 
-					} while (true);
+				for (count = 0; count < totalNetCount; count++)
+				{
+
+					if (netContentHashes.get_Element(count) == contentHash)
+						nets.get_ElementAddress(count)->record_RowFitness(dataSetRowIndex, rowFitnessRating);
 
 				}
 
-				else
-					netNode = leadingNetNode;
+			}
 
-				leadingNetNode = netNode->get_NextNode();
+		}
 
-			} while (leadingNetNode);
+		cout << "\nrow fitness records restored for " << restoredNetCount << " nets; ";
+		cout << matchedRowCount << " of " << dataSetRowCount << " data set rows recorded previously";
 
-			//asexual reproduction of top performing nets
-			netNode = nets.get_FirstNode();
-			reverseIterationNetNode = nets.get_LastNode();
+		return true;
 
-			for (count = (totalNetCount / 2); count > 0; count--)
-			{
+	}
 
-				reverseIterationNetNode->content = netNode->content;
+	//outputs the recorded fitness contribution of every data set row for the top
+	//netsIncluded ranked nets to outputFileName as one JSON object per net (rows not
+	//recorded since the net last changed are omitted); requires row fitness recording
+	//(see set_RowFitnessRecording()) and costs no evaluations; returns false if the file
+	//does not open; assumes netsIncluded <= totalNetCount
+	bool output_RowFitnessBreakdown_JSON(Word &outputFileName, const unsigned short netsIncluded = 1)
+	{
 
-				netNode = netNode->get_NextNode();
-				reverseIterationNetNode = reverseIterationNetNode->get_PriorNode();
+		ofstream outputFile;
+		unsigned long long dataSetRowIndex;
+		double rowFitnessRating;
+		bool firstRow;
+		Net *net;
 
-			}
+		if (!open_OutputFile(outputFile, outputFileName))
+			return false;
 
-			//mutate all but the top performing net
-			netNode = nets.get_FirstNode()->get_NextNode();
+		for (unsigned short rank = 0; rank < netsIncluded; rank++)
+		{
 
-			do
-			{
+			net = get_RankedNet(rank);
+			firstRow = true;
 
-				netNode->content.mutate(cellControls,
-					mutationsPerNetPerCycle, mutationAmplitude);
+			outputFile << "{\"rank\":" << rank;
+			outputFile << ",\"fitnessRating\":";
 
-				netNode = netNode->get_NextNode();
+			if (isfinite(net->get_FitnessRating()))
+				outputDouble_ToOpenFile(net->get_FitnessRating(), outputFile, 15);
 
-			} while (netNode);
+			else
+				outputFile << "null";
 
-			cycleCount++;
-	
-			cout << "\n\tcycle " << cycleCount << " completed; top performing net's fitnessRating is ";
-			cout << nets.get_FirstNode()->content.get_FitnessRating();
+			outputFile << ",\"rows\":[";
 
-		}
+			for (dataSetRowIndex = 0; dataSetRowIndex < net->get_RowFitnessRecordLength(); dataSetRowIndex++)
+			{
 
-		cout << "\npopulation evolution completed successfully";
+				if (!net->get_RecordedRowFitness(dataSetRowIndex, rowFitnessRating))
+					continue;
 
-	}
+				if (!firstRow)
+					outputFile << ",";
 
-	//assumes maxSpliceLength > 0
-	void evolve_Sexual(const unsigned int evolutionCyclesCount,
-		const unsigned short mutationsPerNetPerCycle,
-		const double mutationAmplitude, const unsigned short maxSpliceLength)
-	{
+				outputFile << "{\"dataSetRow\":" << dataSetRowIndex << ",\"name\":\"";
+				fixedInputs.get_RowName(dataSetRowIndex).output_ToOpenFile(outputFile);
+				outputFile << "\",\"fitnessRating\":";
 
-		//used to facilitate updating calculatedInputs in parallel rather than in series
-		ExtensibleArray<double> calculatedInputsPrepValues(calculatedInputsCount);
+				if (isfinite(rowFitnessRating))
+					outputDouble_ToOpenFile(rowFitnessRating, outputFile, 15);
 
-		//arrays used to store cell indices reach action potential in a given round
-		//within the stimulate() function (array length set to totalCellCount + 1
-		//because it is possible for every cell to be activated in a single stimulus
-		//round and one additional element is needed in that case to store the terminal
-		//boundary marker value of (-1)
-		ExtensibleArray<int> activationListRoundA(totalCellCount + 1);
-		ExtensibleArray<int> activationListRoundB(totalCellCount + 1);
+				else
+					outputFile << "null";
 
-		//additional initial setup
-		unsigned short cycleCount = 0;
-		UniformNode<Net> *netNode;
-		UniformNode<Net> *leadingNetNode;
-		UniformNode<Net> *reverseIterationNetNode;
-		unsigned short netIndex;
-		unsigned short count;
-		unsigned short reproductionCount;
+				outputFile << "}";
 
-		cout << "\n\npopulation evolution progress:";
+				firstRow = false;
 
-		//evolution cycle loop
-		while (cycleCount < evolutionCyclesCount)
-		{
+			}
 
-			//run all stimulation and performance updates
-			stimulate_AllFrames_SingleEvolutionCycle(activationListRoundA,
-				activationListRoundB, calculatedInputsPrepValues);
+			outputFile << "]}\n";
 
-			//sort nets in order of fitness
-			netNode = nets.get_FirstNode();
-			leadingNetNode = netNode->get_NextNode();
+		}
 
-			do
-			{
+		outputFile.close();
 
-				if (leadingNetNode->content.get_FitnessRating() < netNode->content.get_FitnessRating())
-				{
+		return true;
 
-					reverseIterationNetNode = netNode->get_PriorNode();
+	}
 
-					do
-					{
+	//evolves the population via asexual reproduction until a stop condition of runControl
+	//is met (see sub_Evolve()); per cycle progress is output to progressOutput as one JSON
+	//object per line, the cycles completed and stop reason are recorded in runControl
+	void evolve_Asexual(RunControl &runControl, const unsigned short mutationsPerNetPerCycle,
+		const double mutationAmplitude, const bool adaptiveMutation = false,
+		ostream &progressOutput = cout)
+	{
 
-						if (!reverseIterationNetNode)
-						{
+		EvolutionState state(totalNetCount, mutationsPerNetPerCycle, mutationAmplitude,
+			0, adaptiveMutation);
 
-							nets.move_Node(leadingNetNode, NULL, false);
-							break;
+		cout << "\n\npopulation evolution progress:\n";
 
-						}
+		sub_Evolve(runControl, state, progressOutput);
 
-						else if (leadingNetNode->content.get_FitnessRating() >= reverseIterationNetNode->content.get_FitnessRating())
-						{
+		cout << "\npopulation evolution stopped after " << runControl.get_CyclesCompleted() << " cycles; ";
+		runControl.output_StopReason(cout);
 
-							nets.move_Node(leadingNetNode, reverseIterationNetNode, true);
-							break;
+	}
 
-						}
+	//evolves the population via asexual reproduction for evolutionCyclesCount cycles
+	void evolve_Asexual(const unsigned int evolutionCyclesCount,
+		const unsigned short mutationsPerNetPerCycle, const double mutationAmplitude,
+		const bool adaptiveMutation = false)
+	{
 
-						else //(leadingNetNode->content.get_FitnessRating() < reverseIterationNetNode->content.get_FitnessRating())
-							reverseIterationNetNode = reverseIterationNetNode->get_PriorNode();
+		RunControl runControl(evolutionCyclesCount);
 
-					} while (true);
+		evolve_Asexual(runControl, mutationsPerNetPerCycle, mutationAmplitude, adaptiveMutation);
 
-				}
+	}
 
-				else
-					netNode = leadingNetNode;
+	//evolves the population via sexual reproduction until a stop condition of runControl
+	//is met (see sub_Evolve()); per cycle progress is output to progressOutput as one JSON
+	//object per line, the cycles completed and stop reason are recorded in runControl;
+	//assumes maxSpliceLength > 0
+	void evolve_Sexual(RunControl &runControl, const unsigned short mutationsPerNetPerCycle,
+		const double mutationAmplitude, const unsigned short maxSpliceLength,
+		const bool adaptiveMutation = false, ostream &progressOutput = cout)
+	{
 
-				leadingNetNode = netNode->get_NextNode();
+		EvolutionState state(totalNetCount, mutationsPerNetPerCycle, mutationAmplitude,
+			maxSpliceLength, adaptiveMutation);
 
-			} while (leadingNetNode);
+		cout << "\n\npopulation evolution progress:\n";
 
-			//sexual reproduction of top performing nets
-			//netNode is acting as mother, leadingNetNode as father, and reverseIterationNode as child
-			netNode = nets.get_FirstNode();
-			reverseIterationNetNode = nets.get_LastNode();
+		sub_Evolve(runControl, state, progressOutput);
 
-			reproductionCount = (totalNetCount / 2);
+		cout << "\npopulation evolution stopped after " << runControl.get_CyclesCompleted() << " cycles; ";
+		runControl.output_StopReason(cout);
 
-			for (count = 0; count < reproductionCount; count++)
-			{
+	}
 
-				//randomly select the father net
-				do
-				{
+	//evolves the population via sexual reproduction for evolutionCyclesCount
+	//cycles; assumes maxSpliceLength > 0
+	void evolve_Sexual(const unsigned int evolutionCyclesCount,
+		const unsigned short mutationsPerNetPerCycle, const double mutationAmplitude,
+		const unsigned short maxSpliceLength, const bool adaptiveMutation = false)
+	{
 
-					netIndex = rand() % (totalNetCount - count);
+		RunControl runControl(evolutionCyclesCount);
 
-				} while (netIndex == count || netIndex >= (totalNetCount - 1 - count));
+		evolve_Sexual(runControl, mutationsPerNetPerCycle, mutationAmplitude,
+			maxSpliceLength, adaptiveMutation);
 
-				leadingNetNode = nets.get_NodeAddress(netIndex);
+	}
 
-				//splice groups of cells from mother and father nets into child
-				reverseIterationNetNode->content.meiosis(netNode->content.get_Cells(),
-					leadingNetNode->content.get_Cells(), maxSpliceLength);
+	//resumes the evolution run checkpointed to checkpointFileName (see
+	//RunControl::set_Checkpoints()) and continues it until a stop condition of runControl
+	//is met; the population must first be initialized from the same population file as
+	//the checkpointed run; the nets (with their row fitness records) and their ranks, the
+	//evolution schedule and position, the parent selection, screening, early abort, batched
+	//criteria, row fitness recording and incremental evaluation settings, the evolution
+	//parameters and the random generator are all restored, so the run continues
+	//exactly as it would have uninterrupted; runControl's cycle, evaluation and time
+	//budgets count from the start of the original run; returns false (leaving the
+	//population unchanged) if the checkpoint cannot be read or does not fit this population
+	bool resume_Evolve(Word &checkpointFileName, RunControl &runControl, ostream &progressOutput = cout)
+	{
 
-				//iterate to next mother and child nets 
-				netNode = netNode->get_NextNode();
-				reverseIterationNetNode = reverseIterationNetNode->get_PriorNode();
+		EvolutionState state;
+		const unsigned char checkpointValidationReturnCode(load_Checkpoint(checkpointFileName, state));
 
-			}
+		if (checkpointValidationReturnCode == 1)
+			cout << "\ncheckpoint file could not be opened";
 
-			//mutate all but the top performing net
-			netNode = nets.get_FirstNode()->get_NextNode();
+		else if (checkpointValidationReturnCode == 2)
+			cout << "\nfile is not a checkpoint of this version";
 
-			do
-			{
+		else if (checkpointValidationReturnCode == 3)
+			cout << "\ncheckpoint was written by a population of a different shape";
 
-				netNode->content.mutate(cellControls,
-					mutationsPerNetPerCycle, mutationAmplitude);
+		else if (checkpointValidationReturnCode == 4)
+			cout << "\ncheckpoint run progress is invalid or incomplete";
 
-				netNode = netNode->get_NextNode();
+		else if (checkpointValidationReturnCode == 5)
+			cout << "\ncheckpoint evolution settings are invalid or incomplete";
 
-			} while (netNode);
+		else if (checkpointValidationReturnCode == 6)
+			cout << "\ncheckpoint net ranks are invalid or incomplete";
+
+		else if (checkpointValidationReturnCode == 7)
+			cout << "\ncheckpoint nets are invalid or incomplete";
 
-			cycleCount++;
+		if (checkpointValidationReturnCode)
+			return false;
 
-			cout << "\n\tcycle " << cycleCount << " completed; top performing net's fitnessRating is ";
-			cout << nets.get_FirstNode()->content.get_FitnessRating();
+		cout << "\n\npopulation evolution resumed after cycle " << state.get_CycleCount() << ":\n";
 
-		}
+		sub_Evolve(runControl, state, progressOutput);
 
-		cout << "\npopulation evolution completed successfully";
+		cout << "\npopulation evolution stopped after " << runControl.get_CyclesCompleted() << " cycles; ";
+		runControl.output_StopReason(cout);
+
+		return true;
 
 	}
 
@@ -4439,14 +7221,14 @@ public:
 
 		//output to file while running all stimulation and performance updates
 		if (recordingType)
-			recordingData.output_ToFile_JSON(outputFile, nets.get_FirstNode()->content.get_Cells(),
+			recordingData.output_ToFile_JSON(outputFile, get_RankedNet(0)->get_Cells(),
 				totalCellCount, totalDataFrameCount);
 
 		else
 		{
 
 			outputFile << "<?xml version = \"1.0\"?>";
-			recordingData.output_ToFile_XML(outputFile, nets.get_FirstNode()->content.get_Cells(),
+			recordingData.output_ToFile_XML(outputFile, get_RankedNet(0)->get_Cells(),
 				totalCellCount, totalDataFrameCount);
 
 		}
@@ -4471,7 +7253,6 @@ public:
 			return;
 
 		unsigned long long count;
-		UniformNode<Net> *netNode(nets.get_FirstNode());
 
 		//output to file
 		outputFile << "<?xml version = \"1.0\"?>";
@@ -4517,6 +7298,23 @@ public:
 		}
 		outputFile << "\n\t</outputs>";
 
+		//lossAccumulators (an optional section)
+		if (lossAccumulatorCount)
+		{
+
+			outputFile << "\n\t<lossAccumulators>";
+			for (count = 0; count < lossAccumulatorCount; count++)
+			{
+
+				outputFile << "\n\t\t<la_" << count << ">";
+				lossAccumulators.get_ElementAddress(count)->output_ToOpenFile_XML(outputFile);
+				outputFile << "\n\t\t</la_" << count << ">";
+
+			}
+			outputFile << "\n\t</lossAccumulators>";
+
+		}
+
 		//evaluationCriteriaExpressions
 		outputFile << "\n\t<evaluationCriteriaExpressions>";
 		for (count = 0; count < dataSetRowCount; count++)
@@ -4561,11 +7359,9 @@ public:
 		{
 
 			outputFile << "\n\t\t<ng_" << count << ">";
-			netNode->content.output_ToOpenFile_XML(outputFile);
+			get_RankedNet(count)->output_ToOpenFile_XML(outputFile);
 			outputFile << "\n\t\t</ng_" << count << ">";
 
-			netNode = netNode->get_NextNode();
-
 		}
 		outputFile << "\n\t</netGroups>";
 
@@ -4587,7 +7383,6 @@ public:
 			return;
 
 		unsigned long long count;
-		UniformNode<Net> *netNode(nets.get_FirstNode());
 
 		//output to file
 		outputFile << "{";
@@ -4639,6 +7434,21 @@ public:
 		outputs.get_ElementAddress(count)->output_ToOpenFile_JSON(outputFile);
 		outputFile << "}],";
 
+		//lossAccumulators
+		outputFile << "\"lossAccumulators\":[";
+		for (count = 0; count < lossAccumulatorCount; count++)
+		{
+
+			if (count)
+				outputFile << ",";
+
+			outputFile << "{";
+			lossAccumulators.get_ElementAddress(count)->output_ToOpenFile_JSON(outputFile);
+			outputFile << "}";
+
+		}
+		outputFile << "],";
+
 		//evaluationCriteriaExpressions
 		outputFile << "\"evaluationCriteriaExpressions\":[";
 		for (count = 0; count < dataSetRowCount - 1; count++)
@@ -4698,14 +7508,12 @@ public:
 		{
 
 			outputFile << "{";
-			netNode->content.output_ToOpenFile_JSON(outputFile);
+			get_RankedNet(count)->output_ToOpenFile_JSON(outputFile);
 			outputFile << "},";
 
-			netNode = netNode->get_NextNode();
-
 		}
 		outputFile << "{";
-		netNode->content.output_ToOpenFile_JSON(outputFile);
+		get_RankedNet(count)->output_ToOpenFile_JSON(outputFile);
 		outputFile << "}]";
 
 		outputFile << "}";
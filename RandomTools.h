@@ -0,0 +1,83 @@
+#ifndef RANDOMTOOLS_H_INCLUDED
+#define RANDOMTOOLS_H_INCLUDED
+
+//a small pseudo random number generator (splitmix64) used in place of rand()
+//throughout the nets; its whole state is a single 64 bit value so that it can
+//be saved and restored exactly (see Population evolution checkpoints), which
+//rand() does not allow
+class RandomGenerator
+{
+
+private:
+
+	unsigned long long state; //advanced by a fixed odd increment on every draw
+
+public:
+
+	//default constructor - the starting state is arbitrary
+	RandomGenerator() : state(0x853C49E6748FEA9BULL) {}
+
+	//destructor
+	~RandomGenerator() {}
+
+	//restarts the sequence from seedValue
+	void seed(const unsigned long long seedValue)
+	{
+
+		state = seedValue;
+
+	}
+
+	//getter
+	unsigned long long get_State() const
+	{
+
+		return state;
+
+	}
+
+	//setter; restores a state returned by get_State()
+	void set_State(const unsigned long long aState)
+	{
+
+		state = aState;
+
+	}
+
+	//returns a pseudo random integer in the range [0, 2147483647]
+	unsigned int get_Int()
+	{
+
+		state += 0x9E3779B97F4A7C15ULL;
+
+		unsigned long long mixedState(state);
+
+		mixedState = (mixedState ^ (mixedState >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		mixedState = (mixedState ^ (mixedState >> 27)) * 0x94D049BB133111EBULL;
+
+		return static_cast<unsigned int>((mixedState ^ (mixedState >> 31)) >> 33);
+
+	}
+
+};
+
+//returns the generator shared by the whole program
+inline RandomGenerator &get_RandomGenerator()
+{
+
+	static RandomGenerator generator;
+
+	return generator;
+
+}
+
+//returns a pseudo random integer in the range [0, 2147483647] from the
+//shared generator (see RandomGenerator::get_Int())
+inline unsigned int get_RandomInt()
+{
+
+	return get_RandomGenerator().get_Int();
+
+}
+
+#endif // RANDOMTOOLS_H_INCLUDED
@@ -27,7 +27,7 @@ public:
 	~RecordedStimulusRound() {}
 
 	//assumes that outputFile is already open
-	void output_ToOpenFile_XML(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToOpenFile_XML(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short roundCount, const unsigned short totalCellCount)
 	{
 
@@ -41,7 +41,7 @@ public:
 		{
 
 			recordingTracker = trackersStates.get_ElementAddress(cellIndex);
-			recordingCell = netCells.get_ElementAddress(cellIndex);
+			recordingCell = netCells.get_Element(cellIndex);
 
 			outputFile << "\n\t\t\t\t\t<c_" << cellIndex << ">";
 
@@ -100,7 +100,7 @@ public:
 
 	}
 
-	void output_ToOpenFile_JSON(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToOpenFile_JSON(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short roundCount, unsigned short aTotalCellCount)
 	{
 
@@ -115,7 +115,7 @@ public:
 		{
 
 			recordingTracker = trackersStates.get_ElementAddress(cellIndex);
-			recordingCell = netCells.get_ElementAddress(cellIndex);
+			recordingCell = netCells.get_Element(cellIndex);
 
 			outputFile << "{";
 
@@ -168,7 +168,7 @@ public:
 		}
 
 		recordingTracker = trackersStates.get_ElementAddress(cellIndex);
-		recordingCell = netCells.get_ElementAddress(cellIndex);
+		recordingCell = netCells.get_Element(cellIndex);
 
 		outputFile << "{";
 
@@ -251,7 +251,7 @@ public:
 	}
 
 	//assumes outputFile is already open, stimulusRounds is populated
-	void output_ToFile_XML(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToFile_XML(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short totalCellCount)
 	{
 
@@ -279,7 +279,7 @@ public:
 
 	}
 
-	void output_ToFile_JSON(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToFile_JSON(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short totalCellCount)
 	{
 
@@ -353,7 +353,7 @@ public:
 
 	//assumes outputFile is already open, assumes every stimulus round in each element of dataFrames
 	//is populated with at least one member
-	void output_ToFile_XML(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToFile_XML(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short totalCellCount, const unsigned long long totalDataFrameCount)
 	{
 
@@ -378,7 +378,7 @@ public:
 
 	//assumes outputFile is already open, assumes every stimulus round in each element of dataFrames
 	//is populated with at least one member
-	void output_ToFile_JSON(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToFile_JSON(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short totalCellCount, const unsigned long long totalDataFrameCount)
 	{
 
@@ -453,7 +453,7 @@ public:
 	//assumes outputFile is already open, assumes every stimulus round in each element of dataFrames
 	//in every dataSetRow is populated with at least one member, assumes dataSetRows is populated with
 	//at least one member
-	void output_ToFile_XML(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToFile_XML(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short totalCellCount, const unsigned long long totalDataFrameCount)
 	{
 
@@ -492,7 +492,7 @@ public:
 	//assumes outputFile is already open, assumes every stimulus round in each element of dataFrames
 	//in every dataSetRow is populated with at least one member, assumes dataSetRows is populated with
 	//at least one member
-	void output_ToFile_JSON(ofstream &outputFile, ExtensibleArray<Cell> &netCells,
+	void output_ToFile_JSON(ofstream &outputFile, ExtensibleArray<Cell*> &netCells,
 		const unsigned short totalCellCount, const unsigned long long totalDataFrameCount)
 	{
 
@@ -0,0 +1,271 @@
+#ifndef RUNCONTROL_H_INCLUDED
+#define RUNCONTROL_H_INCLUDED
+
+#include "StringTools.h"
+
+//controls how long a single call to Population::evolve_Asexual()/evolve_Sexual() runs
+//and how often it is checkpointed; every stop condition other than maxCycles, and
+//checkpointing, are disabled until their setters are called; after the run, the cycles
+//completed and the reason the run stopped are recorded here
+class RunControl
+{
+
+private:
+
+	//stop conditions
+	unsigned int maxCycles; //maximum number of evolution cycles (0 means none are run)
+	bool targetFitnessRatingEnabled; //true if the run stops once targetFitnessRating is reached
+	double targetFitnessRating; //the run stops once the top net's fitnessRating over every data set row is <= this value
+	double maxSeconds; //wall clock budget in seconds (0.0 means unlimited)
+	unsigned long long maxNetRowEvaluations; //budget of single net, single data set row evaluations (0 means unlimited)
+	unsigned int stagnationCycles; //cycles evaluating every data set row without improvement of the best fitnessRating before stagnation (0 means never)
+
+	//stagnation restart properties
+	unsigned short maxRestarts; //number of times the population is reseeded on stagnation before the run stops
+	double reseedFraction; //fraction of the active nets (from the bottom rank) replaced on each restart (0.0, 1.0)
+	unsigned short reseedMutationsPerNet; //mutations applied to each reseeded net (>= 1)
+	double reseedMutationAmplitude; //amplitude of each mutation applied to reseeded nets (> 0.0)
+
+	//checkpoint properties
+	Word checkpointFileName; //file the evolution checkpoint is (re)written to (see Population::resume_Evolve())
+	unsigned int checkpointCycles; //cycles between checkpoints (0 means checkpoints are not cycle based)
+	double checkpointSeconds; //wall clock seconds between checkpoints (0.0 means checkpoints are not time based)
+
+	//results
+	unsigned int cyclesCompleted; //number of evolution cycles completed in the last run
+	unsigned char stopReason; //0 means not run, 1 maxCycles, 2 targetFitnessRating, 3 maxSeconds, 4 maxNetRowEvaluations, 5 stagnation
+
+public:
+
+	//default constructor - these values are very arbitrary
+	RunControl() : maxCycles(1), targetFitnessRatingEnabled(false), targetFitnessRating(0.0),
+		maxSeconds(0.0), maxNetRowEvaluations(0), stagnationCycles(0), maxRestarts(0),
+		reseedFraction(0.5), reseedMutationsPerNet(1), reseedMutationAmplitude(1.0),
+		checkpointCycles(0), checkpointSeconds(0.0), cyclesCompleted(0), stopReason(0) {}
+
+	//modified constructor
+	RunControl(const unsigned int aMaxCycles) : maxCycles(aMaxCycles),
+		targetFitnessRatingEnabled(false), targetFitnessRating(0.0), maxSeconds(0.0),
+		maxNetRowEvaluations(0), stagnationCycles(0), maxRestarts(0), reseedFraction(0.5),
+		reseedMutationsPerNet(1), reseedMutationAmplitude(1.0), checkpointCycles(0),
+		checkpointSeconds(0.0), cyclesCompleted(0), stopReason(0) {}
+
+	//destructor
+	~RunControl() {}
+
+	//setter
+	void set_TargetFitnessRating(const double aTargetFitnessRating)
+	{
+
+		targetFitnessRatingEnabled = true;
+		targetFitnessRating = aTargetFitnessRating;
+
+	}
+
+	//setter; 0.0 means unlimited
+	void set_MaxSeconds(const double aMaxSeconds)
+	{
+
+		maxSeconds = aMaxSeconds;
+
+	}
+
+	//setter; 0 means unlimited
+	void set_MaxNetRowEvaluations(const unsigned long long aMaxNetRowEvaluations)
+	{
+
+		maxNetRowEvaluations = aMaxNetRowEvaluations;
+
+	}
+
+	//sets the stagnation stop/restart condition; the run stagnates after
+	//aStagnationCycles cycles without improvement of the best fitnessRating,
+	//on each of the first aMaxRestarts stagnations the bottom aReseedFraction
+	//of the active nets are replaced by heavily mutated copies of the top net,
+	//the run stops on the next; assumes aReseedFraction is in (0.0, 1.0),
+	//aReseedMutationsPerNet >= 1, and aReseedMutationAmplitude > 0.0
+	void set_Stagnation(const unsigned int aStagnationCycles, const unsigned short aMaxRestarts = 0,
+		const double aReseedFraction = 0.5, const unsigned short aReseedMutationsPerNet = 1,
+		const double aReseedMutationAmplitude = 1.0)
+	{
+
+		stagnationCycles = aStagnationCycles;
+		maxRestarts = aMaxRestarts;
+		reseedFraction = aReseedFraction;
+		reseedMutationsPerNet = aReseedMutationsPerNet;
+		reseedMutationAmplitude = aReseedMutationAmplitude;
+
+	}
+
+	//enables checkpoints; the run is written to aCheckpointFileName (replacing it
+	//atomically) every aCheckpointCycles cycles and/or every aCheckpointSeconds
+	//seconds (0 disables either interval); returns false (leaving checkpoints
+	//unchanged) if the file name is empty or both intervals are 0
+	bool set_Checkpoints(Word &aCheckpointFileName, const unsigned int aCheckpointCycles,
+		const double aCheckpointSeconds = 0.0)
+	{
+
+		if (!aCheckpointFileName.get_ListLength() || (!aCheckpointCycles && aCheckpointSeconds <= 0.0))
+			return false;
+
+		checkpointFileName = aCheckpointFileName;
+		checkpointCycles = aCheckpointCycles;
+		checkpointSeconds = aCheckpointSeconds;
+
+		return true;
+
+	}
+
+	//returns true if checkpoints are enabled and one is due after cyclesSinceCheckpoint
+	//cycles and secondsSinceCheckpoint seconds without one
+	bool test_CheckpointDue(const unsigned int cyclesSinceCheckpoint,
+		const double secondsSinceCheckpoint) const
+	{
+
+		return ((checkpointCycles && cyclesSinceCheckpoint >= checkpointCycles)
+			|| (checkpointSeconds > 0.0 && secondsSinceCheckpoint >= checkpointSeconds));
+
+	}
+
+	//getter
+	Word &get_CheckpointFileName()
+	{
+
+		return checkpointFileName;
+
+	}
+
+	//getter
+	unsigned int get_MaxCycles() const
+	{
+
+		return maxCycles;
+
+	}
+
+	//returns true if targetFitnessRating is enabled and fitnessRating reaches it
+	bool test_TargetReached(const double fitnessRating) const
+	{
+
+		return (targetFitnessRatingEnabled && fitnessRating <= targetFitnessRating);
+
+	}
+
+	//getter
+	double get_MaxSeconds() const
+	{
+
+		return maxSeconds;
+
+	}
+
+	//getter
+	unsigned long long get_MaxNetRowEvaluations() const
+	{
+
+		return maxNetRowEvaluations;
+
+	}
+
+	//getter
+	unsigned int get_StagnationCycles() const
+	{
+
+		return stagnationCycles;
+
+	}
+
+	//getter
+	unsigned short get_MaxRestarts() const
+	{
+
+		return maxRestarts;
+
+	}
+
+	//returns the number of bottom ranked nets of activeNetCount to reseed on a
+	//restart (at least 1 and at most activeNetCount - 1)
+	unsigned short get_ReseedNetCount(const unsigned short activeNetCount) const
+	{
+
+		unsigned short reseedNetCount(static_cast<unsigned short>(reseedFraction
+			* static_cast<double>(activeNetCount)));
+
+		if (!reseedNetCount)
+			reseedNetCount = 1;
+
+		if (reseedNetCount >= activeNetCount)
+			reseedNetCount = activeNetCount - 1;
+
+		return reseedNetCount;
+
+	}
+
+	//getter
+	unsigned short get_ReseedMutationsPerNet() const
+	{
+
+		return reseedMutationsPerNet;
+
+	}
+
+	//getter
+	double get_ReseedMutationAmplitude() const
+	{
+
+		return reseedMutationAmplitude;
+
+	}
+
+	//records the results of a run
+	void set_Results(const unsigned int aCyclesCompleted, const unsigned char aStopReason)
+	{
+
+		cyclesCompleted = aCyclesCompleted;
+		stopReason = aStopReason;
+
+	}
+
+	//getter
+	unsigned int get_CyclesCompleted() const
+	{
+
+		return cyclesCompleted;
+
+	}
+
+	//getter
+	unsigned char get_StopReason() const
+	{
+
+		return stopReason;
+
+	}
+
+	//outputs a short description of stopReason
+	void output_StopReason(ostream &output) const
+	{
+
+		if (stopReason == 1)
+			output << "maximum cycle count reached";
+
+		else if (stopReason == 2)
+			output << "target fitnessRating reached";
+
+		else if (stopReason == 3)
+			output << "wall clock budget exhausted";
+
+		else if (stopReason == 4)
+			output << "evaluation budget exhausted";
+
+		else if (stopReason == 5)
+			output << "best fitnessRating stagnated";
+
+		else
+			output << "not run";
+
+	}
+
+};
+
+#endif // RUNCONTROL_H_INCLUDED
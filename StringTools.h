@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <cstdio>
+#include <cmath>
 #include "MemoryTools.h"
 
 using namespace std;
@@ -1121,6 +1123,19 @@ unsigned char absolutePrecision)
 
 }
 
+//outputs doubleToOutput to output as a JSON number, or as null if doubleToOutput
+//is infinite or not a number (which JSON cannot represent)
+void outputDouble_JSON(const double doubleToOutput, ostream &output)
+{
+
+	if (isfinite(doubleToOutput))
+		output << doubleToOutput;
+
+	else
+		output << "null";
+
+}
+
 //returns true if the function successfully opens the file corresponding to fileName,
 //false if fileName is NULL, an empty c-string, or if the corresponding file does not
 //open (doesn't exist?)
@@ -1206,6 +1221,128 @@ bool open_OutputFile(ofstream &outputFile, UniformList<char> &fileName,
 
 }
 
+//returns a new c-string (to be deleted[] by the caller) holding fileName
+//followed by suffix (which may be an empty c-string); returns NULL if
+//fileName is empty
+char *get_NewFileNameCString(UniformList<char> &fileName, const char *suffix)
+{
+
+	const unsigned long long nameLength = fileName.get_ListLength();
+	unsigned long long suffixLength(0);
+
+	//fileName is empty
+	if (!nameLength)
+		return NULL;
+
+	while (suffix[suffixLength])
+		suffixLength++;
+
+	char* tempCharArray = new char[(nameLength + suffixLength + 1)];
+	UniformNode<char> *charNode = fileName.get_FirstNode();
+	unsigned long long count(0);
+
+	while (charNode)
+	{
+
+		tempCharArray[count] = charNode->content;
+		count++;
+
+		charNode = charNode->get_NextNode();
+
+	}
+
+	for (count = 0; count <= suffixLength; count++)
+		tempCharArray[nameLength + count] = suffix[count];
+
+	return tempCharArray;
+
+}
+
+//returns true if the function successfully opens the file corresponding to
+//fileName for binary input, false if fileName is empty or the file does not open
+bool open_InputFile_Binary(ifstream &inputFile, UniformList<char> &fileName)
+{
+
+	char* tempCharArray = get_NewFileNameCString(fileName, "");
+
+	if (!tempCharArray)
+		return false;
+
+	inputFile.open(tempCharArray, std::ifstream::binary);
+	delete[] tempCharArray;
+
+	return inputFile.is_open();
+
+}
+
+//opens (overwriting) the temporary file corresponding to fileName (fileName
+//followed by ".tmp") for binary output; once the temporary file is written and
+//closed, replace_File_FromTemporary() moves it over fileName so that fileName
+//never holds a partially written file; returns false if the file does not open
+bool open_OutputFile_BinaryTemporary(ofstream &outputFile, UniformList<char> &fileName)
+{
+
+	char* tempCharArray = get_NewFileNameCString(fileName, ".tmp");
+
+	if (!tempCharArray)
+		return false;
+
+	outputFile.open(tempCharArray, std::ofstream::binary | std::ofstream::trunc);
+	delete[] tempCharArray;
+
+	return outputFile.is_open();
+
+}
+
+//replaces the file corresponding to fileName with its closed temporary file (see
+//open_OutputFile_BinaryTemporary()); the replacement is a single rename where the
+//system allows renaming over an existing file, otherwise fileName is removed first;
+//returns false if the temporary file could not be moved
+bool replace_File_FromTemporary(UniformList<char> &fileName)
+{
+
+	char* tempCharArray = get_NewFileNameCString(fileName, ".tmp");
+	char* fileNameCharArray = get_NewFileNameCString(fileName, "");
+
+	if (!tempCharArray)
+		return false;
+
+	bool replaced(!rename(tempCharArray, fileNameCharArray));
+
+	if (!replaced)
+	{
+
+		remove(fileNameCharArray);
+		replaced = !rename(tempCharArray, fileNameCharArray);
+
+	}
+
+	delete[] tempCharArray;
+	delete[] fileNameCharArray;
+
+	return replaced;
+
+}
+
+//writes the bytes of value to outputFile; assumes outputFile is open in binary mode
+template<typename T> void outputValue_ToOpenFile_Binary(const T &value, ofstream &outputFile)
+{
+
+	outputFile.write(reinterpret_cast<const char*>(&value), sizeof(T));
+
+}
+
+//reads the bytes of value from inputFile; returns false if the read failed;
+//assumes inputFile is open in binary mode
+template<typename T> bool inputValue_FromOpenFile_Binary(T &value, ifstream &inputFile)
+{
+
+	inputFile.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+	return !inputFile.fail();
+
+}
+
 class ValidationLetter_ConstructCode
 {
 
@@ -17,8 +17,8 @@ int main()
 	ConsoleValidation_Word userInput;
 	Population myNetPopulation;
 	
-	//seed rand()
-	srand(time(NULL));
+	//seed the random generator
+	get_RandomGenerator().seed(time(NULL));
 
 	cout << "\t\t\t*** WELCOME TO ANTHONY'S NEURAL NET V 2.0 ***";
 